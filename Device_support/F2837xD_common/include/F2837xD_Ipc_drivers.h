@@ -35,15 +35,20 @@ extern "C" {
 // The following are values that are used to define the maximum size of the
 // global circular buffer variables g_asIPCCPU1toCPU2Buffers and
 // g_asIPCCPU2toCPU1Buffers. They are also used in the IpcPut() and IpcGet()
-// functions. IPC_BUFFER_SIZE and NUM_IPC_INTERRUPTS are user-configurable.
+// functions. IPC_BUFFER_SIZE and NUM_IPC_INTERRUPTS are user-configurable
+// (--define, identically on both CPUs).
 //
+#ifndef IPC_BUFFER_SIZE
 #define IPC_BUFFER_SIZE             4     // # of tIpcMessage messages in
                                           // circular buffer
                                           // (must be interval of 2)
+#endif
+#ifndef NUM_IPC_INTERRUPTS
 #define NUM_IPC_INTERRUPTS          4     // # of IPC interrupts using circular
                                           // buffer
                                           // (must be same number on both CPUs
-#define MAX_BUFFER_INDEX            IPC_BUFFER_SIZE - 1
+#endif
+#define MAX_BUFFER_INDEX            (IPC_BUFFER_SIZE - 1)
 
 //
 // The following are values that can be passed to IPCInitialize()
@@ -1,3 +1,16 @@
+// The user must define CLA_C in the project linker settings if using the
+// CLA C compiler
+// Project Properties -> C2000 Linker -> Advanced Options -> Command File
+// Preprocessing -> --define
+#ifdef CLA_C
+// Define a size for the CLA scratchpad area that will be used
+// by the CLA compiler for local symbols and temps
+// Also force references to the special symbols that mark the
+// scratchpad are.
+CLA_SCRATCHPAD_SIZE = 0x100;
+--undef_sym=__cla_scratchpad_end
+--undef_sym=__cla_scratchpad_start
+#endif //CLA_C
 
 MEMORY
 {
@@ -8,7 +21,6 @@ PAGE 0 :
    RAMM0           	: origin = 0x000122, length = 0x0002DE
    RAMD0           	: origin = 0x00B000, length = 0x000800
    RAMLS0          	: origin = 0x008000, length = 0x000800
-   RAMLS1          	: origin = 0x008800, length = 0x000800
    RAMLS2      		: origin = 0x009000, length = 0x000800
    RAMLS3      		: origin = 0x009800, length = 0x000800
    RAMLS4      		: origin = 0x00A000, length = 0x000800
@@ -20,15 +32,29 @@ PAGE 1 :
    RAMM1           : origin = 0x000400, length = 0x000400     /* on-chip RAM block M1 */
    RAMD1           : origin = 0x00B800, length = 0x000800
 
+   RAMLS1          	: origin = 0x008800, length = 0x000800     /* CLA data (cla_acquire.h) */
    RAMLS5     		: origin = 0x00A800, length = 0x000800
 
-   RAMGS      		: origin = 0x00C000, length = 0x00F000
+   CLA1_MSGRAMLOW   : origin = 0x001480, length = 0x000080     /* Written by the CLA */
+   CLA1_MSGRAMHIGH  : origin = 0x001500, length = 0x000080     /* Written by the CPU */
 
-   CPU2TOCPU1RAM   : origin = 0x03F800, length = 0x000400
-   CPU1TOCPU2RAM   : origin = 0x03FC00, length = 0x000400
+   /* GS RAM is split so that the CPU (code, capture buffers) and the DMA (ping-pong
+      and playback buffers) work in separate 4K-word blocks and do not stall each other */
+   RAMGS      		: origin = 0x00C000, length = 0x004000     /* GS0-GS3: code and general data */
+   RAMGS_DMA  		: origin = 0x010000, length = 0x001000     /* GS4: DMA buffers only */
+   RAMGS_CAPTURE	: origin = 0x011000, length = 0x00A000     /* GS5-GS14: deep capture buffers (CAPTURE_DEEP) or GS5-GS8 CPU2 pages, then .text overflow */
+   RAMGS_STREAM	: origin = 0x01B000, length = 0x001000     /* GS15: streaming ring */
+
+   /* Message RAM, split as in the cpu02 2837xD_RAM_lnk_cpu2.cmd (see ipc_link.h) */
+   CPU2TOCPU1RAM   : origin = 0x03F800, length = 0x000100     /* IPC driver, written by CPU2 */
+   CPU2TOCPU1_DATA : origin = 0x03F900, length = 0x000300     /* Cpu2Status, written by CPU2 */
+   CPU1TOCPU2RAM   : origin = 0x03FC00, length = 0x000100     /* IPC driver, written by CPU1 */
+   CPU1TOCPU2_DATA : origin = 0x03FD00, length = 0x000300     /* IpcBlocks[], written by CPU1 */
 
    CANA_MSG_RAM     : origin = 0x049000, length = 0x000800
    CANB_MSG_RAM     : origin = 0x04B000, length = 0x000800
+
+   EMIF1_CS0n       : origin = 0x80000000, length = 0x10000000     /* SDRAM, reached through the DMA only (sdram_store.h) */
 }
 
 
@@ -36,7 +62,9 @@ SECTIONS
 {
    codestart        : > BEGIN,     PAGE = 0
    ramfuncs         : > RAMM0      PAGE = 0
-   .text            : > RAMGS,     PAGE = 1
+   /* .text spills into GS5-GS14 once GS0-GS3 are full, behind the deep capture buffers
+      (0x9C40 of 0xA000 words) or the CPU2 pages (GS5-GS8 in full), both bound to GS5 */
+   .text            : >> RAMGS | RAMGS_CAPTURE,     PAGE = 1
    .cinit           : > RAMM0,     PAGE = 0
    .pinit           : > RAMM0,     PAGE = 0
    .switch          : > RAMM0,     PAGE = 0
@@ -52,6 +80,37 @@ SECTIONS
    ramgs0           : > RAMGS,    PAGE = 1
    ramgs1           : > RAMGS,    PAGE = 1
 
+   DmaCaptureSection : > RAMGS_DMA,     PAGE = 1    /* DMA ping-pong ADC buffers (dma_capture.c) */
+   PlaybackSection  : > RAMGS_DMA,     PAGE = 1    /* DMA DAC playback frames (dac_playback.c) */
+   CaptureBufferSection : > 0x011000, PAGE = 1      /* mmSpeed/maCurrent when CAPTURE_DEEP = 1 */
+   Cpu1ToCpu2PageSection : > 0x011000, PAGE = 1     /* IpcBlocks[] when CPU2_LINK = CPU2_LINK_GSRAM (ipc_link.c) */
+   StreamRingSection : > RAMGS_STREAM,  PAGE = 1    /* Streaming SPSC ring (stream.c) */
+   IsrProfileSection : > RAMGS,   PAGE = 1      /* ISR timing statistics read by the host (isr_profiler.c) */
+   SINTBL           : > RAMGS,    PAGE = 1      /* DDS sine table (sinetab.c), as in the SGEN command files */
+   SciQueueSection  : > RAMGS,    PAGE = 1      /* SCI-A TX/RX queues (sci_driver.c) */
+   TelemetrySection : > RAMGS,    PAGE = 1      /* Telemetry frame buffers (telemetry.c) */
+   Cpu1ToCpu2Section : > CPU1TOCPU2_DATA, PAGE = 1                  /* IpcBlocks[] (ipc_link.c) */
+   Cpu2ToCpu1Section : > CPU2TOCPU1_DATA, PAGE = 1, TYPE = DSECT    /* Cpu2Status, loaded by CPU2 */
+
+   /* CLA acquisition (cla_acquire.h): LS0 program, LS1 data, both handed over by ClaAcquireInit() */
+   Cla1Prog         : > RAMLS0,          PAGE = 0
+   Cla1DataSection  : > RAMLS1,          PAGE = 1    /* ClaRing[], ClaStatus, filter state */
+   Cla1ToCpuMsgRAM  : > CLA1_MSGRAMLOW,  PAGE = 1
+   CpuToCla1MsgRAM  : > CLA1_MSGRAMHIGH, PAGE = 1    /* ClaParams */
+   FilterBankSection : > RAMLS1,         PAGE = 1    /* Filter coefficients and state (filter_bank.c), read by the CLA too */
+
+#ifdef CLA_C
+   /* CLA C compiler sections */
+   CLAscratch       :
+                     { *.obj(CLAscratch)
+                     . += CLA_SCRATCHPAD_SIZE;
+                     *.obj(CLAscratch_end) } >  RAMLS1,  PAGE = 1
+
+   .scratchpad      : > RAMLS1,       PAGE = 1
+   .bss_cla         : > RAMLS1,       PAGE = 1
+   .const_cla       : > RAMLS1,       PAGE = 1
+#endif
+
    .ppdata          : > RAMGS,     PAGE = 1
    .cio          	: > RAMGS,     PAGE = 1
 
@@ -13,21 +13,86 @@
     // Input Variables:
     // Motor Mechanical Speed {-600, 600} [rad/s] | {0.0, 3.3} [V]
     // Motor Armature Current {-2.5, 2.5} [A] | {0.0, 3.3} [V]
+    //
+    // Build switches (actuation_cpu01.h), described in the module headers:
+    //   ADC_CAPTURE_MODE    ISR, DMA ping-pong or CLA capture     dma_capture.h, cla_acquire.h
+    //   DAC_UPDATE_MODE     DACs written per sample or per loop   actuation_cpu01.h
+    //   DAC_SOURCE          ADC inputs, motor model, DDS, replay  motor_model.h, dds.h, dac_playback.h
+    //   DAC_LOAD_MODE       DAC load on the write or on PWMSYNC   dac_playback.h
+    //   FILTER_MODE         Biquad/FIR input conditioning         filter_bank.h
+    //   STREAM_MODE         Timestamped record stream             stream.h
+    //   SCI_MODE            SCI-A link and telemetry              sci_driver.h, telemetry.h
+    //   CPU2_MODE/CPU2_LINK Stream processing on CPU2             ipc_link.h, ipc_batch.h
+    //   SDRAM_MODE          Deep capture in EMIF1 SDRAM           sdram_store.h
+    //   PWM_OUTPUT_MODE     Duty-following ePWM1/ePWM5, HRPWM     pwm_output.h
+    //   ECAP_MODE           eCAP PWM period/duty/phase            ecap_measure.h
+    //   SPEED_INPUT         Speed from ADC-A2 or eQEP1            qep_encoder.h
+    //   SDFM_MODE           Current from an SDFM1 modulator       sdfm_current.h
+    //   CMPSS_MODE          CMPSS6 over-current trip of the PWMs  cmpss_trip.h
+    //   CAPTURE_DEEP        Capture buffers in GS5-GS14           actuation_cpu01.h
+    // The capture trigger (trigger.h) and ISR profiling (isr_profiler.h) are always built.
     // -----------------------------------------------------------------------------
      */
 
     #include "F28x_Project.h"       // Device Header File and Examples Include File
+    #include "actuation_cpu01.h"    // Build configuration and shared acquisition state
+    #include "scaling.h"            // Per-channel ADC gain/offset descriptors
+    #include "dma_capture.h"        // DMA ping-pong ADC capture
+    #include "cla_acquire.h"        // CLA scaling, filtering and DAC path
+    #include "filter_bank.h"        // Per-channel biquad/FIR input conditioning
+    #include "motor_model.h"        // On-board DC motor model
+    #include "dds.h"                // DDS stimulus generators
+    #include "dac_playback.h"       // DMA DAC profile playback
+    #include "sdram_store.h"        // Deep capture store in EMIF1 SDRAM
+    #include "pwm_output.h"         // Closed-loop ePWM1/ePWM5 switching stage
+    #include "ecap_measure.h"       // eCAP PWM period, duty and phase measurement
+    #include "qep_encoder.h"        // eQEP1 encoder position and speed
+    #include "sdfm_current.h"       // SDFM1 sigma-delta current and over-current trip
+    #include "cmpss_trip.h"         // CMPSS6 hardware over-current trip of ePWM1/ePWM5
+    #include "isr_profiler.h"       // ISR execution time and latency statistics
+    #include "trigger.h"            // Capture trigger engine
+    #include "stream.h"             // Continuous sample streaming ring
+    #include "sci_driver.h"         // Non-blocking SCI-A driver
+    #include "telemetry.h"          // Telemetry frame encoder
+    #include "ipc_link.h"           // Sample hand-off to CPU2
 
     // Definitions for PWM generation
     #define PWM1_PERIOD 0xC350          // PWM1 frequency = 50 kHz
     #define PWM1_CMPR25 PWM1_PERIOD>>2  // PWM1 initial duty cycle = 25%
 
+    // Motor model step: one ePWM2 period of 10 ns TBCLK ticks
+    #define MOTOR_STEP_SECONDS ((float32)(ADC_SAMPLE_PERIOD + 1) * 1.0e-8f)
+
+    // DDS sample rate: 100 MHz TBCLK over one ePWM2 period
+    #define DDS_SAMPLE_HZ (1.0e8f / (float32)(ADC_SAMPLE_PERIOD + 1))
+
+    // Encoder sample period: one ePWM2 period of 10 ns TBCLK ticks
+    #define QEP_SAMPLE_SECONDS ((float32)(ADC_SAMPLE_PERIOD + 1) * 1.0e-8f)
+
+    // ISR deadlines for the profiler, in SYSCLK cycles
+    #define ADC_SAMPLE_CYCLES ((Uint32)(ADC_SAMPLE_PERIOD + 1) * PROFILE_CYCLES_PER_TBCLK)    // One ePWM2 period: 4002 = 20.01 us
+
+
 
     // Output Variables
     Uint16 dacOutput;               // Initialize variable for the DAC Outputs - not used (can delete?)
     volatile Uint16 LoadTorque;    // {-0.2, 0.2} [Nm] - Load Torque in Nm | {0.0 V, 3.0 V}
     volatile Uint16 DutyCycle;     // {0, 100}    [%]  - Load Torque in %  | {0.0 V, 3.0 V}
     Uint16 resultsIndex;            // Initialization for the results index - this is the array pointer for ADC conversions; resultsIndex increments to place new value in adjacent cell, and reset when array is full
+    volatile Uint16 dacLatency;     // ePWM2 TBCLK ticks (10 ns) from SOCA to the last DAC write
+    volatile Uint16 dacLatencyMax;  // Worst case dacLatency since reset
+    volatile int16 dutyCycleScaled; // DutyCycle in [0.01 %], see scaling.h
+    volatile int16 loadTorqueScaled;// LoadTorque in [0.1 mNm], see scaling.h
+    volatile Uint16 scaleCycles;    // SYSCLK cycles spent in the last scaling stage (budget: 4000 per 20 us sample)
+    volatile Uint16 scaleCyclesMax; // Worst case scaleCycles since reset
+    volatile Uint16 filterCycles;   // SYSCLK cycles spent in the filter bank for the last sample (FILTER_ON)
+    volatile Uint16 filterCyclesMax;// Worst case filterCycles since reset
+    volatile Uint16 motorCycles;    // SYSCLK cycles spent in the last motor model step (DAC_SOURCE_MODEL)
+    volatile Uint16 motorCyclesMax; // Worst case motorCycles since reset
+    volatile Uint16 ddsCycles;      // SYSCLK cycles spent in the DDS generators for the last sample (DAC_SOURCE_DDS)
+    volatile Uint16 ddsCyclesMax;   // Worst case ddsCycles since reset
+    volatile Uint16 qepCycles;      // SYSCLK cycles spent reading the encoder for the last sample (SPEED_INPUT_QEP)
+    volatile Uint16 qepCyclesMax;   // Worst case qepCycles since reset
 
 
     // PWM Variables
@@ -45,14 +110,16 @@
     void InitEPwm2(void);               // Configure ePWM module 2
     void InitEPwm5(void);               // Configure ePWM module 5
     interrupt void adca1_isr(void);     // ADC interrupt service routine
+    void EndCapture(void);              // Called once the trigger engine completes a capture
 
     // Buffers for storing ADC conversion results
-    #define RESULTS_BUFFER_SIZE 256             // Set the max buffer size of the results to 256 bits
-    Uint16 mmSpeed[RESULTS_BUFFER_SIZE];       // Allocate memory for the ADC-A registers (motor speed)
-    Uint16 maCurrent[RESULTS_BUFFER_SIZE];     // Allocate memory for the ADC-C registers (armature current)
+    #if CAPTURE_DEEP
+    #pragma DATA_SECTION(mmSpeed, "CaptureBufferSection")      // GS5-GS14, away from the DMA block
+    #pragma DATA_SECTION(maCurrent, "CaptureBufferSection")
+    #endif
+    int16 mmSpeed[RESULTS_BUFFER_SIZE];        // Allocate memory for the ADC-A registers (motor speed) [0.1 rad/s]
+    int16 maCurrent[RESULTS_BUFFER_SIZE];      // Allocate memory for the ADC-C registers (armature current) [mA]
     Uint16 resultsIndex;                        // Initialize the Results Index
-    Uint16 pretrig = 0;                         // Set the value of pretrig
-    Uint16 trigger = 0;                         // Set the value of trigger
 
     // Setting up data transfer for --gen_profile_info code coverage
     extern void _TI_stop_pprof_collection(void);
@@ -60,6 +127,9 @@
     // Beginning of the main section of code
     void main(void)
     {
+        Uint16 loopCount = 0;           // Main loop passes since the last LED change
+        Uint16 ledOff = 1;              // LED state, 1 = off
+
         InitSysCtrl();                  // Initialize System Control
         EALLOW;                         // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
         ClkCfgRegs.PERCLKDIVSEL.bit.EPWMCLKDIV = 1; //Enable Clock Configure Registers
@@ -81,21 +151,79 @@
         IFR = 0x0000;       // Set IFR to 0
         InitPieVectTable(); // Initialize the Pie Vector Table
 
+        // Start the ISR profiler
+        ProfileInit();                                                          // CPU Timer 1 as cycle counter
+        ProfileReset(&IsrProfile[ISR_PROFILE_ADCA1], ADC_SAMPLE_CYCLES);        // One sample per call
+        ProfileReset(&IsrProfile[ISR_PROFILE_DMACH4], ADC_SAMPLE_CYCLES * DMA_CAPTURE_HALF_SIZE);  // One half-buffer per call
+
         // Map ISR functions
         EALLOW;                                      // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    #if ADC_CAPTURE_MODE == ADC_CAPTURE_DMA
+        PieVectTable.DMA_CH4_INT = &dmach4_isr;      // Function for DMA channel 4, once per half-buffer
+    #elif ADC_CAPTURE_MODE == ADC_CAPTURE_CLA
+        // No CPU interrupt: ADCAINT1 starts CLA task 1
+    #else
         PieVectTable.ADCA1_INT = &adca1_isr;         // Function for ADCA interrupt 1
+    #endif
+    #if DAC_SOURCE == DAC_SOURCE_PLAYBACK
+        PieVectTable.DMA_CH6_INT = &dmach6_isr;      // Function for DMA channel 6, end of a once pass and once per stream half-buffer
+    #endif
+    #if SDFM_MODE == SDFM_ON
+        PieVectTable.SD1_INT = &sd1_isr;             // Function for the SDFM1 comparator trip
+    #endif
+    #if CMPSS_MODE == CMPSS_ON
+        PieVectTable.EPWM1_TZ_INT = &epwm1_tz_isr;   // Function for the ePWM1 one-shot trip
+    #endif
         EDIS;               // Using EDIS to clear the EALLOW
 
         ConfigureADC();     // Configure the ADC and power it up
 
         SetupADCEpwm();     // Setup the ADC for ePWM triggered conversions on channel 0
+    #if SDFM_MODE == SDFM_ON
+        SdfmCurrentInit();  // SDFM1 filter 1 running and ADC-C scaling set before the capture starts
+    #endif
+
+    #if ADC_CAPTURE_MODE == ADC_CAPTURE_DMA
+        EALLOW;                                         // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+        AdcaRegs.ADCINTSEL1N2.bit.INT1CONT = 1;         // Keep pulsing ADCINT1 for the DMA without the CPU clearing the flag
+        EDIS;                                           // Using EDIS to clear the EALLOW
+        ConfigureDmaCapture();                          // Setup DMA CH1-4 ping-pong transfers
+    #if SDRAM_MODE == SDRAM_ON
+        SdramStoreInit();                               // EMIF1 SDRAM and DMA CH5/CH6, before SCI-A takes GPIO42/43 back
+    #endif
+    #elif ADC_CAPTURE_MODE == ADC_CAPTURE_CLA
+        EALLOW;                                         // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+        AdcaRegs.ADCINTSEL1N2.bit.INT1CONT = 1;         // Keep pulsing ADCINT1 for the CLA without the CPU clearing the flag
+        EDIS;                                           // Using EDIS to clear the EALLOW
+        ClaAcquireInit();                               // LS0/LS1 to the CLA, task 1 on ADCAINT1
+    #endif
 
         // Initialize ePWM modules
+    #if PWM_OUTPUT_MODE == PWM_OUTPUT_FIXED
         InitEPwm1();        // Initialize ePWM 1
         InitEPwm2();        // Initialize ePWM 2
         InitEPwm5();        // Initialize ePWM 5
+    #else
+        InitEPwm2();        // Initialize ePWM 2
+        PwmOutputInit(phaseOffset5);    // ePWM1/ePWM5 switching stage at 0 % duty, MEP calibrated in PWM_OUTPUT_HRPWM
+    #endif
+    #if ECAP_MODE == ECAP_ON
+        EcapMeasureInit();  // eCAP1-3 armed on PWM1A, PWM5A and ECAP_EXT_GPIO before the ePWMs start
+    #endif
+    #if SPEED_INPUT == SPEED_INPUT_QEP
+        QepEncoderInit(QEP_SAMPLE_SECONDS);     // eQEP1 counting from position 0, waiting for the index
+    #endif
+    #if CMPSS_MODE == CMPSS_ON
+        CmpssTripInit();    // CMPSS6 comparing and ePWM1/ePWM5 trip zones armed before the ePWMs start
+    #endif
 
         ConfigureDAC();     // Configure DACs
+    #if DAC_SOURCE == DAC_SOURCE_PLAYBACK
+    #if ADC_CAPTURE_MODE != ADC_CAPTURE_DMA
+        DMAInitialize();    // Hard reset the DMA (ConfigureDmaCapture() has done it in DMA mode)
+    #endif
+        ConfigurePlayback();    // ePWM6 frozen, DACs at mid-scale until PlaybackStart()
+    #endif
 
         // Initialize results buffers
         for(resultsIndex = 0; resultsIndex < RESULTS_BUFFER_SIZE; resultsIndex++)
@@ -104,13 +232,67 @@
             maCurrent[resultsIndex] = 0;      // Set ADC-C current results index to 0
         }
         resultsIndex = 0;   // Reset the results index counter
+        TriggerInit();      // Default trigger: rising edge on GPIO0, armed
+    #if FILTER_MODE == FILTER_ON
+        FilterInit();       // Default low-pass on every channel
+    #endif
+    #if DAC_SOURCE == DAC_SOURCE_MODEL
+        MotorInit(MOTOR_STEP_SECONDS);  // Default motor at rest, RK4
+    #endif
+    #if DAC_SOURCE == DAC_SOURCE_DDS
+        DdsInit(DDS_SAMPLE_HZ);         // Generators off until DdsLoad(), DACs at mid-scale
+    #endif
+    #if STREAM_MODE == STREAM_ON
+        StreamInit();       // Empty the stream ring
+    #endif
 
         // Enable global interrupts and higher priority real-time debug events
+    #if ADC_CAPTURE_MODE == ADC_CAPTURE_DMA
+        IER |= M_INT7;          // Enable group 7 interrupts (DMA)
+        PieCtrlRegs.PIEIER1.bit.INTx1 = 0;      // ADCINT1 only triggers the DMA
+        StartDmaCapture();                      // Arm DMA CH1-4, they wait for the first ADCAINT1
+    #elif ADC_CAPTURE_MODE == ADC_CAPTURE_CLA
+        IER |= M_INT1;          // Enable group 1 interrupts (IPC, SCI use other groups)
+        PieCtrlRegs.PIEIER1.bit.INTx1 = 0;      // ADCINT1 only starts the CLA task
+    #else
         IER |= M_INT1;          // Enable group 1 interrupts
+    #endif
+    #if DAC_SOURCE == DAC_SOURCE_PLAYBACK
+        IER |= M_INT7;          // Enable group 7 interrupts (DMA CH6 once end, stream refills)
+    #endif
+    #if SDFM_MODE == SDFM_ON
+        IER |= M_INT5;          // Enable group 5 interrupts (SDFM1)
+        PieCtrlRegs.PIEIER5.bit.INTx9 = 1;      // SD1_INT, comparator trips
+    #endif
+    #if CMPSS_MODE == CMPSS_ON
+        IER |= M_INT2;          // Enable group 2 interrupts (ePWM trip zones)
+        PieCtrlRegs.PIEIER2.bit.INTx1 = 1;      // EPWM1_TZ_INT, one-shot trips
+    #endif
         EINT;                   // Enable Global interrupt INTM
         ERTM;                   // Enable Global real time interrupt DBGM
 
+    #if ADC_CAPTURE_MODE == ADC_CAPTURE_ISR
         PieCtrlRegs.PIEIER1.bit.INTx1 = 1;      // Enable PIE interrupt
+    #endif
+
+    #if CPU2_MODE == CPU2_ON
+    #if SCI_MODE == SCI_ON
+        SciInitPins();                          // LSPCLK and GPIO42/43 stay with CPU1
+        EALLOW;                                 // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+        DevCfgRegs.CPUSEL5.bit.SCI_A = 1;       // SCI-A belongs to CPU2
+        EDIS;                                   // Using EDIS to clear the EALLOW
+        IpcRegs.IPCSET.all = IPC_FLAG_SCI_GRANTED;  // CPU2 may open it
+    #endif
+        IpcLinkInit();                          // Wait for CPU2
+        StreamSink = IpcLinkSink;               // Send the stream to CPU2 in blocks
+    #elif SCI_MODE == SCI_ON
+        SciLoopbackTest(SCI_BAUD);              // Check the SCI-A queues, FIFOs and interrupts in loopback
+        SciOpen(SCI_BAUD, 0);                   // Open SCI-A to the host
+    #if STREAM_MODE == STREAM_ON
+        TelemetryInit();                        // First frame gets sequence number 0
+        StreamSink = TelemetrySink;             // Send the stream as telemetry frames
+    #endif
+    #endif
 
         // Sync ePWM
         EALLOW;                                 // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
@@ -120,16 +302,37 @@
         EPwm2Regs.ETSEL.bit.SOCAEN = 1;             // Enable SOCA
         EPwm2Regs.TBCTL.bit.CTRMODE = 0;            // Un-freeze and enter up-count mode
 
-        // Infinite loop to continuously grab values being inputed
+        // Background loop: drain the stream and blink the LED, never blocking for longer than one pass
         do {
-            GpioDataRegs.GPADAT.bit.GPIO31 = 0;     // Turn on LED
-            DELAY_US(1000 * 500);                   // ON delay
-            GpioDataRegs.GPADAT.bit.GPIO31 = 1;     // Turn off LED
-            DELAY_US(1000 * 500);                   // OFF delay
-
-            // Send Load Torque and Duty Cycle to Opal
-            DacaRegs.DACVALS.all = LoadTorque;      // Set the value of the DAC-A Registers to Load Torque
-            DacbRegs.DACVALS.all = DutyCycle;       // Set the value of the DAC-B Registers to Duty Cycle
+    #if ADC_CAPTURE_MODE == ADC_CAPTURE_CLA
+            ClaAcquireDrain();                      // Trigger, capture and stream the samples the CLA left
+    #endif
+    #if STREAM_MODE == STREAM_ON
+            StreamDrain();                          // Ship the samples acquired since the last pass
+    #endif
+    #if PWM_OUTPUT_MODE == PWM_OUTPUT_HRPWM
+            PwmOutputCalibrate();                   // Follow the MEP step size through temperature and voltage drift
+    #endif
+    #if ECAP_MODE == ECAP_ON
+            EcapMeasureService();                   // Publish the newest PWM cycle each eCAP captured
+    #endif
+            DELAY_US(MAIN_LOOP_PERIOD_US);          // Pace the loop
+
+            if (++loopCount >= LED_HALF_PERIOD_PASSES)
+            {
+                loopCount = 0;                      // Reset the LED timer
+                ledOff ^= 1;                        // 0.5 s on, 0.5 s off
+                GpioDataRegs.GPADAT.bit.GPIO31 = ledOff;    // Drive the LED
+
+    #if (DAC_UPDATE_MODE == DAC_UPDATE_MAINLOOP) && (DAC_SOURCE == DAC_SOURCE_ADC)
+                if (ledOff == 0)
+                {
+                    // Send Load Torque and Duty Cycle to Opal once per blink
+                    DacaRegs.DACVALS.all = LoadTorque;      // Set the value of the DAC-A Registers to Load Torque
+                    DacbRegs.DACVALS.all = DutyCycle;       // Set the value of the DAC-B Registers to Duty Cycle
+                }
+    #endif
+            }
             //_TI_stop_pprof_collection();            // Add a call to _TI_stop_pprof_collection at the point in which you wish to transfer the coverage data
         } while(1);
     }
@@ -139,11 +342,19 @@
     {
         EALLOW;                                     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
         DacaRegs.DACCTL.bit.DACREFSEL = 1;          // Use ADC references (HSEC Pin 09)
-        DacaRegs.DACCTL.bit.LOADMODE = 0;           // Load on next SYSCLK
+        DacaRegs.DACCTL.bit.SYNCSEL = DAC_SYNC_EPWM - 1;    // PWMSYNC source for DAC_LOAD_PWMSYNC
+        DacaRegs.DACCTL.bit.LOADMODE = DAC_LOAD_MODE;   // Load on next SYSCLK or on next PWMSYNC
         DacaRegs.DACOUTEN.bit.DACOUTEN = 1;         // Enable DAC
         DacbRegs.DACCTL.bit.DACREFSEL = 1;          // Use ADC references (HSEC Pin 11)
-        DacbRegs.DACCTL.bit.LOADMODE = 0;           // Load on next SYSCLK
+        DacbRegs.DACCTL.bit.SYNCSEL = DAC_SYNC_EPWM - 1;    // PWMSYNC source for DAC_LOAD_PWMSYNC
+        DacbRegs.DACCTL.bit.LOADMODE = DAC_LOAD_MODE;   // Load on next SYSCLK or on next PWMSYNC
         DacbRegs.DACOUTEN.bit.DACOUTEN = 1;         // Enable DAC
+    #if DAC_SOURCE == DAC_SOURCE_DDS
+        DaccRegs.DACCTL.bit.DACREFSEL = 1;          // Use ADC references (third stimulus output)
+        DaccRegs.DACCTL.bit.SYNCSEL = DAC_SYNC_EPWM - 1;    // PWMSYNC source for DAC_LOAD_PWMSYNC
+        DaccRegs.DACCTL.bit.LOADMODE = DAC_LOAD_MODE;   // Load on next SYSCLK or on next PWMSYNC
+        DaccRegs.DACOUTEN.bit.DACOUTEN = 1;         // Enable DAC
+    #endif
         EDIS;                                       // Using EDIS to clear the EALLOW
     }
 
@@ -197,8 +408,12 @@
         AdcaRegs.ADCINTSEL1N2.bit.INT1E = 1;        // Enable INT1 flag
         AdcaRegs.ADCINTFLGCLR.bit.ADCINT1 = 1;      // Make sure INT1 flag is cleared
 
-        // Setup ADC-C3
+        // Setup ADC-C3 (C2 with CMPSS_ON, the pin CMPSS6 compares)
+    #if CMPSS_MODE == CMPSS_ON
+        AdccRegs.ADCSOC0CTL.bit.CHSEL = 2;          // SOC0 will convert pin C2 (CMPIN6P)
+    #else
         AdccRegs.ADCSOC0CTL.bit.CHSEL = 3;          // SOC0 will convert pin C3 (HSEC Pin 33)
+    #endif
         AdccRegs.ADCSOC0CTL.bit.ACQPS = 14;         // Sample window is 100 SYSCLK cycles
         AdccRegs.ADCSOC0CTL.bit.TRIGSEL = 7;        // Trigger on ePWM2 SOCA/C
 
@@ -248,11 +463,12 @@
         // Assumes ePWM clock is already enabled
         EPwm2Regs.TBCTL.bit.CTRMODE = 3;            // Freeze counter
         EPwm2Regs.TBCTL.bit.HSPCLKDIV = 0;          // TBCLK pre-scaler = /1
-        EPwm2Regs.TBPRD = 0x07D0;                   // Set period to 2000 counts (50kHz)
+        EPwm2Regs.TBPRD = ADC_SAMPLE_PERIOD;        // Set period to 2000 counts (50kHz) by default
         EPwm2Regs.ETSEL.bit.SOCAEN  = 0;            // Disable SOC on A group
         EPwm2Regs.ETSEL.bit.SOCASEL = 2;            // Select SOCA on period match
         EPwm2Regs.ETSEL.bit.SOCAEN = 1;             // Enable SOCA
         EPwm2Regs.ETPS.bit.SOCAPRD = 1;             // Generate pulse on 1st event
+        EPwm2Regs.HRPCTL.bit.PWMSYNCSEL = 0;        // PWMSYNC on period match, for DAC_LOAD_PWMSYNC
         EDIS;                                       // Using EDIS to clear the EALLOW
     }
 
@@ -282,50 +498,298 @@
        EPwm5Regs.AQCTLA.bit.CAU = 1;                // Clear PWM1A on event A, up count
     }
 
+    // Close the timing of one adca1_isr stage begun at ePWM2 TBCTR = start: SYSCLK cycles and the worst case
+    static inline void StageProfile(volatile Uint16 *cycles, volatile Uint16 *cyclesMax, Uint16 start)
+    {
+        Uint16 elapsed = (EPwm2Regs.TBCTR - start) << 1;   // TBCLK = SYSCLK/2, so each ePWM2 tick is two CPU cycles
+
+        *cycles = elapsed;
+        if (elapsed > *cyclesMax)
+        {
+            *cyclesMax = elapsed;                   // Track the worst case
+        }
+    }
+
     // Interrupt Service Routine for ADC conversion. Triggered from EPWM2 period match using SOCA every 20us.
     interrupt void adca1_isr(void)
     {
+        Uint32 profileEntry = ProfileStamp();       // CPU Timer 1 at ISR entry
+        Uint16 profileSoc = EPwm2Regs.TBCTR;        // TBCLK ticks since SOCA at ISR entry
+        Uint16 sample[TRIG_NUM_ADC];                // Raw ADC-A..D results of this sample
+        Uint16 capture;                             // Trigger engine verdict, TRIG_SAMPLE_*
+    #if DAC_SOURCE == DAC_SOURCE_MODEL
+        Uint16 motorStart;                          // Start of the model step in TBCLK ticks
+        Uint16 speedDac;                            // Model speed in ADC-A scaling
+        Uint16 currentDac;                          // Model current in ADC-C scaling
+    #elif DAC_SOURCE == DAC_SOURCE_DDS
+        Uint16 ddsStart;                            // Start of the generators in TBCLK ticks
+        Uint16 stimulus[DDS_DACS];                  // DAC-A..C codes of this sample
+    #endif
+    #if SPEED_INPUT == SPEED_INPUT_QEP
+        Uint16 qepStart;                            // Start of the encoder stage in TBCLK ticks
+    #endif
+    #if FILTER_MODE == FILTER_ON
+        Uint16 filtered[TRIG_NUM_ADC];              // Conditioned ADC-A..D results, for the DACs and the capture
+        Uint16 filterStart = EPwm2Regs.TBCTR;       // Start of the filter stage in TBCLK ticks
+
+        // Condition all four channels before anything is forwarded
+        sample[TRIG_SRC_ADCA] = AdcaResultRegs.ADCRESULT0;     // mmSpeed
+        sample[TRIG_SRC_ADCB] = AdcbResultRegs.ADCRESULT0;     // DutyCycle
+    #if SDFM_MODE == SDFM_ON
+        sample[TRIG_SRC_ADCC] = SdfmCurrentCode((int16)Sdfm1Regs.SDDATA1.bit.DATA16);  // maCurrent, newest data filter result
+    #else
+        sample[TRIG_SRC_ADCC] = AdccResultRegs.ADCRESULT0;     // maCurrent
+    #endif
+        sample[TRIG_SRC_ADCD] = AdcdResultRegs.ADCRESULT0;     // LoadTorque
+        FilterBankRun(sample, filtered);
+        StageProfile(&filterCycles, &filterCyclesMax, filterStart);
+    #else
+        Uint16 *filtered = sample;                  // No conditioning: the raw results go everywhere
+    #endif
+
+    #if DAC_UPDATE_MODE == DAC_UPDATE_SAMPLE
+        // Forward the outputs to Opal on every sample, independent of the capture trigger
+    #if FILTER_MODE == FILTER_ON
+        LoadTorque = filtered[TRIG_SRC_ADCD];       // Update LoadTorque with filtered ADC-D results
+        DutyCycle = filtered[TRIG_SRC_ADCB];        // Update DutyCycle with filtered ADC-B results
+    #else
+        LoadTorque = AdcdResultRegs.ADCRESULT0;     // Update LoadTorque with ADC-D results
+        DutyCycle = AdcbResultRegs.ADCRESULT0;      // Update DutyCycle with ADC-B results
+    #endif
+    #if DAC_SOURCE == DAC_SOURCE_MODEL
+        // Close the loop locally: duty cycle and load torque drive the motor model, its speed and current go out
+        motorStart = EPwm2Regs.TBCTR;
+        MotorStep(DutyCycle, LoadTorque);
+        MotorOutputs(&speedDac, &currentDac);
+        DacaRegs.DACVALS.all = speedDac;            // Set the value of the DAC-A Registers to the model speed
+        DacbRegs.DACVALS.all = currentDac;          // Set the value of the DAC-B Registers to the model current
+        StageProfile(&motorCycles, &motorCyclesMax, motorStart);
+    #elif DAC_SOURCE == DAC_SOURCE_DDS
+        // Stimulus for frequency-response tests: the generators replace the forwarded inputs
+        ddsStart = EPwm2Regs.TBCTR;
+        DdsRun(stimulus);
+        DacaRegs.DACVALS.all = stimulus[DDS_DAC_A]; // Set the value of the DAC-A Registers to the stimulus
+        DacbRegs.DACVALS.all = stimulus[DDS_DAC_B]; // Set the value of the DAC-B Registers to the stimulus
+        DaccRegs.DACVALS.all = stimulus[DDS_DAC_C]; // Set the value of the DAC-C Registers to the stimulus
+        StageProfile(&ddsCycles, &ddsCyclesMax, ddsStart);
+    #elif DAC_SOURCE == DAC_SOURCE_ADC
+        DacaRegs.DACVALS.all = LoadTorque;          // Set the value of the DAC-A Registers to Load Torque
+        DacbRegs.DACVALS.all = DutyCycle;           // Set the value of the DAC-B Registers to Duty Cycle
+    #endif
+
+    #if DAC_SOURCE != DAC_SOURCE_PLAYBACK
+        // Measure SOC-to-DAC latency: ePWM2 restarts from 0 right after the SOCA period match
+        dacLatency = EPwm2Regs.TBCTR;               // TBCLK ticks since SOCA
+        if (dacLatency > dacLatencyMax)
+        {
+            dacLatencyMax = dacLatency;             // Track the worst case
+        }
+    #endif
+    #endif
+
+    #if SPEED_INPUT == SPEED_INPUT_QEP
+        // Encoder position and speed of this sample, after the DACs so their latency does not grow
+        qepStart = EPwm2Regs.TBCTR;
+        QepEncoderSample();
+        StageProfile(&qepCycles, &qepCyclesMax, qepStart);
+    #endif
+
+        // Run the trigger engine on this sample
+    #if FILTER_MODE != FILTER_ON
+        sample[TRIG_SRC_ADCA] = AdcaResultRegs.ADCRESULT0;     // mmSpeed
+        sample[TRIG_SRC_ADCB] = AdcbResultRegs.ADCRESULT0;     // DutyCycle
+    #if SDFM_MODE == SDFM_ON
+        sample[TRIG_SRC_ADCC] = SdfmCurrentCode((int16)Sdfm1Regs.SDDATA1.bit.DATA16);  // maCurrent, newest data filter result
+    #else
+        sample[TRIG_SRC_ADCC] = AdccResultRegs.ADCRESULT0;     // maCurrent
+    #endif
+        sample[TRIG_SRC_ADCD] = AdcdResultRegs.ADCRESULT0;     // LoadTorque
+    #endif
+    #if PWM_OUTPUT_MODE != PWM_OUTPUT_FIXED
+        PwmOutputUpdate(filtered[TRIG_SRC_ADCB]);   // Duty command, taken by ePWM1/ePWM5 at their next CTR = 0
+    #endif
+        capture = TriggerSample(sample);
+    #if STREAM_MODE == STREAM_ON
+        StreamPush(sample);                         // Every sample goes to the stream, triggered or not
+    #endif
+
         // Read the ADC result and store in circular buffer
-        if (trigger != 0)
+        if (capture != TRIG_SAMPLE_SKIP)
         {
-            mmSpeed[resultsIndex] = 0.293 * (AdcaResultRegs.ADCRESULT0-2048);       // Store current value of ADC-A in array, scaled to {-600 to 600} [rad/s]
-            DutyCycle = AdcbResultRegs.ADCRESULT0;                                      // Update DutyCycle with ADC-B results
-            maCurrent[resultsIndex++] = 0.00122 * (AdccResultRegs.ADCRESULT0-2048);   // Store current value of ADC-C in array, scaled to {-2.5 to 2.5} [A]
-            LoadTorque = AdcdResultRegs.ADCRESULT0;                                     // Update LoadTorque with ADC-D results
-
-            if(RESULTS_BUFFER_SIZE <= resultsIndex)
-            /* Reset resultsIndex once ADC arrays are full
-             * Reset pre-trigger and ISR trigger to 0 once arrays are full
-             * Update PWM periods and duty cycles, but this may be unnecessary, as the values do not change (?)
-             */
+            Uint16 scaleStart = EPwm2Regs.TBCTR;    // Start of the scaling stage in TBCLK ticks
+    #if DAC_UPDATE_MODE == DAC_UPDATE_MAINLOOP
+            DutyCycle = filtered[TRIG_SRC_ADCB];                                        // Update DutyCycle with ADC-B results
+            LoadTorque = filtered[TRIG_SRC_ADCD];                                       // Update LoadTorque with ADC-D results
+    #endif
+    #if SPEED_INPUT == SPEED_INPUT_QEP
+            mmSpeed[resultsIndex] = QepStatus.speedScaled;                                                // Store the encoder speed of this sample in array [0.1 rad/s]
+    #else
+            mmSpeed[resultsIndex] = ScaleSample(&ScaleTable[SCALE_CH_SPEED], filtered[TRIG_SRC_ADCA]);    // Store current value of ADC-A in array, scaled to {-6000 to 6000} [0.1 rad/s]
+    #endif
+            maCurrent[resultsIndex] = ScaleSample(&ScaleTable[SCALE_CH_CURRENT], filtered[TRIG_SRC_ADCC]); // Store current value of ADC-C in array, scaled to {-2500 to 2500} [mA]
+            if (++resultsIndex >= RESULTS_BUFFER_SIZE)
             {
-                resultsIndex = 0;                         // Reset results index to 0
-                pretrig = 0;                              // Reset pretrig to 0
-                trigger = 0;                              // Reset ISR trigger to 0
-
-                // Update PWMs -- Shouldn't be necessary (?) try and remove these
-                EPwm1Regs.TBPRD = period1;                // Set the EPwm period
-                EPwm1Regs.CMPA.bit.CMPA = dutyCycle1;     // Set the EPwm duty cycle
-                EPwm5Regs.TBPRD = period1;                // Set the EPwm period
-                EPwm5Regs.CMPA.bit.CMPA = dutyCycle5;     // Set the EPwn duty cycle
-                EPwm5Regs.TBPHS.bit.TBPHS = phaseOffset5; // Set the phase offset
+                resultsIndex = 0;                   // Wrap the circular history
             }
-        }
+            dutyCycleScaled = ScaleSample(&ScaleTable[SCALE_CH_DUTY], DutyCycle);                              // Scale DutyCycle to {0 to 10000} [0.01 %]
+            loadTorqueScaled = ScaleSample(&ScaleTable[SCALE_CH_TORQUE], LoadTorque);                          // Scale LoadTorque to {-2000 to 2000} [0.1 mNm]
 
-        /* This code identifies a low-to-high transition on PWM1A so the results buffer always starts
-         * on a rising edge.  This makes phase observations between PWM1 and PWM5 clearer.
-         */
+            StageProfile(&scaleCycles, &scaleCyclesMax, scaleStart);
 
-        else if (pretrig != 0)
-        {
-            trigger |= GpioDataRegs.GPADAT.bit.GPIO0;
+            if (capture == TRIG_SAMPLE_LAST)
+            {
+                EndCapture();                       // The buffer now holds a complete capture
+            }
         }
-        else pretrig = GpioDataRegs.GPADAT.bit.GPIO0 - 1;
 
         // Return from interrupt
         AdcaRegs.ADCINTFLGCLR.bit.ADCINT1 = 1;      // Clear ADC INT1 flag
         PieCtrlRegs.PIEACK.all = PIEACK_GROUP1;     // Acknowledge PIE group 1 to enable further interrupts
 
+        ProfileRecord(&IsrProfile[ISR_PROFILE_ADCA1], profileEntry, (Uint32)profileSoc * PROFILE_CYCLES_PER_TBCLK);
+    }
+
+    /* Called once a capture is complete; the trigger engine holds it until re-armed
+     * Update PWM periods and duty cycles, but this may be unnecessary, as the values do not change (?)
+     * With PWM_OUTPUT_DUTY/PWM_OUTPUT_HRPWM the PWMs belong to pwm_output.c and are left alone.
+     */
+    void EndCapture(void)
+    {
+    #if PWM_OUTPUT_MODE == PWM_OUTPUT_FIXED
+        // Update PWMs -- Shouldn't be necessary (?) try and remove these
+        EPwm1Regs.TBPRD = period1;                // Set the EPwm period
+        EPwm1Regs.CMPA.bit.CMPA = dutyCycle1;     // Set the EPwm duty cycle
+        EPwm5Regs.TBPRD = period1;                // Set the EPwm period
+        EPwm5Regs.CMPA.bit.CMPA = dutyCycle5;     // Set the EPwn duty cycle
+        EPwm5Regs.TBPHS.bit.TBPHS = phaseOffset5; // Set the phase offset
+    #endif
+    }
+
+    // Consume one DMA half-buffer (ADC_CAPTURE_DMA). Called from dmach4_isr once per DMA_CAPTURE_HALF_SIZE samples.
+    void ProcessCaptureBlock(Uint16 *block[DMA_CAPTURE_CHANNELS])
+    {
+        Uint16 i;                                   // Sample index within the block
+        Uint16 sample[TRIG_NUM_ADC];                // Raw ADC-A..D results of one sample
+        Uint16 capture;                             // Trigger engine verdict, TRIG_SAMPLE_*
+    #if FILTER_MODE == FILTER_ON
+        Uint16 filtered[TRIG_NUM_ADC];              // Conditioned ADC-A..D results of one sample
+    #else
+        Uint16 *filtered = sample;                  // No conditioning: the raw results go everywhere
+        Uint16 last = DMA_CAPTURE_HALF_SIZE - 1;    // Newest sample of the block
+
+        // Forward the newest completed sample to Opal
+        LoadTorque = block[DMA_CAPTURE_ADCD][last]; // Update LoadTorque with ADC-D results
+        DutyCycle = block[DMA_CAPTURE_ADCB][last];  // Update DutyCycle with ADC-B results
+    #endif
+    #if (DAC_UPDATE_MODE == DAC_UPDATE_SAMPLE) && (FILTER_MODE != FILTER_ON) && (DAC_SOURCE == DAC_SOURCE_ADC)
+        DacaRegs.DACVALS.all = LoadTorque;          // Set the value of the DAC-A Registers to Load Torque
+        DacbRegs.DACVALS.all = DutyCycle;           // Set the value of the DAC-B Registers to Duty Cycle
+
+        // The newest completed sample was converted one ePWM2 period before the current one
+        dacLatency = EPwm2Regs.TBCTR + ADC_SAMPLE_PERIOD + 1;
+        if (dacLatency > dacLatencyMax)
+        {
+            dacLatencyMax = dacLatency;             // Track the worst case
+        }
+    #endif
+
+        // Run the trigger engine at the full sample rate; a GPIO source is only sampled now, once per block
+        for (i = 0; i < DMA_CAPTURE_HALF_SIZE; i++)
+        {
+            sample[TRIG_SRC_ADCA] = block[DMA_CAPTURE_ADCA][i];
+            sample[TRIG_SRC_ADCB] = block[DMA_CAPTURE_ADCB][i];
+    #if SDFM_MODE == SDFM_ON
+            sample[TRIG_SRC_ADCC] = SdfmCurrentCode((int16)block[DMA_CAPTURE_ADCC][i]);   // Data filter result moved by CH3
+    #else
+            sample[TRIG_SRC_ADCC] = block[DMA_CAPTURE_ADCC][i];
+    #endif
+            sample[TRIG_SRC_ADCD] = block[DMA_CAPTURE_ADCD][i];
+    #if FILTER_MODE == FILTER_ON
+            FilterBankRun(sample, filtered);        // Every sample, so the filters see the full rate
+    #endif
+            capture = TriggerSample(sample);
+    #if STREAM_MODE == STREAM_ON
+            StreamPush(sample);                     // Every sample goes to the stream, triggered or not
+    #endif
+            if (capture == TRIG_SAMPLE_SKIP)
+            {
+                continue;
+            }
+
+            mmSpeed[resultsIndex] = ScaleSample(&ScaleTable[SCALE_CH_SPEED], filtered[TRIG_SRC_ADCA]);
+            maCurrent[resultsIndex] = ScaleSample(&ScaleTable[SCALE_CH_CURRENT], filtered[TRIG_SRC_ADCC]);
+            if (++resultsIndex >= RESULTS_BUFFER_SIZE)
+            {
+                resultsIndex = 0;                   // Wrap the circular history
+            }
+            if (capture == TRIG_SAMPLE_LAST)
+            {
+                EndCapture();                       // The buffer now holds a complete capture
+            }
+        }
+    #if FILTER_MODE == FILTER_ON
+        // Forward the newest filtered sample to Opal
+        LoadTorque = filtered[TRIG_SRC_ADCD];       // Update LoadTorque with filtered ADC-D results
+        DutyCycle = filtered[TRIG_SRC_ADCB];        // Update DutyCycle with filtered ADC-B results
+    #if (DAC_UPDATE_MODE == DAC_UPDATE_SAMPLE) && (DAC_SOURCE == DAC_SOURCE_ADC)
+        DacaRegs.DACVALS.all = LoadTorque;          // Set the value of the DAC-A Registers to Load Torque
+        DacbRegs.DACVALS.all = DutyCycle;           // Set the value of the DAC-B Registers to Duty Cycle
+
+        // The newest completed sample was converted one ePWM2 period before the current one
+        dacLatency = EPwm2Regs.TBCTR + ADC_SAMPLE_PERIOD + 1;
+        if (dacLatency > dacLatencyMax)
+        {
+            dacLatencyMax = dacLatency;             // Track the worst case
+        }
+    #endif
+    #endif
+    #if PWM_OUTPUT_MODE != PWM_OUTPUT_FIXED
+        PwmOutputUpdate(DutyCycle);                 // Newest duty command, once per block
+    #endif
+        dutyCycleScaled = ScaleSample(&ScaleTable[SCALE_CH_DUTY], DutyCycle);
+        loadTorqueScaled = ScaleSample(&ScaleTable[SCALE_CH_TORQUE], LoadTorque);
+    }
+
+    // Consume samples left in ClaRing[] by CLA task 1 (ADC_CAPTURE_CLA). Called from the background loop.
+    void ProcessClaBlock(const CLA_SAMPLE *samples, Uint16 count)
+    {
+        Uint16 i;                                   // Sample index within the span
+        Uint16 capture;                             // Trigger engine verdict, TRIG_SAMPLE_*
+
+        // The CLA has already written the DACs and scaled every channel
+        for (i = 0; i < count; i++)
+        {
+            capture = TriggerSample(samples[i].adc);   // adc[] is in TRIG_SRC_ADCx order
+    #if STREAM_MODE == STREAM_ON
+            StreamPush(samples[i].adc);             // Every sample goes to the stream, triggered or not
+    #endif
+            if (capture == TRIG_SAMPLE_SKIP)
+            {
+                continue;
+            }
+
+            mmSpeed[resultsIndex] = samples[i].speed;
+            maCurrent[resultsIndex] = samples[i].current;
+            if (++resultsIndex >= RESULTS_BUFFER_SIZE)
+            {
+                resultsIndex = 0;                   // Wrap the circular history
+            }
+            if (capture == TRIG_SAMPLE_LAST)
+            {
+                EndCapture();                       // The buffer now holds a complete capture
+            }
+        }
+
+        // Mirror the CLA's newest DAC values and latency into the shared state
+        LoadTorque = ClaStatus.loadTorque;
+        DutyCycle = ClaStatus.dutyCycle;
+        dutyCycleScaled = ClaStatus.scaled[SCALE_CH_DUTY];
+        loadTorqueScaled = ClaStatus.scaled[SCALE_CH_TORQUE];
+        dacLatency = ClaStatus.dacLatency;
+        dacLatencyMax = ClaStatus.dacLatencyMax;
+    #if PWM_OUTPUT_MODE != PWM_OUTPUT_FIXED
+        PwmOutputUpdate(DutyCycle);                 // Newest duty command, once per drain
+    #endif
     }
 
     // ----------------------------------------------------------------------------- //
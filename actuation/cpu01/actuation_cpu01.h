@@ -0,0 +1,208 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: actuation_cpu01.h
+/*
+// File Description:
+// Build configuration switches and acquisition state shared by actuation_cpu01.c and
+// the modules it uses. Every switch can be overridden from the project properties
+// (--define) or from the host build.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef ACTUATION_CPU01_H
+#define ACTUATION_CPU01_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+
+// Definitions for ADC sampling
+#ifndef ADC_SAMPLE_PERIOD
+#define ADC_SAMPLE_PERIOD 0x07D0        // ePWM2 period in 10 ns TBCLK counts: 2000 = 50 kHz
+#endif
+#define ADC_CAPTURE_ISR     0           // CPU copies the results in adca1_isr on every sample
+#define ADC_CAPTURE_DMA     1           // DMA copies the results, CPU interrupted once per half-buffer
+#define ADC_CAPTURE_CLA     2           // CLA task scales, filters and drives the DACs, CPU drains a ring (cla_acquire.h)
+#ifndef ADC_CAPTURE_MODE
+#define ADC_CAPTURE_MODE ADC_CAPTURE_ISR    // Select the ADC capture path
+#endif
+
+// Definitions for the DAC update path
+// With DAC_UPDATE_SAMPLE the bound from the ePWM2 SOCA to the DACVALS write at 200 MHz is ~110
+// SYSCLK (~0.55 us): S+H 15, conversion 42, ADCINT1 and ISR entry ~30, ISR prologue ~20, plus
+// 2 us of DAC settling. dacLatency/dacLatencyMax hold the measured ePWM2 TBCTR at the write.
+#define DAC_UPDATE_MAINLOOP 0           // DACs written once per main loop iteration (~1 s, legacy)
+#define DAC_UPDATE_SAMPLE   1           // DACs written from adca1_isr on every ADC sample (20 us)
+#ifndef DAC_UPDATE_MODE
+#define DAC_UPDATE_MODE DAC_UPDATE_SAMPLE   // Select the DAC update path
+#endif
+#if (ADC_CAPTURE_MODE == ADC_CAPTURE_CLA) && (DAC_UPDATE_MODE != DAC_UPDATE_SAMPLE)
+#error "ADC_CAPTURE_MODE = ADC_CAPTURE_CLA writes the DACs on every sample, it needs DAC_UPDATE_MODE = DAC_UPDATE_SAMPLE"
+#endif
+
+// Definitions for the DAC source (motor_model.h, dds.h, dac_playback.h)
+#define DAC_SOURCE_ADC      0           // DAC-A/DAC-B forward ADC-D (LoadTorque) / ADC-B (DutyCycle) to OPAL-RT
+#define DAC_SOURCE_MODEL    1           // DAC-A/DAC-B output speed / current of the on-board motor model
+#define DAC_SOURCE_DDS      2           // DAC-A/DAC-B/DAC-C output the DDS stimulus generators
+#define DAC_SOURCE_PLAYBACK 3           // DAC-A/DAC-B replay a profile from GS RAM through DMA CH5/CH6, paced by ePWM6
+#ifndef DAC_SOURCE
+#define DAC_SOURCE DAC_SOURCE_ADC       // Select what drives the DACs
+#endif
+#if ((DAC_SOURCE == DAC_SOURCE_MODEL) || (DAC_SOURCE == DAC_SOURCE_DDS)) && \
+    ((ADC_CAPTURE_MODE != ADC_CAPTURE_ISR) || (DAC_UPDATE_MODE != DAC_UPDATE_SAMPLE))
+#error "DAC_SOURCE_MODEL and DAC_SOURCE_DDS run in adca1_isr, they need ADC_CAPTURE_ISR and DAC_UPDATE_SAMPLE"
+#endif
+#if (DAC_SOURCE == DAC_SOURCE_PLAYBACK) && (ADC_CAPTURE_MODE == ADC_CAPTURE_CLA)
+#error "ADC_CAPTURE_MODE = ADC_CAPTURE_CLA writes the DACs from the CLA, it cannot be combined with DAC_SOURCE_PLAYBACK"
+#endif
+
+// Definitions for the DAC load timing
+#define DAC_LOAD_SYSCLK     0           // DACVALS reaches the output on the SYSCLK after the write
+#define DAC_LOAD_PWMSYNC    1           // DACVALS reaches the output on the next PWMSYNC of DAC_SYNC_EPWM (CTR = PRD)
+#ifndef DAC_LOAD_MODE
+#define DAC_LOAD_MODE DAC_LOAD_SYSCLK   // Select when the DACs take a new code
+#endif
+#if DAC_SOURCE == DAC_SOURCE_PLAYBACK
+#define DAC_SYNC_EPWM       6           // The playback timer: codes change one TBCLK before the next DMA trigger
+#else
+#define DAC_SYNC_EPWM       2           // The ADC trigger: codes change one sample after their SOCA
+#endif
+
+// Definitions for the input conditioning (filter_bank.h)
+#define FILTER_OFF          0           // DACs and capture buffers get the raw ADC results
+#define FILTER_ON           1           // Every channel runs through the biquad/FIR filter bank first
+#ifndef FILTER_MODE
+#define FILTER_MODE FILTER_OFF          // Select the input conditioning
+#endif
+
+// Definitions for the streaming path
+#define STREAM_OFF          0           // Samples only reach the capture buffers
+#define STREAM_ON           1           // Every sample is also pushed into the stream ring (stream.h)
+#ifndef STREAM_MODE
+#define STREAM_MODE STREAM_ON           // Select the streaming path
+#endif
+// Definitions for the SCI-A link (sci_driver.h)
+#define SCI_OFF             0           // SCI-A unused
+#define SCI_ON              1           // SCI-A opened at SCI_BAUD after a loopback self-test
+#ifndef SCI_MODE
+#define SCI_MODE SCI_ON                 // Select the SCI-A link
+#endif
+#ifndef SCI_BAUD
+#define SCI_BAUD 5000000UL              // SCI-A baud rate, exact for LSPCLK = 200 MHz (BRR = 4)
+#endif
+// Definitions for the dual-core split (ipc_link.h, ../cpu02)
+#define CPU2_OFF            0           // CPU1 runs everything, CPU2 is not used
+#define CPU2_ON             1           // CPU2 filters, computes statistics and owns SCI-A/telemetry
+#ifndef CPU2_MODE
+#define CPU2_MODE CPU2_OFF              // CPU2_ON needs the cpu02 image loaded and running
+#endif
+#if (CPU2_MODE == CPU2_ON) && (STREAM_MODE != STREAM_ON)
+#error "CPU2_MODE = CPU2_ON hands the stream to CPU2, it needs STREAM_MODE = STREAM_ON"
+#endif
+#define CPU2_LINK_MSGRAM    0           // Records copied into 32-record blocks in message RAM
+#define CPU2_LINK_GSRAM     1           // Records written into whole GS RAM blocks whose ownership (GSxMSEL) passes to CPU2
+#ifndef CPU2_LINK
+#define CPU2_LINK CPU2_LINK_MSGRAM      // Select the hand-off transport, identically in both projects
+#endif
+// Definitions for the SDRAM capture store (sdram_store.h)
+#define SDRAM_OFF           0           // No external memory
+#define SDRAM_ON            1           // Every DMA half-buffer is moved to SDRAM on EMIF1 CS0 by DMA CH5
+#ifndef SDRAM_MODE
+#define SDRAM_MODE SDRAM_OFF            // SDRAM_ON needs an SDRAM on EMIF1 (not fitted on the LaunchPad)
+#endif
+#if (SDRAM_MODE == SDRAM_ON) && (ADC_CAPTURE_MODE != ADC_CAPTURE_DMA)
+#error "SDRAM_MODE = SDRAM_ON stores the DMA half-buffers, it needs ADC_CAPTURE_MODE = ADC_CAPTURE_DMA"
+#endif
+#if (SDRAM_MODE == SDRAM_ON) && (DAC_SOURCE == DAC_SOURCE_PLAYBACK)
+#error "SDRAM_MODE = SDRAM_ON and DAC_SOURCE_PLAYBACK both need DMA CH5/CH6"
+#endif
+// Definitions for the switching stage (pwm_output.h)
+#define PWM_OUTPUT_FIXED    0           // ePWM1/ePWM5 run at a fixed 25 % duty (legacy)
+#define PWM_OUTPUT_DUTY     1           // ePWM1/ePWM5 follow the duty command at PWM_CARRIER_HZ, edges on whole TBCLKs
+#define PWM_OUTPUT_HRPWM    2           // As PWM_OUTPUT_DUTY, with HRPWM edges calibrated by the SFO library
+#ifndef PWM_OUTPUT_MODE
+#define PWM_OUTPUT_MODE PWM_OUTPUT_FIXED    // PWM_OUTPUT_HRPWM needs SFO_v8_fpu_lib_build_c28.lib linked
+#endif
+// Definitions for the PWM measurement (ecap_measure.h)
+#define ECAP_OFF            0           // PWM timing is only seen through the GPIO0 trigger source
+#define ECAP_ON             1           // eCAP1-3 measure period, duty and phase of PWM1A, PWM5A and ECAP_EXT_GPIO
+#ifndef ECAP_MODE
+#define ECAP_MODE ECAP_OFF              // Select the eCAP measurement
+#endif
+// Definitions for the speed input (qep_encoder.h)
+#define SPEED_INPUT_ADC     0           // Motor speed from the analog voltage on ADC-A2, 0.293 rad/s per count
+#define SPEED_INPUT_QEP     1           // Motor speed and multi-turn position from a quadrature encoder on eQEP1
+#ifndef SPEED_INPUT
+#define SPEED_INPUT SPEED_INPUT_ADC     // Select where mmSpeed comes from
+#endif
+#if (SPEED_INPUT == SPEED_INPUT_QEP) && (ADC_CAPTURE_MODE != ADC_CAPTURE_ISR)
+#error "SPEED_INPUT_QEP reads the encoder in adca1_isr on every sample, it needs ADC_CAPTURE_ISR"
+#endif
+// Definitions for the current input (sdfm_current.h)
+#define SDFM_OFF            0           // Armature current from the analog voltage on ADC-C3
+#define SDFM_ON             1           // Armature current from a sigma-delta modulator on SDFM1 filter 1, with over-current trip
+#ifndef SDFM_MODE
+#define SDFM_MODE SDFM_OFF              // SDFM_ON needs a modulator on SD1_D1/SD1_C1
+#endif
+#if (SDFM_MODE == SDFM_ON) && (ADC_CAPTURE_MODE == ADC_CAPTURE_CLA)
+#error "SDFM_MODE = SDFM_ON puts the data filter result in the ADC-C slot from adca1_isr or DMA CH3, it cannot be combined with ADC_CAPTURE_CLA"
+#endif
+// Definitions for the over-current trip (cmpss_trip.h)
+#define CMPSS_OFF           0           // ePWM1/ePWM5 are not tripped in hardware
+#define CMPSS_ON            1           // CMPSS6 trips ePWM1/ePWM5 through the ePWM X-BAR on an analog over-current
+#ifndef CMPSS_MODE
+#define CMPSS_MODE CMPSS_OFF            // CMPSS_ON needs the current on C2 (CMPIN6P) instead of C3
+#endif
+#if (CMPSS_MODE == CMPSS_ON) && (SDFM_MODE == SDFM_ON)
+#error "CMPSS_MODE = CMPSS_ON compares the analog current on ADC-C, SDFM_MODE = SDFM_ON trips on the modulator instead"
+#endif
+
+#define MAIN_LOOP_PERIOD_US 100         // Background loop pass; the stream ring holds 10 ms
+#define LED_HALF_PERIOD_PASSES 5000     // Loop passes per LED state: 0.5 s on, 0.5 s off
+
+// Buffers for storing ADC conversion results
+#define CAPTURE_DEPTH_STANDARD  256     // Samples per channel in .ebss (RAMLS5): 5 ms at 50 kHz
+#define CAPTURE_DEPTH_DEEP      20000   // Samples per channel in CaptureBufferSection (GS5-GS14): 400 ms at 50 kHz
+#define CAPTURE_DEEP_WORDS      0xA000  // Size of RAMGS_CAPTURE in 2837xD_RAM_lnk_cpu1.cmd
+#ifndef CAPTURE_DEEP
+#define CAPTURE_DEEP 0                  // 1 = place the capture buffers in dedicated GS RAM blocks
+#endif
+#ifndef RESULTS_BUFFER_SIZE
+#if CAPTURE_DEEP
+#define RESULTS_BUFFER_SIZE CAPTURE_DEPTH_DEEP      // Samples per channel in one capture
+#else
+#define RESULTS_BUFFER_SIZE CAPTURE_DEPTH_STANDARD  // Set the max buffer size of the results to 256 samples
+#endif
+#endif
+#if CAPTURE_DEEP && (CPU2_MODE == CPU2_ON) && (CPU2_LINK == CPU2_LINK_GSRAM)
+#error "CPU2_LINK = CPU2_LINK_GSRAM hands GS5-GS8 to CPU2, they are not free for CAPTURE_DEEP"
+#endif
+#if CAPTURE_DEEP && (2UL * RESULTS_BUFFER_SIZE > CAPTURE_DEEP_WORDS)
+#error "RESULTS_BUFFER_SIZE does not fit in RAMGS_CAPTURE"
+#endif
+#if !CAPTURE_DEEP && (RESULTS_BUFFER_SIZE > 512)
+#error "RESULTS_BUFFER_SIZE this large needs CAPTURE_DEEP = 1 (.ebss is the 2K-word RAMLS5)"
+#endif
+
+// Acquisition state defined in actuation_cpu01.c
+extern volatile Uint16 LoadTorque;      // Raw ADC-D result forwarded to DAC-A
+extern volatile Uint16 DutyCycle;       // Raw ADC-B result forwarded to DAC-B
+extern volatile Uint16 dacLatency;      // ePWM2 TBCLK ticks from SOCA to the last DAC write
+extern volatile Uint16 dacLatencyMax;   // Worst case dacLatency since reset
+extern int16 mmSpeed[RESULTS_BUFFER_SIZE];      // Captured motor speed [0.1 rad/s]
+extern int16 maCurrent[RESULTS_BUFFER_SIZE];    // Captured armature current [mA]
+extern Uint16 resultsIndex;             // Next write position in the circular mmSpeed/maCurrent history
+extern volatile Uint16 motorCycles;     // SYSCLK cycles of the last motor model step (DAC_SOURCE_MODEL)
+extern volatile Uint16 motorCyclesMax;  // Worst case motorCycles since reset
+extern volatile Uint16 ddsCycles;       // SYSCLK cycles of the last DDS sample (DAC_SOURCE_DDS)
+extern volatile Uint16 ddsCyclesMax;    // Worst case ddsCycles since reset
+extern volatile Uint16 qepCycles;       // SYSCLK cycles of the last encoder sample (SPEED_INPUT_QEP)
+extern volatile Uint16 qepCyclesMax;    // Worst case qepCycles since reset
+
+// Function Prototypes
+interrupt void adca1_isr(void);         // ADC interrupt service routine
+
+#endif  // end of ACTUATION_CPU01_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
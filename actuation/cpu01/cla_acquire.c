@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: cla_acquire.c
+/*
+// File Description:
+// C28x side of the CLA acquisition path: memory, task and trigger setup, and the
+// background drain of ClaRing[]. See cla_acquire.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "cla_acquire.h"
+
+// Parameters the CLA reads, in the CPU-to-CLA message RAM
+#pragma DATA_SECTION(ClaParams, "CpuToCla1MsgRAM")
+CLA_PARAMS ClaParams;
+
+// Everything the CLA writes, in LS1 (CLA data RAM)
+#pragma DATA_SECTION(ClaStatus, "Cla1DataSection")
+#pragma DATA_SECTION(ClaRing, "Cla1DataSection")
+#pragma DATA_SECTION(claFilter, "Cla1DataSection")
+volatile CLA_STATUS ClaStatus;
+CLA_SAMPLE ClaRing[CLA_RING_SIZE];
+float32 claFilter[SCALE_NUM_CHANNELS];  // Low-pass state of Cla1Task1()
+
+// Give LS0 (program) and LS1 (data) to the CLA, clear the ring and attach task 1 to ADCAINT1.
+// Call before the ADC is triggered; ADCINT1 has to be in continuous mode.
+void ClaAcquireInit(void)
+{
+    Uint16 ch;
+    Uint16 i;
+
+    EALLOW;     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    MemCfgRegs.LSxMSEL.bit.MSEL_LS0 = 1;        // LS0 shared between the CPU and the CLA
+    MemCfgRegs.LSxCLAPGM.bit.CLAPGM_LS0 = 1;    // LS0 is CLA program memory
+    MemCfgRegs.LSxMSEL.bit.MSEL_LS1 = 1;        // LS1 shared between the CPU and the CLA
+    MemCfgRegs.LSxCLAPGM.bit.CLAPGM_LS1 = 0;    // LS1 is CLA data memory
+    EDIS;       // Using EDIS to clear the EALLOW
+
+    // Nothing runs on the CLA yet, so the C28x may write its data
+    ClaStatus.samples = 0;
+    ClaStatus.overflows = 0;
+    ClaStatus.head = 0;
+    ClaStatus.dacLatency = 0;
+    ClaStatus.dacLatencyMax = 0;
+    ClaStatus.taskTicks = 0;
+    ClaStatus.taskTicksMax = 0;
+    ClaStatus.loadTorque = 0;
+    ClaStatus.dutyCycle = 0;
+    for (ch = 0; ch < SCALE_NUM_CHANNELS; ch++)
+    {
+        ClaStatus.scaled[ch] = 0;
+        ClaStatus.filtered[ch] = 0.0f;
+        claFilter[ch] = 0.0f;
+    }
+    for (i = 0; i < CLA_RING_SIZE; i++)
+    {
+        for (ch = 0; ch < CLA_CHANNELS; ch++)
+        {
+            ClaRing[i].adc[ch] = 0;
+        }
+        ClaRing[i].speed = 0;
+        ClaRing[i].current = 0;
+    }
+    ClaParams.tail = 0;
+    ClaAcquireRetune();
+
+    EALLOW;
+    Cla1Regs.MVECT1 = (Uint16)((Uint32)&Cla1Task1);    // Task 1 entry, CLA program address
+    DmaClaSrcSelRegs.CLA1TASKSRCSEL1.bit.TASK1 = CLA_TRIG_ADCAINT1;  // Started by ADCAINT1
+    Cla1Regs.MIER.bit.INT1 = 1;                 // Enable task 1
+    EDIS;
+}
+
+// Copy ScaleTable and the filter coefficient to the message RAM. A sample in progress may
+// use a mix of the old and the new values.
+void ClaAcquireRetune(void)
+{
+    Uint16 ch;
+
+    for (ch = 0; ch < SCALE_NUM_CHANNELS; ch++)
+    {
+        ClaParams.scale[ch] = ScaleTable[ch];
+    }
+    ClaParams.alpha = CLA_FILTER_ALPHA;
+}
+
+// Pass the samples written since the last call to ProcessClaBlock(), in at most two
+// contiguous spans, and return them to the CLA
+Uint16 ClaAcquireDrain(void)
+{
+    Uint16 head = ClaStatus.head;       // Samples up to head are complete
+    Uint16 tail = ClaParams.tail;
+    Uint16 count = head - tail;
+    Uint16 start = tail & CLA_RING_MASK;
+    Uint16 span;
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    span = CLA_RING_SIZE - start;       // Up to the end of the ring
+    if (span > count)
+    {
+        span = count;
+    }
+    ProcessClaBlock(&ClaRing[start], span);
+    if (span < count)
+    {
+        ProcessClaBlock(&ClaRing[0], count - span);
+    }
+
+    ClaParams.tail = head;              // Release the slots to the CLA
+    return count;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
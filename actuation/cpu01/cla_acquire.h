@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: cla_acquire.h
+/*
+// File Description:
+// Acquisition on the Control Law Accelerator (ADC_CAPTURE_MODE = ADC_CAPTURE_CLA).
+// Shared by the C28x (cla_acquire.c) and the CLA (cla_acquire.cla).
+//
+// CLA task 1 is started directly by ADCAINT1 (CLA1TASKSRCSEL1.TASK1 = ADCAINT1), so the
+// C28x takes no interrupt per sample. On every ePWM2 SOCA the task
+//   - conditions the four results with the filter bank (FILTER_ON, filter_bank.h),
+//   - forwards ADC-D (LoadTorque) and ADC-B (DutyCycle) to DAC-A/DAC-B,
+//   - scales all four channels with the descriptors in ClaParams (scaling.h),
+//   - low-pass filters the scaled values, y += CLA_FILTER_ALPHA * (x - y),
+//   - appends the raw results and the scaled speed/current to ClaRing[].
+// ADCINT1 runs in continuous mode (INT1CONT = 1) as for the DMA path, so nobody has to
+// clear the flag.
+//
+// The C28x drains the ring from the background loop (ClaAcquireDrain(), every
+// MAIN_LOOP_PERIOD_US) and runs only the trigger engine, the capture buffers and the
+// stream on the records. The ring holds CLA_RING_SIZE samples: 2.56 ms at 50 kHz,
+// 0.64 ms at 200 kHz, against a 100 us loop. ClaStatus.overflows counts samples the
+// CLA dropped because the C28x fell behind.
+//
+// Memory (2837xD_RAM_lnk_cpu1.cmd):
+//   RAMLS0           Cla1Prog, CLA program (LSxCLAPGM)
+//   RAMLS1           ClaRing[], ClaStatus, filter state, FilterBank, CLA scratchpad   (CLA writes)
+//   CLA1_MSGRAMHIGH  ClaParams: scale descriptors, filter, ring tail       (C28x writes)
+// LS1 stays readable and writable by the C28x; it clears it before the task is enabled.
+//
+// Project setup: add cla_acquire.cla to the cpu01 project (the CLA compiler picks it up
+// by extension) and define CLA_C for the linker command file.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef CLA_ACQUIRE_H
+#define CLA_ACQUIRE_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+#include "scaling.h"            // SCALE_CHANNEL, SCALE_CH_*
+
+// Definitions for the CLA acquisition
+#define CLA_RING_SIZE       128         // Samples, power of two: 2.56 ms at 50 kHz
+#define CLA_RING_MASK       (CLA_RING_SIZE - 1)
+#define CLA_CHANNELS        4           // ADC-A, ADC-B, ADC-C, ADC-D, in TRIG_SRC_ADCx order
+#define CLA_FILTER_ALPHA    0.0625f     // Low-pass coefficient: about 500 Hz at 50 kHz
+
+// One sample as left by the CLA
+typedef struct
+{
+    Uint16 adc[CLA_CHANNELS];           // Raw 12-bit SOC0 results of ADC-A..D
+    int16 speed;                        // ADC-A (filtered with FILTER_ON) scaled with ScaleTable[SCALE_CH_SPEED]
+    int16 current;                      // ADC-C (filtered with FILTER_ON) scaled with ScaleTable[SCALE_CH_CURRENT]
+} CLA_SAMPLE;
+
+// Written by the C28x, read by the CLA
+typedef struct
+{
+    SCALE_CHANNEL scale[SCALE_NUM_CHANNELS];    // Copy of ScaleTable, see ClaAcquireRetune()
+    float32 alpha;                              // Low-pass coefficient
+    Uint16 tail;                                // Samples taken from ClaRing[] by the C28x
+} CLA_PARAMS;
+
+// Written by the CLA, read by the C28x and the debugger
+typedef struct
+{
+    Uint32 samples;                     // Task 1 runs
+    Uint32 overflows;                   // Samples dropped because ClaRing[] was full
+    Uint16 head;                        // Samples written into ClaRing[]
+    Uint16 dacLatency;                  // ePWM2 TBCLK ticks from SOCA to the DAC write, last sample
+    Uint16 dacLatencyMax;               // Worst case dacLatency
+    Uint16 taskTicks;                   // ePWM2 TBCLK ticks from SOCA to the end of task 1, last sample
+    Uint16 taskTicksMax;                // Worst case taskTicks
+    Uint16 loadTorque;                  // Value written to DAC-A, last sample
+    Uint16 dutyCycle;                   // Value written to DAC-B, last sample
+    int16 scaled[SCALE_NUM_CHANNELS];   // Newest sample in engineering units, SCALE_CH_* order
+    float32 filtered[SCALE_NUM_CHANNELS];   // Low-pass of scaled[]
+} CLA_STATUS;
+
+extern CLA_PARAMS ClaParams;                        // CpuToCla1MsgRAM
+extern volatile CLA_STATUS ClaStatus;               // Cla1DataSection (LS1)
+extern CLA_SAMPLE ClaRing[CLA_RING_SIZE];           // Cla1DataSection (LS1)
+
+// CLA tasks (cla_acquire.cla)
+__interrupt void Cla1Task1(void);       // ADCAINT1: DAC, scaling, filter, ring
+
+#ifndef __TMS320C28XX_CLA__
+// Function Prototypes
+void ClaAcquireInit(void);              // Give LS0/LS1 to the CLA, clear the ring, attach task 1 to ADCAINT1
+void ClaAcquireRetune(void);            // Copy ScaleTable to the CLA after it was changed
+Uint16 ClaAcquireDrain(void);           // Background loop: pass new samples to ProcessClaBlock(), returns the number taken
+
+// Implemented by the application: consume count consecutive samples from the ring
+void ProcessClaBlock(const CLA_SAMPLE *samples, Uint16 count);
+#endif
+
+#endif  // end of CLA_ACQUIRE_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,152 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: cmpss_trip.c
+/*
+// File Description:
+// CMPSS6 over-current trip of ePWM1/ePWM5 through the ePWM X-BAR. See cmpss_trip.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "actuation_cpu01.h"    // Build configuration and shared acquisition state
+#include "cmpss_trip.h"
+#include "scaling.h"            // Per-channel ADC gain/offset descriptors
+
+#define CMPSS_CTRIP_FILTER  2           // CTRIPxSEL: digital filter output
+#define CMPSS_XBAR_OR       1           // TRIP4MUX0TO15CFG.MUX10: CMPSS6.CTRIPH_OR_CTRIPL
+#define CMPSS_DC_TRIPIN4    3           // DCTRIPSEL.DCAHCOMPSEL: TRIPIN4
+#define CMPSS_DC_HIGH       2           // TZDCSEL.DCAEVT1: DCAH high
+#define CMPSS_TZ_LOW        2           // TZCTL.TZA/TZB: force low
+#define CMPSS_TZ_NONE       3           // TZCTL.DCxEVTx: no action of its own
+#define CMPSS_STS_HLATCH    0x0002      // COMPSTS.COMPHLATCH, COMPSTSCLR.HLATCHCLR
+#define CMPSS_STS_LLATCH    0x0200      // COMPSTS.COMPLLATCH, COMPSTSCLR.LLATCHCLR
+#define CMPSS_TZ_INT        0x0001      // TZFLG/TZCLR: global interrupt flag
+#define CMPSS_TZ_OST        0x0004      // TZFLG/TZCLR: one-shot trip
+#define CMPSS_TZ_DCAEVT1    0x0008      // TZFLG/TZCLR: DCAEVT1
+#define CMPSS_TZ_OST_DCAEVT1 0x0040     // TZOSTFLG/TZOSTCLR: DCAEVT1 latch
+
+volatile CMPSS_STATUS CmpssStatus;
+
+// DAC code of a current through ScaleTable[SCALE_CH_CURRENT], clamped to 12 bits
+static Uint16 CmpssCode(float32 current)
+{
+    float32 code = (float32)ScaleTable[SCALE_CH_CURRENT].offset + current / ScaleTable[SCALE_CH_CURRENT].gain;
+
+    return (code <= 0.0f) ? 0 : (code >= (float32)CMPSS_CODE_MAX) ? CMPSS_CODE_MAX : (Uint16)(code + 0.5f);
+}
+
+// DCAEVT1 from TRIP4 as a one-shot trip forcing both outputs low
+static void CmpssTripZone(volatile struct EPWM_REGS *epwm)
+{
+    epwm->DCTRIPSEL.bit.DCAHCOMPSEL = CMPSS_DC_TRIPIN4;
+    epwm->TZDCSEL.bit.DCAEVT1 = CMPSS_DC_HIGH;
+    epwm->DCACTL.bit.EVT1SRCSEL = 0;                // DCAEVT1 unfiltered
+    epwm->DCACTL.bit.EVT1FRCSYNCSEL = 1;            // and asynchronous to TBCLK
+    epwm->TZSEL.bit.DCAEVT1 = 1;                    // One-shot source
+    epwm->TZCTL.bit.TZA = CMPSS_TZ_LOW;
+    epwm->TZCTL.bit.TZB = CMPSS_TZ_LOW;
+    epwm->TZCTL.bit.DCAEVT1 = CMPSS_TZ_NONE;        // The one-shot action above is the only one
+    epwm->TZCTL.bit.DCAEVT2 = CMPSS_TZ_NONE;
+    epwm->TZCTL.bit.DCBEVT1 = CMPSS_TZ_NONE;
+    epwm->TZCTL.bit.DCBEVT2 = CMPSS_TZ_NONE;
+    epwm->TZCLR.all = CMPSS_TZ_OST | CMPSS_TZ_DCAEVT1 | CMPSS_TZ_INT;
+    epwm->TZOSTCLR.all = CMPSS_TZ_OST_DCAEVT1;
+}
+
+// Thresholds at +-CMPSS_TRIP_MA, both comparators filtered into TRIP4, ePWM1/ePWM5 trip zones,
+// the one-shot interrupt on ePWM1
+void CmpssTripInit(void)
+{
+    CmpssStatus.highCode = CmpssCode(CMPSS_TRIP_MA);
+    CmpssStatus.lowCode = CmpssCode(-CMPSS_TRIP_MA);
+    CmpssStatus.fault = 0;
+    CmpssStatus.tripped = 0;
+    CmpssStatus.trips = 0;
+
+    EALLOW;                                     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    Cmpss6Regs.COMPCTL.all = 0x0000;            // Comparators off while configuring
+
+    // DACs: VDDA reference, the ADC-C range, loaded from the shadow registers on SYSCLK
+    Cmpss6Regs.COMPDACCTL.all = 0x0000;
+    Cmpss6Regs.COMPDACCTL.bit.SELREF = 0;
+    Cmpss6Regs.COMPDACCTL.bit.DACSOURCE = 0;
+    Cmpss6Regs.COMPDACCTL.bit.SWLOADSEL = 0;
+    Cmpss6Regs.DACHVALS.bit.DACVAL = CmpssStatus.highCode;
+    Cmpss6Regs.DACLVALS.bit.DACVAL = CmpssStatus.lowCode;
+    Cmpss6Regs.COMPHYSCTL.bit.COMPHYS = 1;      // Smallest hysteresis
+
+    // High comparator: CMPIN6P above DACH; low comparator inverted: CMPIN6P below DACL
+    Cmpss6Regs.COMPCTL.bit.COMPHSOURCE = 0;     // DAC on the negative input
+    Cmpss6Regs.COMPCTL.bit.COMPHINV = 0;
+    Cmpss6Regs.COMPCTL.bit.COMPLSOURCE = 0;
+    Cmpss6Regs.COMPCTL.bit.COMPLINV = 1;
+    Cmpss6Regs.COMPCTL.bit.CTRIPHSEL = CMPSS_CTRIP_FILTER;
+    Cmpss6Regs.COMPCTL.bit.CTRIPLSEL = CMPSS_CTRIP_FILTER;
+    Cmpss6Regs.COMPCTL.bit.CTRIPOUTHSEL = CMPSS_CTRIP_FILTER;
+    Cmpss6Regs.COMPCTL.bit.CTRIPOUTLSEL = CMPSS_CTRIP_FILTER;
+
+    // Digital filters: majority of CMPSS_FILTER_WINDOW samples
+    Cmpss6Regs.CTRIPHFILCLKCTL.bit.CLKPRESCALE = CMPSS_FILTER_PRESCALE;
+    Cmpss6Regs.CTRIPHFILCTL.bit.SAMPWIN = CMPSS_FILTER_WINDOW - 1;
+    Cmpss6Regs.CTRIPHFILCTL.bit.THRESH = CMPSS_FILTER_THRESH - 1;
+    Cmpss6Regs.CTRIPLFILCLKCTL.bit.CLKPRESCALE = CMPSS_FILTER_PRESCALE;
+    Cmpss6Regs.CTRIPLFILCTL.bit.SAMPWIN = CMPSS_FILTER_WINDOW - 1;
+    Cmpss6Regs.CTRIPLFILCTL.bit.THRESH = CMPSS_FILTER_THRESH - 1;
+    Cmpss6Regs.COMPCTL.bit.COMPDACE = 1;        // Comparators and DACs on
+    DELAY_US(1);                                // Comparator and DAC settling
+    Cmpss6Regs.CTRIPHFILCTL.bit.FILINIT = 1;    // Filters start from the comparator levels
+    Cmpss6Regs.CTRIPLFILCTL.bit.FILINIT = 1;
+    Cmpss6Regs.COMPSTSCLR.all = CMPSS_STS_HLATCH | CMPSS_STS_LLATCH;
+
+    // ePWM X-BAR: CTRIPH or CTRIPL of CMPSS6 on TRIP4
+    EPwmXbarRegs.TRIP4MUX0TO15CFG.bit.MUX10 = CMPSS_XBAR_OR;
+    EPwmXbarRegs.TRIPOUTINV.bit.TRIP4 = 0;
+    EPwmXbarRegs.TRIP4MUXENABLE.bit.MUX10 = 1;
+
+    // Trip zones: both outputs low until CmpssFaultClear(), the ePWM1 trip reported
+    CmpssTripZone(&EPwm1Regs);
+    CmpssTripZone(&EPwm5Regs);
+    EPwm1Regs.TZEINT.bit.OST = 1;
+    EDIS;                                       // Using EDIS to clear the EALLOW
+}
+
+void CmpssFaultClear(void)
+{
+    EALLOW;                                     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    Cmpss6Regs.COMPSTSCLR.all = CMPSS_STS_HLATCH | CMPSS_STS_LLATCH;
+    CmpssStatus.fault = 0;
+    CmpssStatus.tripped = 0;
+    EPwm5Regs.TZOSTCLR.all = CMPSS_TZ_OST_DCAEVT1;
+    EPwm5Regs.TZCLR.all = CMPSS_TZ_OST | CMPSS_TZ_DCAEVT1 | CMPSS_TZ_INT;
+    EPwm1Regs.TZOSTCLR.all = CMPSS_TZ_OST_DCAEVT1;
+    EPwm1Regs.TZCLR.all = CMPSS_TZ_OST | CMPSS_TZ_DCAEVT1 | CMPSS_TZ_INT;   // A current still past the limit trips again at once
+    EDIS;                                       // Using EDIS to clear the EALLOW
+}
+
+// One-shot trip: latch the direction and the ePWMs tripped, leave the trips set and acknowledge
+interrupt void epwm1_tz_isr(void)
+{
+    Uint16 latch = Cmpss6Regs.COMPSTS.all;
+
+    if ((latch & CMPSS_STS_HLATCH) != 0)
+    {
+        CmpssStatus.fault |= CMPSS_FAULT_HIGH;
+    }
+    if ((latch & CMPSS_STS_LLATCH) != 0)
+    {
+        CmpssStatus.fault |= CMPSS_FAULT_LOW;
+    }
+    CmpssStatus.tripped = ((EPwm1Regs.TZFLG.all & CMPSS_TZ_OST) != 0) ? CMPSS_TRIPPED_EPWM1 : 0;
+    CmpssStatus.tripped |= ((EPwm5Regs.TZFLG.all & CMPSS_TZ_OST) != 0) ? CMPSS_TRIPPED_EPWM5 : 0;
+    CmpssStatus.trips++;
+
+    EALLOW;                                     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    EPwm1Regs.TZCLR.all = CMPSS_TZ_INT;         // OST stays set: the outputs stay low until CmpssFaultClear()
+    EDIS;                                       // Using EDIS to clear the EALLOW
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP2;     // Acknowledge PIE group 2 to enable further interrupts
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,73 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: cmpss_trip.h
+/*
+// File Description:
+// Hardware over-current trip of the ePWM1/ePWM5 switching stage (CMPSS_MODE = CMPSS_ON): the
+// analog armature current is compared in CMPSS6 and shuts the outputs down through the ePWM
+// X-BAR and the trip zones, with no CPU cycles in the path.
+//
+// The current comes in on C2 (CMPIN6P), which ADC-C SOC0 converts in place of C3, so the
+// comparator and the ADC see the same pin. The internal 12-bit DACs of CMPSS6 (VDDA reference,
+// the range of the ADC) set CMPSS_TRIP_MA either side of zero current in ADC-C codes from
+// ScaleTable[SCALE_CH_CURRENT]: the high comparator trips above the high code, the inverted low
+// comparator below the low code. Both go through a digital filter that passes a level held for
+// CMPSS_FILTER_THRESH of CMPSS_FILTER_WINDOW SYSCLK samples, so a glitch shorter than that does
+// not trip, and OR into TRIP4 of the ePWM X-BAR (CTRIPH_OR_CTRIPL). On ePWM1 and ePWM5 TRIP4
+// is DCAH, DCAEVT1 (DCAH high, unfiltered, asynchronous) is a one-shot trip source and both
+// outputs are forced low: the pins go low well under a microsecond after the current crosses
+// the limit, whatever the CPU is doing.
+//
+// The one-shot trip holds the outputs low until CmpssFaultClear(). Its flag raises
+// epwm1_tz_isr (PIE 2.1) for reporting only: the ISR latches the direction from the comparator
+// latches in CmpssStatus.fault and the ePWMs tripped, and leaves the one-shot flags set, so a
+// persisting over-current interrupts the CPU only once. CmpssFaultClear() clears the latches and
+// the trips; a current still past the limit trips again at once.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef CMPSS_TRIP_H
+#define CMPSS_TRIP_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+
+// Definitions for the comparator
+#ifndef CMPSS_TRIP_MA
+#define CMPSS_TRIP_MA       2200.0f     // [mA] Over-current limit, either direction
+#endif
+#define CMPSS_CODE_MAX      4095        // Largest DAC code
+#define CMPSS_FILTER_PRESCALE 0         // CTRIPxFILCLKCTL.CLKPRESCALE: filter sample every SYSCLK (5 ns)
+#define CMPSS_FILTER_WINDOW 5           // Samples in the filter window
+#define CMPSS_FILTER_THRESH 3           // Samples of the window that must agree: a trip needs 15 ns past the limit
+
+// CmpssStatus.fault
+#define CMPSS_FAULT_HIGH    0x0001      // Over-current, positive (COMPSTS.COMPHLATCH)
+#define CMPSS_FAULT_LOW     0x0002      // Over-current, negative (COMPSTS.COMPLLATCH)
+
+// CmpssStatus.tripped
+#define CMPSS_TRIPPED_EPWM1 0x0001      // ePWM1 one-shot trip set (TZFLG.OST)
+#define CMPSS_TRIPPED_EPWM5 0x0002      // ePWM5 one-shot trip set
+
+// Comparator setup and trips, readable by the host
+typedef struct
+{
+    Uint16 highCode;                    // DACHVALS: ADC-C code of +CMPSS_TRIP_MA
+    Uint16 lowCode;                     // DACLVALS: ADC-C code of -CMPSS_TRIP_MA
+    Uint16 fault;                       // CMPSS_FAULT_* latched since the last CmpssFaultClear()
+    Uint16 tripped;                     // CMPSS_TRIPPED_* seen by the last epwm1_tz_isr
+    Uint32 trips;                       // epwm1_tz_isr calls
+} CMPSS_STATUS;
+
+extern volatile CMPSS_STATUS CmpssStatus;
+
+// Function Prototypes
+void CmpssTripInit(void);               // CMPSS6 thresholds and filters, X-BAR TRIP4, ePWM1/ePWM5 trip zones
+void CmpssFaultClear(void);             // Clear the latches and the one-shot trips, outputs back at the next period
+interrupt void epwm1_tz_isr(void);      // ePWM1 one-shot trip
+
+#endif  // end of CMPSS_TRIP_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
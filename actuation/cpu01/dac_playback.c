@@ -0,0 +1,237 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: dac_playback.c
+/*
+// File Description:
+// DMA playback of stimulus profiles on DAC-A/DAC-B. See dac_playback.h for the modes.
+// -----------------------------------------------------------------------------
+ */
+
+#include "dac_playback.h"
+
+// Frames, next to the capture ping-pong buffers in GS4 where the DMA has access
+#pragma DATA_SECTION(PlaybackBuffer, "PlaybackSection")
+Uint16 PlaybackBuffer[PLAYBACK_FRAMES][PLAYBACK_DACS];
+
+volatile PLAYBACK_STATUS PlaybackStatus;
+PLAYBACK_SOURCE PlaybackSource = PlaybackSilence;  // Replaced by the application before PLAYBACK_STREAM
+static Uint16 playHalf = 0;             // Half the DMA is reading during the current transfer
+static Uint16 playStarted = 0;          // Set once the first stream transfer has begun
+static Uint16 playBusy = 0;             // Set while a refill runs
+
+// Default source: every frame at mid-scale
+Uint16 PlaybackSilence(Uint16 (*frames)[PLAYBACK_DACS], Uint16 count)
+{
+    Uint16 i;
+
+    for (i = 0; i < count; i++)
+    {
+        frames[i][PLAYBACK_DAC_A] = PLAYBACK_DAC_MID;
+        frames[i][PLAYBACK_DAC_B] = PLAYBACK_DAC_MID;
+    }
+    return count;
+}
+
+// Point the shadow source of both channels at the given half
+static void SetPlaybackHalf(Uint16 half)
+{
+    Uint16 offset = half * PLAYBACK_HALF;
+
+    EALLOW;     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    DmaRegs.CH5.SRC_BEG_ADDR_SHADOW = (Uint32)&PlaybackBuffer[offset][PLAYBACK_DAC_A];
+    DmaRegs.CH5.SRC_ADDR_SHADOW = (Uint32)&PlaybackBuffer[offset][PLAYBACK_DAC_A];
+    DmaRegs.CH6.SRC_BEG_ADDR_SHADOW = (Uint32)&PlaybackBuffer[offset][PLAYBACK_DAC_B];
+    DmaRegs.CH6.SRC_ADDR_SHADOW = (Uint32)&PlaybackBuffer[offset][PLAYBACK_DAC_B];
+    EDIS;       // Using EDIS to clear the EALLOW
+}
+
+// Refill one half from PlaybackSource; frames it does not deliver repeat the frame before them
+static void PlaybackFill(Uint16 half)
+{
+    Uint16 offset = half * PLAYBACK_HALF;
+    Uint16 count = PlaybackSource(&PlaybackBuffer[offset], PLAYBACK_HALF);
+    Uint16 previous;
+    Uint16 i;
+
+    if (count < PLAYBACK_HALF)
+    {
+        PlaybackStatus.shortFills++;
+        for (i = offset + count; i < offset + PLAYBACK_HALF; i++)
+        {
+            previous = (i + PLAYBACK_FRAMES - 1) % PLAYBACK_FRAMES;
+            PlaybackBuffer[i][PLAYBACK_DAC_A] = PlaybackBuffer[previous][PLAYBACK_DAC_A];
+            PlaybackBuffer[i][PLAYBACK_DAC_B] = PlaybackBuffer[previous][PLAYBACK_DAC_B];
+        }
+    }
+    PlaybackStatus.refills++;
+}
+
+// ePWM6 frozen, buffer and DACs at mid-scale. DMAInitialize() must have run.
+void ConfigurePlayback(void)
+{
+    PlaybackSilence(PlaybackBuffer, PLAYBACK_FRAMES);
+    DacaRegs.DACVALS.all = PLAYBACK_DAC_MID;    // Set the value of the DAC-A Registers to mid-scale
+    DacbRegs.DACVALS.all = PLAYBACK_DAC_MID;    // Set the value of the DAC-B Registers to mid-scale
+
+    EALLOW;                                     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    EPwm6Regs.TBCTL.bit.CTRMODE = 3;            // Freeze counter
+    EPwm6Regs.TBCTL.bit.HSPCLKDIV = 0;          // TBCLK pre-scaler = /1, CLKDIV set per profile
+    EPwm6Regs.TBCTL.bit.PHSEN = 0;              // Disable phase loading
+    EPwm6Regs.ETSEL.bit.SOCAEN = 0;             // Disable SOC on A group
+    EPwm6Regs.ETSEL.bit.SOCASEL = 1;            // Select SOCA on counter zero, the DMA trigger
+    EPwm6Regs.ETPS.bit.SOCAPRD = 1;             // Generate pulse on 1st event
+    EPwm6Regs.HRPCTL.bit.PWMSYNCSEL = 0;        // PWMSYNC on CTR = PRD, for DAC_LOAD_PWMSYNC
+    CpuSysRegs.SECMSEL.bit.PF2SEL = 1;          // The DACs are on peripheral frame 2, whose secondary master is the CLA from reset
+    EDIS;                                       // Using EDIS to clear the EALLOW
+
+    PlaybackStatus.mode = PLAYBACK_OFF;
+    PlaybackStatus.completed = 0;
+    PlaybackStatus.refills = 0;
+    PlaybackStatus.shortFills = 0;
+    PlaybackStatus.overruns = 0;
+}
+
+// No more triggers, both channels back to idle; the DACs keep their last code
+void PlaybackStop(void)
+{
+    EALLOW;                                     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    EPwm6Regs.ETSEL.bit.SOCAEN = 0;             // Disable SOCA
+    EPwm6Regs.TBCTL.bit.CTRMODE = 3;            // Freeze counter
+    DmaRegs.CH5.CONTROL.bit.HALT = 1;
+    DmaRegs.CH6.CONTROL.bit.HALT = 1;
+    DmaRegs.CH5.CONTROL.bit.SOFTRESET = 1;      // Forget the transfer in progress
+    DmaRegs.CH6.CONTROL.bit.SOFTRESET = 1;
+    __asm(" nop");                              // One NOP required after SOFTRESET
+    EDIS;                                       // Using EDIS to clear the EALLOW
+    PlaybackStatus.mode = PLAYBACK_OFF;
+}
+
+// Start a profile at hz frames per second: PlaybackBuffer[0..frames-1] for PLAYBACK_ONCE and
+// PLAYBACK_LOOP, PlaybackSource for PLAYBACK_STREAM (frames is ignored). Stops the running
+// profile first. Returns 0, and leaves the playback stopped, if a setting is out of range.
+Uint16 PlaybackStart(Uint16 mode, Uint16 frames, float32 hz)
+{
+    float32 ticks;                              // TBCLK ticks per frame before CLKDIV
+    Uint16 clkdiv = 0;
+    Uint16 size;                                // Bursts per transfer
+    Uint16 cont;
+
+    PlaybackStop();
+    if ((mode < PLAYBACK_ONCE) || (mode > PLAYBACK_STREAM) || (hz < PLAYBACK_HZ_MIN) || (hz > PLAYBACK_HZ_MAX) ||
+        ((mode != PLAYBACK_STREAM) && ((frames == 0) || (frames > PLAYBACK_FRAMES))) ||
+        ((mode == PLAYBACK_STREAM) && (PlaybackSource == NULL)))
+    {
+        return 0;
+    }
+
+    // Smallest CLKDIV that brings the period within TBPRD
+    ticks = (float32)PLAYBACK_TBCLK_HZ / hz;
+    while (ticks > 65535.5f)
+    {
+        ticks *= 0.5f;
+        clkdiv++;
+    }
+    PlaybackStatus.clkdiv = clkdiv;
+    PlaybackStatus.period = (Uint16)(ticks + 0.5f);
+    PlaybackStatus.hz = (float32)PLAYBACK_TBCLK_HZ / ((float32)PlaybackStatus.period * (float32)(1U << clkdiv));
+
+    if (mode == PLAYBACK_STREAM)
+    {
+        // Start from the current outputs if the source cannot deliver, then fill both halves
+        PlaybackBuffer[PLAYBACK_FRAMES - 1][PLAYBACK_DAC_A] = DacaRegs.DACVALS.all;
+        PlaybackBuffer[PLAYBACK_FRAMES - 1][PLAYBACK_DAC_B] = DacbRegs.DACVALS.all;
+        PlaybackFill(0);
+        PlaybackFill(1);
+        playHalf = 0;                           // The first transfer plays half 0
+        playStarted = 0;
+        size = PLAYBACK_HALF;
+        cont = CONT_ENABLE;
+    }
+    else
+    {
+        size = frames;
+        cont = (mode == PLAYBACK_LOOP) ? CONT_ENABLE : CONT_DISABLE;
+    }
+    PlaybackStatus.frames = size;
+
+    // Channel 5 -- DAC-A: one word per ePWM6 SOCA burst, next frame at each burst
+    DMACH5AddrConfig(&DacaRegs.DACVALS.all, &PlaybackBuffer[0][PLAYBACK_DAC_A]);
+    DMACH5BurstConfig(0, 0, 0);                                 // 1 word per burst
+    DMACH5TransferConfig(size - 1, PLAYBACK_DACS, 0);           // Next frame, same destination
+    DMACH5WrapConfig(0xFFFF, 0, 0xFFFF, 0);                     // No wrap
+    DMACH5ModeConfig(DMA_EPWM6A, PERINT_ENABLE, ONESHOT_DISABLE, cont, SYNC_DISABLE, SYNC_SRC,
+                     OVRFLOW_DISABLE, SIXTEEN_BIT, CHINT_BEGIN, CHINT_DISABLE);
+
+    // Channel 6 -- DAC-B, the only channel that interrupts the CPU: at the end of a once pass,
+    // at the start of every stream transfer
+    DMACH6AddrConfig(&DacbRegs.DACVALS.all, &PlaybackBuffer[0][PLAYBACK_DAC_B]);
+    DMACH6BurstConfig(0, 0, 0);
+    DMACH6TransferConfig(size - 1, PLAYBACK_DACS, 0);
+    DMACH6WrapConfig(0xFFFF, 0, 0xFFFF, 0);
+    DMACH6ModeConfig(DMA_EPWM6A, PERINT_ENABLE, ONESHOT_DISABLE, cont, SYNC_DISABLE, SYNC_SRC,
+                     OVRFLOW_DISABLE, SIXTEEN_BIT, (mode == PLAYBACK_ONCE) ? CHINT_END : CHINT_BEGIN,
+                     (mode == PLAYBACK_LOOP) ? CHINT_DISABLE : CHINT_ENABLE);
+
+    StartDMACH5();
+    StartDMACH6();
+    PlaybackStatus.mode = mode;
+
+    // Start ePWM6: the first frame goes out at the end of its first period
+    EALLOW;                                     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    EPwm6Regs.TBCTL.bit.CLKDIV = clkdiv;        // TBCLK = 100 MHz / 2^clkdiv
+    EPwm6Regs.TBPRD = PlaybackStatus.period - 1;    // One frame per period
+    EPwm6Regs.TBCTR = 0x0000;                   // Clear counter
+    EPwm6Regs.ETSEL.bit.SOCAEN = 1;             // Enable SOCA
+    EPwm6Regs.TBCTL.bit.CTRMODE = 0;            // Un-freeze and enter up-count mode
+    EDIS;                                       // Using EDIS to clear the EALLOW
+    return 1;
+}
+
+// DMA CH6 interrupt at the end of a once pass, or at the start of every stream transfer. In a
+// stream, channel 5 has already started its transfer, so the shadows can be pointed at the
+// half the previous transfer has just played.
+interrupt void dmach6_isr(void)
+{
+    Uint16 nextHalf = playHalf ^ 1;         // Half the following transfer plays
+
+    if (PlaybackStatus.mode == PLAYBACK_ONCE)
+    {
+        // Both channels have written the last frame and stopped; the DACs hold it
+        EALLOW;                             // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+        EPwm6Regs.ETSEL.bit.SOCAEN = 0;     // No more triggers; the counter runs on, so DAC_LOAD_PWMSYNC still loads the last frame
+        EDIS;                               // Using EDIS to clear the EALLOW
+        PlaybackStatus.completed++;
+        PlaybackStatus.mode = PLAYBACK_OFF;
+        PieCtrlRegs.PIEACK.all = PIEACK_GROUP7; // Acknowledge PIE group 7 to enable further interrupts
+        return;
+    }
+
+    SetPlaybackHalf(nextHalf);
+    playHalf = nextHalf;
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP7; // Acknowledge PIE group 7 to enable further interrupts
+
+    if (playStarted == 0)
+    {
+        playStarted = 1;                    // First transfer: half 1 was filled by PlaybackStart()
+        return;
+    }
+
+    if (playBusy != 0)
+    {
+        PlaybackStatus.overruns++;          // Previous refill still running, this half is played again
+        return;
+    }
+
+    // Allow group 1 (and other enabled groups) to preempt the refill
+    playBusy = 1;
+    EINT;                                   // Enable Global interrupt INTM
+    PlaybackFill(nextHalf);                 // Played by the previous transfer, next in line
+    DINT;                                   // Disable Global interrupt INTM before returning
+    playBusy = 0;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
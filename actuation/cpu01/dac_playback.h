@@ -0,0 +1,95 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: dac_playback.h
+/*
+// File Description:
+// DMA playback of stimulus profiles on DAC-A/DAC-B (DAC_SOURCE = DAC_SOURCE_PLAYBACK).
+//
+// PlaybackBuffer[] in GS4 holds frames of two DAC codes, DAC-A then DAC-B. ePWM6 paces
+// the playback: its SOCA at CTR = 0 triggers DMA channels 5 and 6, which copy one word
+// each per frame into DacaRegs.DACVALS and DacbRegs.DACVALS. The CPU only runs when a
+// profile is started, at the end of a single pass and, in stream mode, once per
+// half-buffer, so the acquisition loop keeps the processor while the board replays
+// profiles of any length.
+//
+// Modes:
+//   PLAYBACK_ONCE    frames 0..frames-1 once, then the DACs hold the last frame. Channel 6
+//                    interrupts the CPU at the end of the transfer; the ISR stops the ePWM6
+//                    triggers, counts PlaybackStatus.completed and sets the mode to PLAYBACK_OFF
+//   PLAYBACK_LOOP    frames 0..frames-1 over and over; the channels run in continuous mode
+//                    and reload the start of the table at every transfer, without the CPU
+//   PLAYBACK_STREAM  ping-pong on the two halves of the buffer. As in dma_capture.h, only
+//                    channel 6, the last one serviced, interrupts the CPU, at the start of
+//                    each transfer; the ISR retargets the shadow registers at the half the
+//                    previous transfer has just played and refills it from PlaybackSource.
+//                    The source has a whole half-buffer period to deliver.
+//
+// ePWM6 runs from the 100 MHz TBCLK with the smallest CLKDIV that fits the period into
+// TBPRD, so any rate from PLAYBACK_HZ_MIN to PLAYBACK_HZ_MAX is met to within half a TBCLK
+// tick per frame; PlaybackStatus.hz holds the rate actually programmed. With DAC_LOAD_MODE =
+// DAC_LOAD_PWMSYNC the DACs take the new codes on ePWM6 PWMSYNC (CTR = PRD) rather than on
+// the DMA write, so the outputs change exactly one TBCLK before the next trigger regardless
+// of DMA arbitration.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef DAC_PLAYBACK_H
+#define DAC_PLAYBACK_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+
+// Definitions for the playback buffer
+#define PLAYBACK_FRAMES     1024        // Frames in PlaybackBuffer (2K words of GS4)
+#define PLAYBACK_HALF       (PLAYBACK_FRAMES / 2)   // Frames per refill in PLAYBACK_STREAM
+#define PLAYBACK_DACS       2           // Words per frame
+#define PLAYBACK_DAC_A      0           // Column of PlaybackBuffer written to DAC-A
+#define PLAYBACK_DAC_B      1           // Column of PlaybackBuffer written to DAC-B
+#define PLAYBACK_DAC_MID    2048        // Output when stopped or when the source runs dry
+#define PLAYBACK_DAC_MAX    4095        // 12-bit DAC full scale
+
+// Definitions for the pacing timer
+#define PLAYBACK_EPWM       6           // ePWM module whose SOCA triggers DMA CH5/CH6
+#define PLAYBACK_TBCLK_HZ   100000000UL // ePWM6 TBCLK before CLKDIV (EPWMCLK, HSPCLKDIV = /1)
+#define PLAYBACK_HZ_MAX     500000.0f   // DAC output settling (2 us) limits the frame rate
+#define PLAYBACK_HZ_MIN     12.0f       // TBPRD = 65535 at CLKDIV = /128
+
+// PlaybackStart() modes, PlaybackStatus.mode
+#define PLAYBACK_OFF        0           // Stopped, DACs hold their last code
+#define PLAYBACK_ONCE       1
+#define PLAYBACK_LOOP       2
+#define PLAYBACK_STREAM     3
+
+// Producer of stream frames: fill up to count frames, return how many were written
+typedef Uint16 (*PLAYBACK_SOURCE)(Uint16 (*frames)[PLAYBACK_DACS], Uint16 count);
+
+// State and counters, readable by the host
+typedef struct
+{
+    Uint16 mode;                        // PLAYBACK_*, back to PLAYBACK_OFF when a PLAYBACK_ONCE pass ends
+    Uint16 frames;                      // Frames per pass (PLAYBACK_ONCE, PLAYBACK_LOOP)
+    Uint16 clkdiv;                      // ePWM6 TBCTL.CLKDIV
+    Uint16 period;                      // ePWM6 TBCLK ticks per frame
+    float32 hz;                         // Frame rate actually programmed
+    Uint32 completed;                   // PLAYBACK_ONCE passes played to the end
+    Uint32 refills;                     // Halves refilled from PlaybackSource (PLAYBACK_STREAM)
+    Uint32 shortFills;                  // Refills the source left incomplete; its last frame was repeated
+    Uint32 overruns;                    // Transfers that started while the previous refill was still running
+} PLAYBACK_STATUS;
+
+extern Uint16 PlaybackBuffer[PLAYBACK_FRAMES][PLAYBACK_DACS];  // Frames in DAC codes, PlaybackSection
+extern volatile PLAYBACK_STATUS PlaybackStatus;
+extern PLAYBACK_SOURCE PlaybackSource;      // Where the stream refills come from
+
+// Function Prototypes
+void ConfigurePlayback(void);               // ePWM6 frozen, DMA CH5/CH6 idle, DACs and buffer at mid-scale
+Uint16 PlaybackStart(Uint16 mode, Uint16 frames, float32 hz);   // Start a profile, 0 if the settings are invalid
+void PlaybackStop(void);                    // Stop the pacing timer and reset both channels
+Uint16 PlaybackSilence(Uint16 (*frames)[PLAYBACK_DACS], Uint16 count);  // Default source: mid-scale frames
+interrupt void dmach6_isr(void);            // DMA CH6 interrupt: end of a PLAYBACK_ONCE pass, start of a stream transfer
+
+#endif  // end of DAC_PLAYBACK_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: dds.c
+/*
+// File Description:
+// Settings of the DDS stimulus generators. See dds.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include <math.h>
+#include "dds.h"
+
+DDS_TONE_CONFIG DdsConfig[DDS_TONES];
+DDS_GENERATOR Dds;
+
+// All generators off and the DACs at mid-scale. Call before the ADC is triggered.
+void DdsInit(float32 sampleHz)
+{
+    Uint16 t;
+
+    for (t = 0; t < DDS_TONES; t++)
+    {
+        DdsConfig[t].dac = DDS_DAC_OFF;
+        DdsConfig[t].sweep = DDS_SWEEP_OFF;
+        DdsConfig[t].end = DDS_END_HOLD;
+        DdsConfig[t].amplitude = 0.0f;
+        DdsConfig[t].start = 0.0f;
+        DdsConfig[t].stop = 0.0f;
+        DdsConfig[t].seconds = 0.0f;
+        Dds.tone[t].dac = DDS_DAC_OFF;
+        Dds.tone[t].sweep = DDS_SWEEP_OFF;
+        Dds.tone[t].phase = 0;
+        Dds.tone[t].step = 0;
+        Dds.tone[t].loadRequest = 0;
+    }
+    Dds.turnsPerHz = 1.0f / sampleHz;
+    Dds.loads = 0;
+    Dds.sweeps = 0;
+    Dds.clips = 0;
+}
+
+// Convert DdsConfig[t] for DdsRun(); it is taken at the next sample. Returns 0, and leaves the
+// running generator alone, if the previous settings have not been taken yet or a setting is
+// out of range: frequencies must lie in 0..fs/2 (above 0 for a log chirp) and a chirp needs
+// a duration of at least one sample.
+Uint16 DdsLoad(Uint16 t)
+{
+    const DDS_TONE_CONFIG *c;
+    DDS_TONE *g;
+    float32 samples;
+    float32 x;
+
+    if ((t >= DDS_TONES) || (Dds.tone[t].loadRequest != 0))
+    {
+        return 0;
+    }
+    c = &DdsConfig[t];
+    g = &Dds.next[t];
+    if ((c->dac > DDS_DAC_OFF) || (c->sweep > DDS_SWEEP_LOG) || (c->end > DDS_END_STOP) ||
+        (c->amplitude < 0.0f) || (c->amplitude > (float32)DDS_AMPLITUDE_MAX))
+    {
+        return 0;
+    }
+
+    g->first = c->start * Dds.turnsPerHz;
+    g->last = (c->sweep == DDS_SWEEP_OFF) ? g->first : c->stop * Dds.turnsPerHz;
+    samples = c->seconds / Dds.turnsPerHz;
+    if ((g->first < 0.0f) || (g->first > 0.5f) || (g->last < 0.0f) || (g->last > 0.5f) ||
+        ((c->sweep != DDS_SWEEP_OFF) && (samples < 1.0f)) ||
+        ((c->sweep == DDS_SWEEP_LOG) && ((g->first == 0.0f) || (g->last == 0.0f))))
+    {
+        return 0;
+    }
+
+    if (c->sweep == DDS_SWEEP_LINEAR)
+    {
+        g->rate = (g->last - g->first) / samples;
+    }
+    else if (c->sweep == DDS_SWEEP_LOG)
+    {
+        // exp(x) - 1 without the cancellation that expf(x) - 1.0f suffers for small x
+        x = logf(g->last / g->first) / samples;
+        g->rate = (fabsf(x) < 0.01f) ? x * (1.0f + x * (0.5f + x * (1.0f / 6.0f))) : expf(x) - 1.0f;
+    }
+    else
+    {
+        g->rate = 0.0f;
+    }
+
+    g->phase = 0;
+    g->freq = g->first;
+    g->carry = 0.0f;
+    g->step = (Uint32)(g->first * 4294967296.0f);
+    g->amplitude = (int16)(c->amplitude + 0.5f);
+    g->dac = c->dac;
+    g->sweep = (g->first == g->last) ? DDS_SWEEP_OFF : c->sweep;
+    g->end = c->end;
+    g->loadRequest = 0;
+    Dds.tone[t].loadRequest = 1;
+    return 1;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,189 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: dds.h
+/*
+// File Description:
+// Direct digital synthesis of test stimuli on DAC-A/B/C (DAC_SOURCE = DAC_SOURCE_DDS),
+// for frequency-response measurements of the actuator.
+//
+// DDS_TONES generators run at the ADC sample rate from adca1_isr. Each one has a 32-bit
+// phase accumulator and reads DdsSineTable[] (sinetab.c, DDS_TABLE_SIZE entries plus a
+// guard entry, Q15): the top DDS_TABLE_BITS of the phase select the entry and the next
+// 16 bits interpolate linearly to the following one. With 1024 entries the interpolation
+// error is below 5e-6 of full scale, far under one 12-bit DAC count. Every generator adds
+// to one DAC; the outputs are summed around mid-scale and limited to 0..4095.
+//
+// A generator is either a fixed tone or a chirp from start to stop Hz over a given time:
+//   DDS_SWEEP_LINEAR  frequency changes by the same number of Hz every sample
+//   DDS_SWEEP_LOG     frequency changes by the same ratio every sample (equal time per decade)
+// At the stop frequency the chirp holds, starts again or switches the generator off
+// (DDS_END_*). The sweep runs on the instantaneous frequency in float32 turns per sample
+// with compensated summation, so slow sweeps do not stall; the phase stays continuous.
+//
+// Starting a generator: fill DdsConfig[t] and call DdsLoad(t). DdsLoad() converts the
+// settings for the ISR and the generator takes them, from phase 0, at the next sample.
+// As with FilterLoad(), a second call is refused until Dds.tone[t].loadRequest is back to 0.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef DDS_H
+#define DDS_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+
+// Definitions for the generator
+#define DDS_TONES           4           // Generators
+#define DDS_DACS            3           // DAC-A, DAC-B, DAC-C
+#define DDS_TABLE_BITS      10          // Sine table entries = 2^DDS_TABLE_BITS
+#define DDS_TABLE_SIZE      (1U << DDS_TABLE_BITS)
+#define DDS_DAC_MID         2048        // Output with every generator off
+#define DDS_DAC_MAX         4095        // 12-bit DAC full scale
+#define DDS_AMPLITUDE_MAX   2047        // [DAC counts] peak of one generator
+
+// DdsConfig[].dac
+#define DDS_DAC_A           0
+#define DDS_DAC_B           1
+#define DDS_DAC_C           2
+#define DDS_DAC_OFF         3           // Generator stopped
+
+// DdsConfig[].sweep
+#define DDS_SWEEP_OFF       0           // Fixed tone at start Hz
+#define DDS_SWEEP_LINEAR    1
+#define DDS_SWEEP_LOG       2
+
+// DdsConfig[].end, what a chirp does at the stop frequency
+#define DDS_END_HOLD        0           // Stay at stop Hz
+#define DDS_END_REPEAT      1           // Jump back to start Hz
+#define DDS_END_STOP        2           // Switch the generator off
+
+// Settings of one generator, as written by the application
+typedef struct
+{
+    Uint16 dac;                             // DDS_DAC_A..DDS_DAC_C, DDS_DAC_OFF
+    Uint16 sweep;                           // DDS_SWEEP_*
+    Uint16 end;                             // DDS_END_*, chirps only
+    float32 amplitude;                      // [DAC counts] peak, up to DDS_AMPLITUDE_MAX
+    float32 start;                          // [Hz] tone frequency, or first chirp frequency
+    float32 stop;                           // [Hz] last chirp frequency
+    float32 seconds;                        // Chirp duration
+} DDS_TONE_CONFIG;
+
+// One generator as run by DdsRun()
+typedef struct
+{
+    Uint32 phase;                           // [2^-32 turn]
+    Uint32 step;                            // Phase increment per sample
+    float32 freq;                           // [turns/sample] instantaneous frequency (chirps)
+    float32 carry;                          // Low-order part of freq lost by the last update
+    float32 rate;                           // Per-sample change of freq: turns/sample (linear) or ratio - 1 (log)
+    float32 first;                          // [turns/sample] start of the chirp
+    float32 last;                           // [turns/sample] stop of the chirp
+    int16 amplitude;                        // [DAC counts] peak
+    Uint16 dac;                             // DDS_DAC_*
+    Uint16 sweep;                           // DDS_SWEEP_*
+    Uint16 end;                             // DDS_END_*
+    volatile Uint16 loadRequest;            // Set by DdsLoad(), cleared when Dds.next[] is taken
+} DDS_TONE;
+
+typedef struct
+{
+    DDS_TONE tone[DDS_TONES];
+    DDS_TONE next[DDS_TONES];               // Converted by DdsLoad(), taken by DdsRun()
+    float32 turnsPerHz;                     // 1 / sample rate
+    Uint32 loads;                           // Settings taken
+    Uint32 sweeps;                          // Chirps that reached their stop frequency
+    Uint32 clips;                           // Samples with a DAC output limited
+} DDS_GENERATOR;
+
+extern const int16 DdsSineTable[DDS_TABLE_SIZE + 1];   // sin(2 pi i / DDS_TABLE_SIZE) in Q15, SINTBL
+extern DDS_TONE_CONFIG DdsConfig[DDS_TONES];           // Pending settings, see DdsLoad()
+extern DDS_GENERATOR Dds;
+
+// Function Prototypes
+void DdsInit(float32 sampleHz);         // All generators off, DACs at mid-scale
+Uint16 DdsLoad(Uint16 t);               // Start DdsConfig[t] at the next sample, 0 if busy or invalid
+
+// sin(2 pi phase / 2^32) in Q15, linearly interpolated between table entries
+static inline int32 DdsSine(Uint32 phase)
+{
+    Uint16 i = (Uint16)(phase >> (32 - DDS_TABLE_BITS));
+    int32 frac = (int32)((phase >> (16 - DDS_TABLE_BITS)) & 0xFFFF);
+    int32 y0 = DdsSineTable[i];
+
+    return y0 + (((DdsSineTable[i + 1] - y0) * frac) >> 16);
+}
+
+// Move a chirp on by one sample
+static inline void DdsSweep(DDS_TONE *g)
+{
+    float32 delta = (g->sweep == DDS_SWEEP_LOG) ? g->freq * g->rate : g->rate;
+    float32 y = delta - g->carry;
+    float32 t = g->freq + y;
+
+    g->carry = (t - g->freq) - y;
+    g->freq = t;
+    if ((g->rate >= 0.0f) ? (t >= g->last) : (t <= g->last))
+    {
+        Dds.sweeps++;
+        g->carry = 0.0f;
+        if (g->end == DDS_END_REPEAT)
+        {
+            g->freq = g->first;
+        }
+        else
+        {
+            g->freq = g->last;
+            g->sweep = DDS_SWEEP_OFF;
+            if (g->end == DDS_END_STOP)
+            {
+                g->dac = DDS_DAC_OFF;
+            }
+        }
+    }
+    g->step = (Uint32)(g->freq * 4294967296.0f);
+}
+
+// One sample of every DAC: out[DDS_DAC_x] = mid-scale + sum of the generators on that DAC
+static inline void DdsRun(Uint16 out[DDS_DACS])
+{
+    int32 acc[DDS_DACS] = {DDS_DAC_MID, DDS_DAC_MID, DDS_DAC_MID};
+    DDS_TONE *g;
+    Uint16 t;
+
+    for (t = 0; t < DDS_TONES; t++)
+    {
+        g = &Dds.tone[t];
+        if (g->loadRequest != 0)
+        {
+            *g = Dds.next[t];
+            Dds.loads++;
+            g->loadRequest = 0;
+        }
+        if (g->dac < DDS_DACS)
+        {
+            acc[g->dac] += (DdsSine(g->phase) * g->amplitude + 0x4000) >> 15;
+            g->phase += g->step;
+            if (g->sweep != DDS_SWEEP_OFF)
+            {
+                DdsSweep(g);
+            }
+        }
+    }
+
+    for (t = 0; t < DDS_DACS; t++)
+    {
+        if ((acc[t] < 0) || (acc[t] > DDS_DAC_MAX))
+        {
+            acc[t] = (acc[t] < 0) ? 0 : DDS_DAC_MAX;
+            Dds.clips++;
+        }
+        out[t] = (Uint16)acc[t];
+    }
+}
+
+#endif  // end of DDS_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,150 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: dma_capture.c
+/*
+// File Description:
+// DMA ping-pong capture of the ADC SOC0 results. See dma_capture.h for the buffer scheme.
+// -----------------------------------------------------------------------------
+ */
+
+#include "dma_capture.h"
+#include "actuation_cpu01.h"    // Build configuration and shared acquisition state
+#include "isr_profiler.h"       // ISR execution time and latency statistics
+#include "sdram_store.h"        // Deep capture store in EMIF1 SDRAM
+
+// Ping-pong buffers, kept out of .ebss in GS RAM where the DMA has access
+#pragma DATA_SECTION(DmaCaptureBuffer, "DmaCaptureSection")
+Uint16 DmaCaptureBuffer[DMA_CAPTURE_CHANNELS][2 * DMA_CAPTURE_HALF_SIZE];
+
+volatile Uint32 dmaBlockCount = 0;      // Completed half-buffers
+volatile Uint16 dmaBlockOverrun = 0;    // Half-buffers that arrived while the previous one was being processed
+static Uint16 dmaFillHalf = 0;          // Half the DMA is writing during the current transfer
+static Uint16 dmaStarted = 0;           // Set once the first transfer has begun
+static Uint16 dmaBusy = 0;              // Set while ProcessCaptureBlock() runs
+
+// Point the shadow destination of all four channels at the given half
+static void SetCaptureHalf(Uint16 half)
+{
+    Uint32 offset = (Uint32)half * DMA_CAPTURE_HALF_SIZE;
+
+    EALLOW;     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    DmaRegs.CH1.DST_BEG_ADDR_SHADOW = (Uint32)&DmaCaptureBuffer[DMA_CAPTURE_ADCA][offset];
+    DmaRegs.CH1.DST_ADDR_SHADOW = (Uint32)&DmaCaptureBuffer[DMA_CAPTURE_ADCA][offset];
+    DmaRegs.CH2.DST_BEG_ADDR_SHADOW = (Uint32)&DmaCaptureBuffer[DMA_CAPTURE_ADCB][offset];
+    DmaRegs.CH2.DST_ADDR_SHADOW = (Uint32)&DmaCaptureBuffer[DMA_CAPTURE_ADCB][offset];
+    DmaRegs.CH3.DST_BEG_ADDR_SHADOW = (Uint32)&DmaCaptureBuffer[DMA_CAPTURE_ADCC][offset];
+    DmaRegs.CH3.DST_ADDR_SHADOW = (Uint32)&DmaCaptureBuffer[DMA_CAPTURE_ADCC][offset];
+    DmaRegs.CH4.DST_BEG_ADDR_SHADOW = (Uint32)&DmaCaptureBuffer[DMA_CAPTURE_ADCD][offset];
+    DmaRegs.CH4.DST_ADDR_SHADOW = (Uint32)&DmaCaptureBuffer[DMA_CAPTURE_ADCD][offset];
+    EDIS;       // Using EDIS to clear the EALLOW
+}
+
+// Set up DMA channels 1-4: one word per ADCAINT1 burst, DMA_CAPTURE_HALF_SIZE bursts per transfer
+void ConfigureDmaCapture(void)
+{
+    DMAInitialize();                    // Hard reset the DMA and let it run free on emulation suspend
+
+    // Channel 1 -- ADC-A (mmSpeed)
+    DMACH1AddrConfig(&DmaCaptureBuffer[DMA_CAPTURE_ADCA][0], &AdcaResultRegs.ADCRESULT0);
+    DMACH1BurstConfig(0, 0, 0);                                 // 1 word per burst
+    DMACH1TransferConfig(DMA_CAPTURE_HALF_SIZE - 1, 0, 1);      // Same source, next destination word
+    DMACH1WrapConfig(0xFFFF, 0, 0xFFFF, 0);                     // No wrap
+    DMACH1ModeConfig(DMA_ADCAINT1, PERINT_ENABLE, ONESHOT_DISABLE, CONT_ENABLE, SYNC_DISABLE, SYNC_SRC,
+                     OVRFLOW_DISABLE, SIXTEEN_BIT, CHINT_BEGIN, CHINT_DISABLE);
+
+    // Channel 2 -- ADC-B (DutyCycle)
+    DMACH2AddrConfig(&DmaCaptureBuffer[DMA_CAPTURE_ADCB][0], &AdcbResultRegs.ADCRESULT0);
+    DMACH2BurstConfig(0, 0, 0);
+    DMACH2TransferConfig(DMA_CAPTURE_HALF_SIZE - 1, 0, 1);
+    DMACH2WrapConfig(0xFFFF, 0, 0xFFFF, 0);
+    DMACH2ModeConfig(DMA_ADCAINT1, PERINT_ENABLE, ONESHOT_DISABLE, CONT_ENABLE, SYNC_DISABLE, SYNC_SRC,
+                     OVRFLOW_DISABLE, SIXTEEN_BIT, CHINT_BEGIN, CHINT_DISABLE);
+
+    // Channel 3 -- ADC-C (maCurrent), or the newest SDFM1 filter 1 result in its place
+#if SDFM_MODE == SDFM_ON
+    EALLOW;                             // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    CpuSysRegs.SECMSEL.bit.PF2SEL = 1;  // SDFM1 is on peripheral frame 2, whose secondary master is the CLA from reset
+    EDIS;                               // Using EDIS to clear the EALLOW
+    DMACH3AddrConfig(&DmaCaptureBuffer[DMA_CAPTURE_ADCC][0], (volatile Uint16 *)&Sdfm1Regs.SDDATA1.all);   // DATA16, the low word
+#else
+    DMACH3AddrConfig(&DmaCaptureBuffer[DMA_CAPTURE_ADCC][0], &AdccResultRegs.ADCRESULT0);
+#endif
+    DMACH3BurstConfig(0, 0, 0);
+    DMACH3TransferConfig(DMA_CAPTURE_HALF_SIZE - 1, 0, 1);
+    DMACH3WrapConfig(0xFFFF, 0, 0xFFFF, 0);
+    DMACH3ModeConfig(DMA_ADCAINT1, PERINT_ENABLE, ONESHOT_DISABLE, CONT_ENABLE, SYNC_DISABLE, SYNC_SRC,
+                     OVRFLOW_DISABLE, SIXTEEN_BIT, CHINT_BEGIN, CHINT_DISABLE);
+
+    // Channel 4 -- ADC-D (LoadTorque), the only channel that interrupts the CPU
+    DMACH4AddrConfig(&DmaCaptureBuffer[DMA_CAPTURE_ADCD][0], &AdcdResultRegs.ADCRESULT0);
+    DMACH4BurstConfig(0, 0, 0);
+    DMACH4TransferConfig(DMA_CAPTURE_HALF_SIZE - 1, 0, 1);
+    DMACH4WrapConfig(0xFFFF, 0, 0xFFFF, 0);
+    DMACH4ModeConfig(DMA_ADCAINT1, PERINT_ENABLE, ONESHOT_DISABLE, CONT_ENABLE, SYNC_DISABLE, SYNC_SRC,
+                     OVRFLOW_DISABLE, SIXTEEN_BIT, CHINT_BEGIN, CHINT_ENABLE);
+
+    dmaFillHalf = 1;                    // The first transfer writes half 0, so the first interrupt must queue half 1
+    dmaStarted = 0;
+}
+
+// Start DMA channels 1-4; they wait for the first ADCAINT1
+void StartDmaCapture(void)
+{
+    StartDMACH1();
+    StartDMACH2();
+    StartDMACH3();
+    StartDMACH4();
+}
+
+// DMA CH4 interrupt at the start of every transfer. Channels 1-3 have already started theirs,
+// so the shadows can be pointed at the half that the previous transfer has just completed.
+interrupt void dmach4_isr(void)
+{
+    Uint32 profileEntry = ProfileStamp();   // CPU Timer 1 at ISR entry
+    Uint32 profileSoc = (Uint32)EPwm2Regs.TBCTR * PROFILE_CYCLES_PER_TBCLK;  // SOC-to-entry latency [SYSCLK], ADCAINT1 follows the ePWM2 SOCA
+    Uint16 *block[DMA_CAPTURE_CHANNELS];    // Completed half, one pointer per ADC
+    Uint16 doneHalf = dmaFillHalf;          // Half written by the previous transfer
+    Uint16 offset;
+
+    dmaFillHalf ^= 1;                       // The transfer that just started writes the other half
+    SetCaptureHalf(doneHalf);               // The next transfer reuses the half about to be processed
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP7; // Acknowledge PIE group 7 to enable further interrupts
+
+    if (dmaStarted == 0)
+    {
+        dmaStarted = 1;                     // First transfer: nothing has been completed yet
+        return;
+    }
+
+#if SDRAM_MODE == SDRAM_ON
+    SdramStoreBlock(doneHalf);              // DMA CH5 copies the half to the SDRAM, even if processing overruns
+#endif
+
+    if (dmaBusy != 0)
+    {
+        dmaBlockOverrun++;                  // Previous block still being processed
+        ProfileRecord(&IsrProfile[ISR_PROFILE_DMACH4], profileEntry, profileSoc);
+        return;
+    }
+
+    offset = doneHalf * DMA_CAPTURE_HALF_SIZE;
+    block[DMA_CAPTURE_ADCA] = &DmaCaptureBuffer[DMA_CAPTURE_ADCA][offset];
+    block[DMA_CAPTURE_ADCB] = &DmaCaptureBuffer[DMA_CAPTURE_ADCB][offset];
+    block[DMA_CAPTURE_ADCC] = &DmaCaptureBuffer[DMA_CAPTURE_ADCC][offset];
+    block[DMA_CAPTURE_ADCD] = &DmaCaptureBuffer[DMA_CAPTURE_ADCD][offset];
+
+    // Allow group 1 (and other enabled groups) to preempt the block processing
+    dmaBusy = 1;
+    EINT;                                   // Enable Global interrupt INTM
+    ProcessCaptureBlock(block);             // Consume the completed half
+    DINT;                                   // Disable Global interrupt INTM before returning
+    dmaBusy = 0;
+    dmaBlockCount++;
+    ProfileRecord(&IsrProfile[ISR_PROFILE_DMACH4], profileEntry, profileSoc);
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
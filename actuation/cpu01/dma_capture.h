@@ -0,0 +1,57 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: dma_capture.h
+/*
+// File Description:
+// DMA ping-pong capture of the ADC-A/B/C/D SOC0 results (ADC_CAPTURE_MODE = ADC_CAPTURE_DMA).
+//
+// DMA channels 1-4 are all triggered by ADCAINT1. The four ADCs are started by the same
+// ePWM2 SOCA with identical ACQPS and prescale, so their results are ready together with
+// ADC-A's. Each channel copies one word per sample into its own double-buffered block in
+// GS RAM. The channels run in continuous mode and reload their destination from the shadow
+// registers at the start of every transfer, so the capture never stops.
+//
+// Only channel 4, the last one serviced in the round-robin, interrupts the CPU. It does so
+// at the start of each transfer, which is once per DMA_CAPTURE_HALF_SIZE samples. At that
+// point the other half has just been completed by all four channels. The ISR retargets
+// the shadow registers at it and passes it to ProcessCaptureBlock(). The CPU then has a
+// full half-buffer period to consume the block before it is overwritten.
+//
+// With SDFM_MODE = SDFM_ON channel 3 reads the SDFM1 filter 1 data register instead of ADC-C,
+// on the same trigger, so the ADC-C row holds the newest 16-bit data filter result of every
+// sample (sdfm_current.h).
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef DMA_CAPTURE_H
+#define DMA_CAPTURE_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+
+// Definitions for the ping-pong buffers
+#define DMA_CAPTURE_HALF_SIZE   128     // Samples per channel in each half (one CPU interrupt per half)
+#define DMA_CAPTURE_CHANNELS    4       // ADC-A (mmSpeed), ADC-B (DutyCycle), ADC-C (maCurrent), ADC-D (LoadTorque)
+#define DMA_CAPTURE_ADCA        0       // Row of DmaCaptureBuffer holding ADC-A results
+#define DMA_CAPTURE_ADCB        1       // Row of DmaCaptureBuffer holding ADC-B results
+#define DMA_CAPTURE_ADCC        2       // Row of DmaCaptureBuffer holding ADC-C results
+#define DMA_CAPTURE_ADCD        3       // Row of DmaCaptureBuffer holding ADC-D results
+
+extern Uint16 DmaCaptureBuffer[DMA_CAPTURE_CHANNELS][2 * DMA_CAPTURE_HALF_SIZE];    // Raw ADC (or SDFM) results, both halves
+extern volatile Uint32 dmaBlockCount;       // Number of completed half-buffers handed to ProcessCaptureBlock()
+extern volatile Uint16 dmaBlockOverrun;     // Blocks that were still being processed when the next one completed
+
+// Function Prototypes
+void ConfigureDmaCapture(void);             // Set up DMA channels 1-4 for ADC ping-pong capture (does not start them)
+void StartDmaCapture(void);                 // Start DMA channels 1-4
+interrupt void dmach4_isr(void);            // DMA CH4 start-of-transfer interrupt, one per half-buffer
+
+// Implemented by the application: consume one completed half-buffer.
+// block[DMA_CAPTURE_ADCx] points at DMA_CAPTURE_HALF_SIZE raw results of that ADC.
+void ProcessCaptureBlock(Uint16 *block[DMA_CAPTURE_CHANNELS]);
+
+#endif  // end of DMA_CAPTURE_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
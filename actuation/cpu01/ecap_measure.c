@@ -0,0 +1,159 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: ecap_measure.c
+/*
+// File Description:
+// eCAP1-3 period, duty and phase measurement of PWM1A, PWM5A and an external PWM. See ecap_measure.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "actuation_cpu01.h"    // Build configuration and shared acquisition state
+#include "ecap_measure.h"
+
+// eCAP module of each channel
+static volatile struct ECAP_REGS *const ecapModule[ECAP_CHANNELS] = {&ECap1Regs, &ECap2Regs, &ECap3Regs};
+
+volatile ECAP_STATUS EcapStatus;
+
+// Continuous capture of rising, falling, rising, falling edge with absolute SYSCLK time stamps, no interrupts
+static void EcapMeasureModule(volatile struct ECAP_REGS *cap)
+{
+    cap->ECEINT.all = 0x0000;                   // No interrupts: the background loop reads CAP1-4
+    cap->ECCLR.all = 0xFFFF;                    // Clear all flags
+    cap->ECCTL1.bit.CAPLDEN = 0;                // No CAP1-4 loads while configuring
+    cap->ECCTL2.bit.TSCTRSTOP = 0;              // Hold the counter
+
+    // Capture sequence
+    cap->ECCTL1.bit.CAP1POL = 0;                // CEVT1 on a rising edge
+    cap->ECCTL1.bit.CAP2POL = 1;                // CEVT2 on the falling edge after it
+    cap->ECCTL1.bit.CAP3POL = 0;                // CEVT3 on the next rising edge
+    cap->ECCTL1.bit.CAP4POL = 1;                // CEVT4 on the falling edge after that
+    cap->ECCTL1.bit.CTRRST1 = 0;                // Absolute time stamps, the counter is never reset by an event
+    cap->ECCTL1.bit.CTRRST2 = 0;
+    cap->ECCTL1.bit.CTRRST3 = 0;
+    cap->ECCTL1.bit.CTRRST4 = 0;
+    cap->ECCTL1.bit.PRESCALE = 0;               // Every edge
+    cap->ECCTL1.bit.FREE_SOFT = 2;              // Keep counting through emulation halts
+    cap->ECCTL2.bit.CAP_APWM = 0;               // Capture mode
+    cap->ECCTL2.bit.CONT_ONESHT = 0;            // Continuous: never stop
+    cap->ECCTL2.bit.STOP_WRAP = 3;              // Wrap to CAP1 after CEVT4
+
+    // Counter sync: eCAP1 passes the software sync down to eCAP2 and eCAP3
+    cap->CTRPHS = 0;                            // Counter value after the sync
+    cap->ECCTL2.bit.SYNCI_EN = 1;               // Load CTRPHS on the sync
+    cap->ECCTL2.bit.SYNCO_SEL = 0;              // Sync out = sync in
+
+    cap->ECCTL1.bit.CAPLDEN = 1;                // Enable CAP1-4 loads
+    cap->ECCTL2.bit.TSCTRSTOP = 1;              // Start the counter
+}
+
+// Delay of a rising edge after the last PWM1A rising edge, modulo the PWM1A period
+static Uint32 EcapPhase(Uint32 rise)
+{
+    const volatile ECAP_CHANNEL *reference = &EcapStatus.channel[ECAP_CH_PWM1];
+    int32 phase;
+
+    if (reference->period == 0)
+    {
+        return 0;                               // No PWM1A cycle measured yet
+    }
+    phase = (int32)(rise - reference->rise) % (int32)reference->period;    // The edge may come before the reference
+    if (phase < 0)
+    {
+        phase += (int32)reference->period;
+    }
+    return (Uint32)phase;
+}
+
+// Input X-BAR routing, three modules zeroed by one sync, all started
+void EcapMeasureInit(void)
+{
+    Uint16 ch;
+
+    InitECap1Gpio(ECAP_PWM1_GPIO);              // INPUT7 -> eCAP1
+    InitECap2Gpio(ECAP_PWM5_GPIO);              // INPUT8 -> eCAP2
+    InitECap3Gpio(ECAP_EXT_GPIO);               // INPUT9 -> eCAP3
+
+    for (ch = 0; ch < ECAP_CHANNELS; ch++)
+    {
+        ecapModule[ch]->ECCTL2.bit.REARM = 0;
+        EcapMeasureModule(ecapModule[ch]);
+        EcapStatus.channel[ch].period = 0;
+        EcapStatus.channel[ch].high = 0;
+        EcapStatus.channel[ch].duty = 0.0f;
+        EcapStatus.channel[ch].phase = 0;
+        EcapStatus.channel[ch].rise = 0;
+        EcapStatus.channel[ch].cycles = 0;
+        EcapStatus.channel[ch].age = 0;
+    }
+    EcapStatus.services = 0;
+
+    ECap1Regs.ECCTL2.bit.SWSYNC = 1;            // Zero all three counters on the same SYSCLK
+    for (ch = 0; ch < ECAP_CHANNELS; ch++)
+    {
+        ecapModule[ch]->ECCTL2.bit.SYNCI_EN = 0;    // ePWM1 SYNCO (ECAP1SYNCIN) must not reload them every period
+        ecapModule[ch]->ECCTL2.bit.REARM = 1;       // First rising edge into CAP1
+    }
+}
+
+// Publish the newest complete cycle of every module, if it is new; PWM1A first, the phase of
+// the others is taken from its newest rising edge
+void EcapMeasureService(void)
+{
+    volatile struct ECAP_REGS *cap;
+    volatile ECAP_CHANNEL *status;
+    Uint32 stamp[4];                            // CAP1-4: rising, falling, rising, falling
+    Uint32 rise;
+    Uint16 first;                               // CAP1-4 index of the first rising edge of the newest cycle
+    Uint16 ch;
+
+    for (ch = 0; ch < ECAP_CHANNELS; ch++)
+    {
+        cap = ecapModule[ch];
+        status = &EcapStatus.channel[ch];
+        if (cap->ECFLG.bit.CEVT4 == 0)
+        {
+            if (status->age < 0xFFFF)
+            {
+                status->age++;                  // CAP1-4 are not all loaded yet
+            }
+            continue;
+        }
+
+        // Read all four again if an edge came in between
+        do
+        {
+            stamp[0] = cap->CAP1;
+            stamp[1] = cap->CAP2;
+            stamp[2] = cap->CAP3;
+            stamp[3] = cap->CAP4;
+        } while ((stamp[0] != cap->CAP1) || (stamp[1] != cap->CAP2) ||
+                 (stamp[2] != cap->CAP3) || (stamp[3] != cap->CAP4));
+
+        // The newest edge is the one the next register in the wrap order is older than. Newest in
+        // CAP1 or CAP2: the complete cycle is CAP3, CAP4, CAP1; in CAP3 or CAP4 it is CAP1, CAP2, CAP3.
+        first = (((int32)(stamp[1] - stamp[0]) < 0) || ((int32)(stamp[2] - stamp[1]) < 0)) ? 2 : 0;
+        rise = stamp[first];
+        if ((status->cycles != 0) && (rise == status->rise))
+        {
+            if (status->age < 0xFFFF)
+            {
+                status->age++;                  // No new cycle since the last pass
+            }
+            continue;
+        }
+        status->period = stamp[(first + 2) & 3] - rise;    // Modulo 2^32: the counter may wrap inside the cycle
+        status->high = stamp[first + 1] - rise;
+        status->duty = (float32)status->high / (float32)status->period;
+        status->rise = rise;
+        status->phase = EcapPhase(rise);
+        status->cycles++;
+        status->age = 0;
+    }
+    EcapStatus.services++;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
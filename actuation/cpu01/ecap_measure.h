@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: ecap_measure.h
+/*
+// File Description:
+// Period, duty and phase measurement of PWM signals with eCAP1-3 (ECAP_MODE = ECAP_ON).
+//
+// The Input X-BAR routes PWM1A (GPIO0), PWM5A (GPIO8) and an external PWM on ECAP_EXT_GPIO
+// to eCAP1, eCAP2 and eCAP3. Each module time stamps edges with its 32-bit counter at
+// SYSCLK (5 ns), in continuous mode: rising, falling, rising, falling into CAP1-4, then it
+// wraps to CAP1 and goes on. The edges cost no CPU time and raise no interrupt.
+// The three counters are zeroed together by one software sync at startup, so stamps of
+// different channels compare directly, and run free after that.
+//
+// EcapMeasureService() is called from the background loop. For every module it reads CAP1-4,
+// takes the newest complete cycle (two rising edges and the falling edge between them) and,
+// if it is not the one published last, turns it into the period, the high time and the duty
+// of that PWM cycle, and the phase of its rising edge after the last rising edge of PWM1A,
+// modulo the PWM1A period. The registers hold one complete cycle, so every cycle is measured
+// only while the PWM period is longer than a background loop pass (MAIN_LOOP_PERIOD_US):
+// PWM1A, PWM5A and the external input with PWM_OUTPUT_FIXED. The PWM_OUTPUT_DUTY/HRPWM
+// carrier is subsampled, one cycle per pass, the cycles in between are not measured. A
+// module that sees no edges (0 % or 100 % duty, no signal) keeps its last cycle and its
+// EcapStatus entry ages.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef ECAP_MEASURE_H
+#define ECAP_MEASURE_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+
+// Definitions for the channels, EcapStatus.channel[] and eCAP1..3
+#define ECAP_CH_PWM1        0           // eCAP1 on PWM1A, the phase reference
+#define ECAP_CH_PWM5        1           // eCAP2 on PWM5A
+#define ECAP_CH_EXT         2           // eCAP3 on the external input
+#define ECAP_CHANNELS       3
+
+#define ECAP_PWM1_GPIO      0           // PWM1A pin
+#define ECAP_PWM5_GPIO      8           // PWM5A pin
+#ifndef ECAP_EXT_GPIO
+#define ECAP_EXT_GPIO       24          // External PWM input, any GPIO through the Input X-BAR
+#endif
+
+#define ECAP_SYSCLK_HZ      200000000UL // Time stamp clock: 5 ns per count
+
+// Last measurement of one channel, readable by the host
+typedef struct
+{
+    Uint32 period;                      // SYSCLK cycles between the two rising edges
+    Uint32 high;                        // SYSCLK cycles from the rising to the falling edge
+    float32 duty;                       // high / period
+    Uint32 phase;                       // SYSCLK cycles from the last PWM1A rising edge to this one, modulo its period
+    Uint32 rise;                        // Time stamp of the first rising edge
+    Uint32 cycles;                      // PWM cycles measured
+    Uint16 age;                         // EcapMeasureService() calls since the last measurement
+} ECAP_CHANNEL;
+
+// State and counters, readable by the host
+typedef struct
+{
+    ECAP_CHANNEL channel[ECAP_CHANNELS];
+    Uint32 services;                    // EcapMeasureService() calls
+} ECAP_STATUS;
+
+extern volatile ECAP_STATUS EcapStatus;
+
+// Function Prototypes
+void EcapMeasureInit(void);             // Route the inputs, sync the counters and start eCAP1-3
+void EcapMeasureService(void);          // Publish the newest complete cycles, from the background loop
+
+#endif  // end of ECAP_MEASURE_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,60 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: filter_bank.c
+/*
+// File Description:
+// Coefficient management of the per-channel filter bank. See filter_bank.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "filter_bank.h"
+
+// Both are read by CLA task 1 in ADC_CAPTURE_CLA, so they share its data RAM
+#pragma DATA_SECTION(FilterConfig, "FilterBankSection")
+#pragma DATA_SECTION(FilterBank, "FilterBankSection")
+FILTER_COEFFS FilterConfig[FILTER_CHANNELS];
+FILTER_BANK FilterBank;
+
+// Default: 2nd-order Butterworth low-pass at fs/10 (5 kHz at the 50 kHz ADC rate), no FIR
+static const FILTER_BIQUAD filterDefault =
+{
+    6.745527389e-02f, 1.349105478e-01f, 6.745527389e-02f,   // b0, b1, b2
+    -1.142980503e+00f, 4.128015981e-01f                     // a1, a2
+};
+
+// Load the default low-pass on every channel and clear the state. Call before the ADC is triggered.
+void FilterInit(void)
+{
+    Uint16 ch;
+
+    for (ch = 0; ch < FILTER_CHANNELS; ch++)
+    {
+        FilterConfig[ch].biquads = 1;
+        FilterConfig[ch].taps = 0;
+        FilterConfig[ch].biquad[0] = filterDefault;
+        FilterConfig[ch].biquad[1] = filterDefault;
+        FilterChannelTake(&FilterBank.channel[ch], &FilterConfig[ch]);
+        FilterBank.channel[ch].loadRequest = 0;
+        FilterBank.channel[ch].output = 0.0f;
+    }
+    FilterBank.loads = 0;
+}
+
+// Hand FilterConfig[ch] to the filter; it is taken at the next sample. Returns 0, and
+// leaves the running set alone, if the previous set has not been taken yet or the
+// section/tap counts are out of range.
+Uint16 FilterLoad(Uint16 ch)
+{
+    if ((ch >= FILTER_CHANNELS) || (FilterBank.channel[ch].loadRequest != 0) ||
+        (FilterConfig[ch].biquads > FILTER_MAX_BIQUADS) || (FilterConfig[ch].taps > FILTER_MAX_TAPS))
+    {
+        return 0;
+    }
+    FilterBank.channel[ch].loadRequest = 1;
+    return 1;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
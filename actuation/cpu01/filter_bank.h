@@ -0,0 +1,176 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: filter_bank.h
+/*
+// File Description:
+// Per-channel digital filter bank for the acquisition path (FILTER_MODE = FILTER_ON).
+//
+// Every ADC channel (TRIG_SRC_ADCx order) runs through up to FILTER_MAX_BIQUADS cascaded
+// biquads followed by an FIR of up to FILTER_MAX_TAPS taps, all in float32 on raw ADC
+// counts. The output is rounded and limited to 0..4095, so it can go wherever a raw
+// result went: the DACs and the scaled capture buffers use the filtered values; the
+// trigger engine and the stream keep the raw samples.
+//
+// Biquads use the transposed direct form II, two states per section:
+//   y  = b0 x + s1
+//   s1 = b1 x - a1 y + s2
+//   s2 = b2 x - a2 y
+// The FIR delay line is stored twice in a row, so a plain C loop reads the taps from
+// one contiguous window, newest input first, without a modulo. The same loop is
+// compiled for the C28x and the CLA; there is no hand-written MACF32 / RPT code.
+// FilterBankRun() is inline so the same code runs in adca1_isr, in ProcessCaptureBlock()
+// and in CLA task 1 (ADC_CAPTURE_CLA).
+//
+// Loading coefficients at run time: fill FilterConfig[ch] and call FilterLoad(ch). The
+// set is taken, and the channel's state cleared, at the next sample. FilterLoad() refuses
+// a new set while the previous one has not been taken yet; leave FilterConfig[ch] alone
+// until FilterBank.channel[ch].loadRequest has gone back to 0.
+//
+// FilterBank lives in FilterBankSection (RAMLS1), which is CLA data RAM in
+// ADC_CAPTURE_CLA and plain CPU RAM otherwise.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef FILTER_BANK_H
+#define FILTER_BANK_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+
+// Definitions for the filter bank
+#define FILTER_CHANNELS     4           // ADC-A, ADC-B, ADC-C, ADC-D, in TRIG_SRC_ADCx order
+#define FILTER_MAX_BIQUADS  2           // Cascaded sections per channel: up to 4th order IIR
+#define FILTER_MAX_TAPS     8           // FIR taps per channel
+#define FILTER_ADC_MAX      4095        // Output limit, 12-bit ADC/DAC full scale
+
+// One biquad section, a0 normalized to 1
+typedef struct
+{
+    float32 b0;
+    float32 b1;
+    float32 b2;
+    float32 a1;
+    float32 a2;
+} FILTER_BIQUAD;
+
+// Coefficients of one channel
+typedef struct
+{
+    Uint16 biquads;                         // Sections in use, 0..FILTER_MAX_BIQUADS
+    Uint16 taps;                            // FIR taps in use, 0 = no FIR, up to FILTER_MAX_TAPS
+    FILTER_BIQUAD biquad[FILTER_MAX_BIQUADS];
+    float32 fir[FILTER_MAX_TAPS];           // fir[k] weighs the input k samples back
+} FILTER_COEFFS;
+
+// Coefficients in use and state of one channel, only touched by FilterBankRun()
+typedef struct
+{
+    FILTER_COEFFS coeffs;
+    float32 s[FILTER_MAX_BIQUADS][2];       // Biquad states s1, s2
+    float32 delay[2 * FILTER_MAX_TAPS];     // FIR inputs, newest at delay[pos] and delay[pos + taps]
+    Uint16 pos;                             // Newest entry of the FIR delay line
+    volatile Uint16 loadRequest;            // Set by FilterLoad(), cleared when FilterConfig[] is taken
+    float32 output;                         // Last output before rounding
+} FILTER_CHANNEL;
+
+typedef struct
+{
+    FILTER_CHANNEL channel[FILTER_CHANNELS];
+    Uint32 loads;                           // Coefficient sets taken
+} FILTER_BANK;
+
+extern FILTER_COEFFS FilterConfig[FILTER_CHANNELS];    // Pending coefficients, see FilterLoad()
+extern FILTER_BANK FilterBank;                         // FilterBankSection
+
+#ifndef __TMS320C28XX_CLA__
+// Function Prototypes
+void FilterInit(void);                  // Load the default low-pass on every channel and clear the state
+Uint16 FilterLoad(Uint16 ch);           // Take FilterConfig[ch] at the next sample, 0 if busy or invalid
+#endif
+
+// Run one channel on one raw ADC result
+static inline Uint16 FilterChannelRun(FILTER_CHANNEL *f, Uint16 raw)
+{
+    float32 x = (float32)raw;
+    float32 y;
+    float32 acc;
+    Uint16 n;
+    Uint16 k;
+
+    for (n = 0; n < f->coeffs.biquads; n++)
+    {
+        const FILTER_BIQUAD *q = &f->coeffs.biquad[n];
+
+        y = q->b0 * x + f->s[n][0];
+        f->s[n][0] = q->b1 * x - q->a1 * y + f->s[n][1];
+        f->s[n][1] = q->b2 * x - q->a2 * y;
+        x = y;
+    }
+
+    n = f->coeffs.taps;
+    if (n != 0)
+    {
+        f->pos = (f->pos == 0) ? n - 1 : f->pos - 1;
+        f->delay[f->pos] = x;
+        f->delay[f->pos + n] = x;
+        acc = 0.0f;
+        for (k = 0; k < n; k++)
+        {
+            acc += f->coeffs.fir[k] * f->delay[f->pos + k];
+        }
+        x = acc;
+    }
+
+    f->output = x;
+    x += 0.5f;                              // Round to the nearest count
+    if (x < 0.0f)
+    {
+        return 0;
+    }
+    if (x > (float32)FILTER_ADC_MAX)
+    {
+        return FILTER_ADC_MAX;
+    }
+    return (Uint16)x;
+}
+
+// Take a pending coefficient set: new coefficients start from a cleared state
+static inline void FilterChannelTake(FILTER_CHANNEL *f, const FILTER_COEFFS *coeffs)
+{
+    Uint16 n;
+
+    f->coeffs = *coeffs;
+    for (n = 0; n < FILTER_MAX_BIQUADS; n++)
+    {
+        f->s[n][0] = 0.0f;
+        f->s[n][1] = 0.0f;
+    }
+    for (n = 0; n < 2 * FILTER_MAX_TAPS; n++)
+    {
+        f->delay[n] = 0.0f;
+    }
+    f->pos = 0;
+}
+
+// Filter one sample of all channels: out[ch] = filter(raw[ch])
+static inline void FilterBankRun(const Uint16 raw[FILTER_CHANNELS], Uint16 out[FILTER_CHANNELS])
+{
+    Uint16 ch;
+
+    for (ch = 0; ch < FILTER_CHANNELS; ch++)
+    {
+        if (FilterBank.channel[ch].loadRequest != 0)
+        {
+            FilterChannelTake(&FilterBank.channel[ch], &FilterConfig[ch]);
+            FilterBank.loads++;
+            FilterBank.channel[ch].loadRequest = 0;
+        }
+        out[ch] = FilterChannelRun(&FilterBank.channel[ch], raw[ch]);
+    }
+}
+
+#endif  // end of FILTER_BANK_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: ipc_batch.c
+/*
+// File Description:
+// Batched put/get and interrupt dispatch on top of the IPC driver. See ipc_batch.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "ipc_batch.h"
+
+void IpcBatchInit(IPC_BATCH *batch, Uint16 remoteInt, Uint16 localInt,
+                  IPC_BATCH_RECEIVE receive, IPC_BATCH_DONE done)
+{
+    IPCInitialize(&batch->controller, remoteInt, localInt);
+    batch->receive = receive;
+    batch->done = done;
+    batch->putRead = *(batch->controller.pusPutReadIndex);
+    batch->stats.puts = 0;
+    batch->stats.putMessages = 0;
+    batch->stats.putFull = 0;
+    batch->stats.gets = 0;
+    batch->stats.getMessages = 0;
+    batch->stats.completed = 0;
+}
+
+Uint16 IpcPutFree(IPC_BATCH *batch)
+{
+    return (*(batch->controller.pusPutReadIndex) - *(batch->controller.pusPutWriteIndex) - 1) & MAX_BUFFER_INDEX;
+}
+
+// Copy first, then publish the write index once and raise the flag once
+Uint16 IpcPutBatch(IPC_BATCH *batch, const tIpcMessage *messages, Uint16 count)
+{
+    Uint16 writeIndex = *(batch->controller.pusPutWriteIndex);
+    Uint16 space = IpcPutFree(batch);
+    Uint16 i;
+
+    if (count > space)
+    {
+        batch->stats.putFull++;
+        count = space;
+    }
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        batch->controller.psPutBuffer[writeIndex] = messages[i];
+        writeIndex = (writeIndex + 1) & MAX_BUFFER_INDEX;
+    }
+    *(batch->controller.pusPutWriteIndex) = writeIndex;
+    IpcRegs.IPCSET.all = batch->controller.ulPutFlag;  // One interrupt for the whole batch
+
+    batch->stats.puts++;
+    batch->stats.putMessages += count;
+    return count;
+}
+
+// Copy out, then release the slots once and tell the sender
+Uint16 IpcGetBatch(IPC_BATCH *batch, tIpcMessage *messages, Uint16 max)
+{
+    Uint16 readIndex = *(batch->controller.pusGetReadIndex);
+    Uint16 writeIndex = *(batch->controller.pusGetWriteIndex);
+    Uint16 count = 0;
+
+    while ((readIndex != writeIndex) && (count < max))
+    {
+        messages[count++] = batch->controller.psGetBuffer[readIndex];
+        readIndex = (readIndex + 1) & MAX_BUFFER_INDEX;
+    }
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    *(batch->controller.pusGetReadIndex) = readIndex;
+    IpcRegs.IPCSET.all = batch->controller.ulPutFlag;  // Completion for the sender
+
+    batch->stats.gets++;
+    batch->stats.getMessages += count;
+    return count;
+}
+
+void IpcBatchService(IPC_BATCH *batch)
+{
+    tIpcMessage messages[IPC_BATCH_MAX];
+    Uint16 readIndex;
+    Uint16 count;
+
+    // Messages of ours the other core has taken since the last call
+    readIndex = *(batch->controller.pusPutReadIndex);
+    count = (readIndex - batch->putRead) & MAX_BUFFER_INDEX;
+    if (count != 0)
+    {
+        batch->putRead = readIndex;
+        batch->stats.completed += count;
+        if (batch->done != NULL)
+        {
+            batch->done(count);
+        }
+    }
+
+    // Messages for us, in as few batches as the buffer allows
+    do {
+        count = IpcGetBatch(batch, messages, IPC_BATCH_MAX);
+        if ((count != 0) && (batch->receive != NULL))
+        {
+            batch->receive(messages, count);
+        }
+    } while (count != 0);
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: ipc_batch.h
+/*
+// File Description:
+// Batched, interrupt-driven use of the IPC driver (F2837xD_Ipc_Driver.c). Shared by
+// both projects: the cpu02 project includes this file from ../cpu01.
+//
+// IpcPut() copies one message, publishes the write index and raises the IPC flag per
+// message, and with ENABLE_BLOCKING spins on the other core's read index; IpcGet() is
+// meant to be polled. IpcPutBatch() and IpcGetBatch() move up to a full buffer with one
+// index update and one flag. IpcBatchService(), called from the IPC interrupt, hands
+// the received messages to a callback in batches and reports through a second
+// callback how many of this core's messages the other core has taken, so neither side
+// has to spin.
+//
+// One IPC interrupt serves both directions: a core raises the flag after it puts
+// messages and after it takes messages, and IpcBatchService() on the other core
+// handles both. Taking nothing raises nothing, so the exchange always settles.
+//
+// Buffer size: IPC_BUFFER_SIZE and NUM_IPC_INTERRUPTS (F2837xD_Ipc_drivers.h) can be set
+// with --define, identically in both projects and the host build. A buffer holds
+// IPC_BUFFER_SIZE - 1 messages. All buffers and indexes of one direction must fit in
+// the IPC_DRIVER_WORDS of CPU1TOCPU2RAM/CPU2TOCPU1RAM, e.g. 4 interrupts x 4 messages
+// (default) or 1 interrupt x 16 messages.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef IPC_BATCH_H
+#define IPC_BATCH_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+#include "F2837xD_Ipc_drivers.h"    // IPC driver messages and controller
+
+// Definitions for the IPC driver buffers
+#define IPC_MESSAGE_WORDS       8               // Size of one tIpcMessage on the C28x
+#define IPC_DRIVER_WORDS        0x100           // CPU1TOCPU2RAM/CPU2TOCPU1RAM in both linker command files
+#define IPC_BATCH_MAX           (IPC_BUFFER_SIZE - 1)   // Messages one buffer can hold
+
+#if (IPC_BUFFER_SIZE & (IPC_BUFFER_SIZE - 1)) != 0
+#error "IPC_BUFFER_SIZE must be a power of two"
+#endif
+#if (NUM_IPC_INTERRUPTS * (IPC_BUFFER_SIZE * IPC_MESSAGE_WORDS + 2)) > IPC_DRIVER_WORDS
+#error "IPC driver buffers do not fit in CPU1TOCPU2RAM/CPU2TOCPU1RAM: reduce IPC_BUFFER_SIZE or NUM_IPC_INTERRUPTS"
+#endif
+
+// Called from IpcBatchService() with messages received from the other core
+typedef void (*IPC_BATCH_RECEIVE)(const tIpcMessage *messages, Uint16 count);
+// Called from IpcBatchService() with the number of put messages the other core has taken
+typedef void (*IPC_BATCH_DONE)(Uint16 count);
+
+// Counters of one batch instance
+typedef struct
+{
+    Uint32 puts;                                // IpcPutBatch() calls that queued messages (one flag each)
+    Uint32 putMessages;                         // Messages queued
+    Uint32 putFull;                             // IpcPutBatch() calls that could not queue everything
+    Uint32 gets;                                // IpcGetBatch() calls that took messages
+    Uint32 getMessages;                         // Messages taken
+    Uint32 completed;                           // Put messages reported through the done callback
+} IPC_BATCH_STATS;
+
+// One IPC interrupt pair seen from this core
+typedef struct
+{
+    volatile tIpcController controller;         // IPC driver instance
+    IPC_BATCH_RECEIVE receive;                  // May be NULL: received messages are dropped
+    IPC_BATCH_DONE done;                        // May be NULL
+    Uint16 putRead;                             // Other core's read index already reported
+    IPC_BATCH_STATS stats;
+} IPC_BATCH;
+
+// Function Prototypes
+void IpcBatchInit(IPC_BATCH *batch, Uint16 remoteInt, Uint16 localInt,
+                  IPC_BATCH_RECEIVE receive, IPC_BATCH_DONE done);              // Set up the driver instance, empty buffers
+Uint16 IpcPutBatch(IPC_BATCH *batch, const tIpcMessage *messages, Uint16 count);   // Queue up to count messages, one flag; returns the number queued
+Uint16 IpcGetBatch(IPC_BATCH *batch, tIpcMessage *messages, Uint16 max);        // Take up to max messages, one flag; returns the number taken
+Uint16 IpcPutFree(IPC_BATCH *batch);                                            // Messages IpcPutBatch() can queue now
+void IpcBatchService(IPC_BATCH *batch);                                         // From the IPC interrupt, after IPCACK: completions, then received batches
+
+#endif  // end of IPC_BATCH_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,212 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: ipc_link.c
+/*
+// File Description:
+// CPU1 side of the sample hand-off to CPU2. See ipc_link.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "ipc_link.h"
+
+// Shared message RAM: CPU1 owns the blocks, CPU2 owns the status (DSECT here)
+#if CPU2_LINK == CPU2_LINK_GSRAM
+#pragma DATA_SECTION(IpcBlocks, "Cpu1ToCpu2PageSection")
+#else
+#pragma DATA_SECTION(IpcBlocks, "Cpu1ToCpu2Section")
+#endif
+#pragma DATA_SECTION(Cpu2Status, "Cpu2ToCpu1Section")
+IPC_SAMPLE_BLOCK IpcBlocks[IPC_BLOCK_SLOTS];
+volatile CPU2_STATUS Cpu2Status;
+
+volatile IPC_LINK_STATS IpcLinkStats;   // CPU1 side counters
+
+static IPC_BATCH ipcCpu2;               // IPC driver instance for IPC_LINK_INT
+static Uint16 linkFill;                 // Records in the block being filled
+static Uint32 linkFilled;               // Blocks filled, posted or not
+static Uint32 linkReleased;             // Cpu2Status.blocksDone when the link started
+static Uint32 postTime[IPC_BLOCK_SLOTS];    // IPCCOUNTERL when each slot was posted
+
+#if CPU2_LINK == CPU2_LINK_GSRAM
+// Give the GS RAM block of a page to CPU2 (cpu2 = 1) or take it back (cpu2 = 0)
+static void IpcLinkPageOwner(Uint16 slot, Uint16 cpu2)
+{
+    Uint32 mask = 1UL << (IPC_PAGE_FIRST_GS + slot);
+
+    EALLOW;                             // GSxMSEL is EALLOW protected
+    if (cpu2)
+    {
+        MemCfgRegs.GSxMSEL.all |= mask;
+    }
+    else
+    {
+        MemCfgRegs.GSxMSEL.all &= ~mask;
+    }
+    EDIS;
+}
+#endif
+
+// Completion callback: CPU2 has taken count more blocks from the IPC buffer
+static void IpcLinkTaken(Uint16 count)
+{
+    Uint32 latency;
+
+    while (count-- != 0)
+    {
+        latency = IpcRegs.IPCCOUNTERL - postTime[IpcLinkStats.blocksTaken % IPC_BLOCK_SLOTS];
+        IpcLinkStats.latencyLast = latency;
+        if (latency > IpcLinkStats.latencyMax)
+        {
+            IpcLinkStats.latencyMax = latency;
+        }
+        IpcLinkStats.blocksTaken++;
+    }
+}
+
+// Wait for CPU2, then start posting from slot 0
+void IpcLinkInit(void)
+{
+#if CPU2_LINK == CPU2_LINK_GSRAM
+    Uint16 i;
+
+#endif
+    while ((IpcRegs.IPCSTS.all & IPC_FLAG_CPU2_READY) == 0)
+    {
+        DELAY_US(10);                   // CPU2 still booting
+    }
+    IpcRegs.IPCACK.all = IPC_FLAG_CPU2_READY;
+    IpcBatchInit(&ipcCpu2, IPC_LINK_INT, IPC_LINK_INT, NULL, IpcLinkTaken);
+
+    linkFill = 0;
+    linkFilled = 0;
+    linkReleased = Cpu2Status.blocksDone;
+#if CPU2_LINK == CPU2_LINK_GSRAM
+    for (i = 0; i < IPC_BLOCK_SLOTS; i++)
+    {
+        IpcLinkPageOwner(i, 0);         // Every page starts with CPU1
+    }
+#endif
+    IpcLinkStats.blocksSent = 0;
+    IpcLinkStats.batches = 0;
+    IpcLinkStats.slotsBusy = 0;
+    IpcLinkStats.putFull = 0;
+    IpcLinkStats.blocksTaken = 0;
+    IpcLinkStats.latencyLast = 0;
+    IpcLinkStats.latencyMax = 0;
+
+    // Map and enable the completion interrupt
+    EALLOW;                             // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    PieVectTable.IPC0_INT = &ipc_link_isr;  // Function for IPC interrupt 0 from CPU2
+    EDIS;                               // Using EDIS to clear the EALLOW
+    IpcRegs.IPCACK.all = IPC_FLAG0;     // Drop a stale flag
+    PieCtrlRegs.PIEIER1.bit.INTx13 = 1; // IPC0_INT
+    IER |= M_INT1;                      // Enable group 1 interrupts
+}
+
+// IPC interrupt 0: CPU2 has taken blocks
+interrupt void ipc_link_isr(void)
+{
+    IpcRegs.IPCACK.all = IPC_FLAG0;             // Clear the IPC0 flag before looking, so a new one interrupts again
+    IpcBatchService(&ipcCpu2);
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP1;     // Acknowledge PIE group 1 to enable further interrupts
+}
+
+// Post every filled block not posted yet as one batch
+static void IpcLinkPost(void)
+{
+    tIpcMessage messages[IPC_BLOCK_SLOTS];
+    Uint16 count = (Uint16)(linkFilled - IpcLinkStats.blocksSent);
+    Uint16 posted;
+    Uint32 block;
+    Uint16 i;
+
+    if (count == 0)
+    {
+        return;
+    }
+    for (i = 0; i < count; i++)
+    {
+        block = IpcLinkStats.blocksSent + i;
+        messages[i].ulcommand = IPC_CMD_SAMPLE_BLOCK;
+        messages[i].uladdress = block % IPC_BLOCK_SLOTS;
+        messages[i].uldataw1 = IPC_BLOCK_RECORDS;
+        messages[i].uldataw2 = block;
+        postTime[block % IPC_BLOCK_SLOTS] = IpcRegs.IPCCOUNTERL;
+    }
+
+    posted = IpcPutBatch(&ipcCpu2, messages, count);
+    if (posted != 0)
+    {
+        IpcLinkStats.batches++;
+    }
+    if (posted < count)
+    {
+        IpcLinkStats.putFull++;         // The rest goes out on the next pass
+    }
+    IpcLinkStats.blocksSent += posted;
+}
+
+// StreamSink: copy records into free slots, then post the full ones
+Uint16 IpcLinkSink(const STREAM_RECORD *records, Uint16 count)
+{
+    IPC_SAMPLE_BLOCK *block;
+    Uint16 taken = 0;
+
+    while (taken < count)
+    {
+        if ((linkFilled - (Cpu2Status.blocksDone - linkReleased)) >= IPC_BLOCK_SLOTS)
+        {
+            IpcLinkStats.slotsBusy++;   // CPU2 still working on every slot
+            break;
+        }
+
+        block = &IpcBlocks[linkFilled % IPC_BLOCK_SLOTS];
+#if CPU2_LINK == CPU2_LINK_GSRAM
+        if (linkFill == 0)
+        {
+            IpcLinkPageOwner(linkFilled % IPC_BLOCK_SLOTS, 0);  // Released by CPU2, take it back before writing
+        }
+#endif
+        while ((taken < count) && (linkFill < IPC_BLOCK_RECORDS))
+        {
+            block->record[linkFill++] = records[taken++];
+        }
+        if (linkFill == IPC_BLOCK_RECORDS)
+        {
+#if CPU2_LINK == CPU2_LINK_GSRAM
+            IpcLinkPageOwner(linkFilled % IPC_BLOCK_SLOTS, 1);  // Complete: CPU2 owns it until it is released
+#endif
+            linkFill = 0;
+            linkFilled++;
+        }
+    }
+    IpcLinkPost();
+    return taken;
+}
+
+// Copy the last closed window without tearing. Returns 0 if every attempt overlapped an update.
+Uint16 Cpu2WindowSnapshot(CPU2_WINDOW *copy)
+{
+    Uint16 sequence;
+    Uint16 i;
+
+    for (i = 0; i < CPU2_SNAPSHOT_TRIES; i++)
+    {
+        sequence = Cpu2Status.sequence;
+        if ((sequence & 1) != 0)
+        {
+            continue;                   // CPU2 in the middle of an update
+        }
+        *copy = Cpu2Status.window;
+        if (Cpu2Status.sequence == sequence)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
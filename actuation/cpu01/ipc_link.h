@@ -0,0 +1,137 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: ipc_link.h
+/*
+// File Description:
+// Sample hand-off from CPU1 to CPU2 (CPU2_MODE = CPU2_ON). Shared by both projects:
+// the cpu02 project includes this file from ../cpu01.
+//
+// CPU1 keeps the ADC/DAC loop and streams every sample as before. Its StreamSink
+// (IpcLinkSink) copies the records into one of IPC_BLOCK_SLOTS blocks in the
+// CPU1-to-CPU2 message RAM and, once a block holds IPC_BLOCK_RECORDS records, posts
+// an IPC_CMD_SAMPLE_BLOCK message; all blocks completed in one pass go out as a single
+// batch with a single flag (ipc_batch.h, IPC_INT0, PIE 1.13 on both CPUs). CPU2 filters
+// the block, updates the statistics, encodes it as telemetry on SCI-A and then
+// increments Cpu2Status.blocksDone, which releases the slot. CPU1 never waits for
+// CPU2: while all slots are in use the records stay in the stream ring.
+//
+// When CPU2 takes messages it raises IPC_INT0 back to CPU1. ipc_link_isr() then
+// records, per block, the IPCCOUNTER ticks (SYSCLK) from the post to the moment CPU2
+// took it, in IpcLinkStats. It shares PIE group 1 with adca1_isr and runs for well under
+// a microsecond, once per block.
+//
+// GS RAM pages (CPU2_LINK = CPU2_LINK_GSRAM): the blocks are GS5-GS8 instead, one 4K-word
+// GS RAM block each, IPC_BLOCK_RECORDS = 682 records (13.6 ms at 50 kHz). CPU1 fills a
+// page in place, hands write ownership of it to CPU2 (MemCfgRegs.GSxMSEL, which only
+// CPU1 can write) and posts the same one-message descriptor. The master select only
+// decides which CPU may write a GS block; both CPUs can read every block at any time, so
+// an early read does not fault. CPU2 reads a page only once its IPC message has arrived,
+// processes it where it is, without copying it, and hands it back through
+// Cpu2Status.blocksDone; CPU1 takes write ownership back before it writes the first
+// record into it again. A block of several thousand words crosses cores for the cost of one register
+// write and one IPC message, where message RAM holds 768 words in all.
+//
+// Message RAM split (both linker command files must agree):
+//   CPU1TOCPU2RAM   0x3FC00  256 words  IPC driver buffers and indexes (CPU1 writes)
+//   CPU1TOCPU2_DATA 0x3FD00  768 words  IpcBlocks[]                    (CPU1 writes)
+//   CPU2TOCPU1RAM   0x3F800  256 words  IPC driver buffers and indexes (CPU2 writes)
+//   CPU2TOCPU1_DATA 0x3F900  768 words  Cpu2Status                     (CPU2 writes)
+//
+// Start-up: CPU1 sets up the SCI-A pins, assigns SCI-A to CPU2 (CPUSEL5) and sets
+// IPC_FLAG_SCI_GRANTED. CPU2 waits for it, opens SCI-A, initializes its side of the IPC
+// driver and sets IPC_FLAG_CPU2_READY; CPU1 waits for that before the first sample is posted.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef IPC_LINK_H
+#define IPC_LINK_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+#include "F2837xD_Ipc_drivers.h"    // IPC driver messages and flags
+#include "ipc_batch.h"          // Batched, interrupt-driven IPC
+#include "stream.h"             // STREAM_RECORD
+#include "actuation_cpu01.h"    // CPU2_LINK
+
+// Definitions for the sample blocks
+#define IPC_BLOCK_SLOTS         4               // Blocks in CPU1TOCPU2_DATA, or GS RAM pages
+#if CPU2_LINK == CPU2_LINK_GSRAM
+#define IPC_PAGE_WORDS          0x1000          // One GS RAM block
+#define IPC_PAGE_FIRST_GS       5               // GS5-GS8: Cpu1ToCpu2PageSection in both linker command files
+#define IPC_BLOCK_RECORDS       682             // Records per page: 13.6 ms at 50 kHz, 4092 of 4096 words
+#else
+#define IPC_BLOCK_RECORDS       32              // Records per block: 0.64 ms at 50 kHz
+#endif
+#define IPC_CMD_SAMPLE_BLOCK    0x00020001UL    // uladdress = slot, uldataw1 = records, uldataw2 = block number
+#define IPC_FLAG_CPU2_READY     IPC_FLAG17      // Set by CPU2 once it accepts messages
+#define IPC_FLAG_SCI_GRANTED    IPC_FLAG18      // Set by CPU1 once SCI-A belongs to CPU2
+#define IPC_LINK_INT            IPC_INT0        // IPC interrupt used in both directions
+
+// Definitions for the CPU2 processing
+#define CPU2_FILTER_SHIFT       4               // Low-pass y += (x - y) / 2^4: about 500 Hz at 50 kHz
+#define CPU2_STATS_WINDOW       5000            // Samples per statistics window: 100 ms at 50 kHz
+#define CPU2_SNAPSHOT_TRIES     4               // Copies attempted by Cpu2WindowSnapshot()
+
+// One block of consecutive stream records
+#if CPU2_LINK == CPU2_LINK_GSRAM
+typedef union
+{
+    STREAM_RECORD record[IPC_BLOCK_RECORDS];
+    Uint16 words[IPC_PAGE_WORDS];               // Keeps every page on its own GS RAM block
+} IPC_SAMPLE_BLOCK;
+#else
+typedef struct
+{
+    STREAM_RECORD record[IPC_BLOCK_RECORDS];
+} IPC_SAMPLE_BLOCK;
+#endif
+
+// Statistics of one closed window, per channel (ADC-A..D raw counts)
+typedef struct
+{
+    Uint32 firstTimestamp;                      // Timestamp of the first sample in the window
+    Uint16 min[STREAM_CHANNELS];
+    Uint16 max[STREAM_CHANNELS];
+    Uint16 mean[STREAM_CHANNELS];               // Rounded
+} CPU2_WINDOW;
+
+// Written by CPU2, read by CPU1 and the debugger
+typedef struct
+{
+    Uint32 blocksDone;                          // Blocks released; CPU1 may reuse their slots
+    Uint32 samples;                             // Samples processed
+    Uint32 lostSamples;                         // Timestamp gaps seen by CPU2
+    Uint32 badMessages;                         // Unknown commands or slot numbers
+    Uint16 filtered[STREAM_CHANNELS];           // Low-pass output of the newest sample, raw counts
+    Uint16 sequence;                            // Odd while window is being written
+    Uint32 windows;                             // Closed windows
+    CPU2_WINDOW window;                         // Last closed window
+} CPU2_STATUS;
+
+// CPU1 side counters
+typedef struct
+{
+    Uint32 blocksSent;                          // Blocks posted to CPU2
+    Uint32 batches;                             // IPC flags raised for them
+    Uint32 slotsBusy;                           // Passes that stopped because every slot was in use
+    Uint32 putFull;                             // Passes that left blocks unposted because the IPC put buffer was full
+    Uint32 blocksTaken;                         // Blocks CPU2 has taken from the IPC buffer
+    Uint32 latencyLast;                         // SYSCLK cycles from post to take, last block
+    Uint32 latencyMax;                          // Worst case since IpcLinkInit()
+} IPC_LINK_STATS;
+
+extern IPC_SAMPLE_BLOCK IpcBlocks[IPC_BLOCK_SLOTS];     // CPU1TOCPU2_DATA or GS5-GS8
+extern volatile CPU2_STATUS Cpu2Status;                 // CPU2TOCPU1_DATA
+extern volatile IPC_LINK_STATS IpcLinkStats;            // CPU1 side counters
+
+// Function Prototypes
+void IpcLinkInit(void);                                             // CPU1: wait for CPU2, reset the link, enable ipc_link_isr
+interrupt void ipc_link_isr(void);                                  // CPU1: IPC_INT0 from CPU2
+Uint16 IpcLinkSink(const STREAM_RECORD *records, Uint16 count);     // CPU1: StreamSink posting blocks to CPU2
+Uint16 Cpu2WindowSnapshot(CPU2_WINDOW *copy);                       // Consistent copy of Cpu2Status.window
+
+#endif  // end of IPC_LINK_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
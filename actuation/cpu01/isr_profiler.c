@@ -0,0 +1,160 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: isr_profiler.c
+/*
+// File Description:
+// ISR execution time and SOC-to-entry latency statistics. See isr_profiler.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "isr_profiler.h"
+
+// Statistics, kept in their own section so the host finds them at a fixed address
+#pragma DATA_SECTION(IsrProfile, "IsrProfileSection")
+ISR_PROFILE IsrProfile[ISR_PROFILE_COUNT];
+
+#define PROFILE_SNAPSHOT_TRIES  4       // Copies attempted by ProfileSnapshot() before giving up
+
+// log2 bin of a cycle count: the number of significant bits, saturated at the last bin
+static inline Uint16 ProfileBin(Uint32 value)
+{
+    Uint16 bin = 0;
+
+    if (value >= 0x00010000UL)
+    {
+        return PROFILE_HIST_BINS - 1;   // 16 bits or more
+    }
+    if (value >= 0x0100)
+    {
+        value >>= 8;
+        bin += 8;
+    }
+    if (value >= 0x0010)
+    {
+        value >>= 4;
+        bin += 4;
+    }
+    if (value >= 0x0004)
+    {
+        value >>= 2;
+        bin += 2;
+    }
+    if (value >= 0x0002)
+    {
+        value >>= 1;
+        bin += 1;
+    }
+    bin += (Uint16)value;               // 0 or 1 left
+
+    return (bin < PROFILE_HIST_BINS) ? bin : PROFILE_HIST_BINS - 1;
+}
+
+// Clear the statistics of one record, leaving its deadline
+static void ProfileClear(ISR_PROFILE *profile)
+{
+    Uint16 i;
+
+    profile->count = 0;
+    profile->overruns = 0;
+    profile->execMin = 0xFFFFFFFFUL;
+    profile->execMax = 0;
+    profile->execSum = 0;
+    profile->latencyMin = 0xFFFFFFFFUL;
+    profile->latencyMax = 0;
+    profile->latencySum = 0;
+    for (i = 0; i < PROFILE_HIST_BINS; i++)
+    {
+        profile->execHist[i] = 0;
+        profile->latencyHist[i] = 0;
+    }
+    profile->resetRequest = 0;
+}
+
+// Start CPU Timer 1 counting down from 0xFFFFFFFF at SYSCLK, without interrupts
+void ProfileInit(void)
+{
+    InitCpuTimers();                        // All three timers stopped, maximum period, no prescale
+    CpuTimer1Regs.TCR.bit.TIE = 0;          // No timer interrupt, it is only read
+    CpuTimer1Regs.TCR.bit.FREE = 0;         // Stop while the debugger halts the core
+    CpuTimer1Regs.TCR.bit.SOFT = 0;
+    ReloadCpuTimer1();                      // Load 0xFFFFFFFF into TIM
+    StartCpuTimer1();                       // Start counting
+}
+
+// Clear the statistics and set the deadline [SYSCLK cycles]
+void ProfileReset(ISR_PROFILE *profile, Uint32 deadline)
+{
+    profile->sequence++;
+    profile->deadline = deadline;
+    ProfileClear(profile);
+    profile->sequence++;
+}
+
+// Account one ISR call: entryStamp is ProfileStamp() at entry, latency the SOC-to-entry time [SYSCLK cycles]
+void ProfileRecord(ISR_PROFILE *profile, Uint32 entryStamp, Uint32 latency)
+{
+    Uint32 exec = entryStamp - ProfileStamp();  // The timer counts down; wraps after 21 s
+
+    profile->sequence++;                    // Odd: update in progress
+    if (profile->resetRequest != 0)
+    {
+        ProfileClear(profile);
+    }
+
+    profile->count++;
+    if ((exec + latency) > profile->deadline)
+    {
+        profile->overruns++;
+    }
+
+    if (exec < profile->execMin)
+    {
+        profile->execMin = exec;
+    }
+    if (exec > profile->execMax)
+    {
+        profile->execMax = exec;
+    }
+    profile->execSum += exec;
+    profile->execHist[ProfileBin(exec)]++;
+
+    if (latency < profile->latencyMin)
+    {
+        profile->latencyMin = latency;
+    }
+    if (latency > profile->latencyMax)
+    {
+        profile->latencyMax = latency;
+    }
+    profile->latencySum += latency;
+    profile->latencyHist[ProfileBin(latency)]++;
+    profile->sequence++;                    // Even: record consistent
+}
+
+// Copy a record from outside the ISR. Returns 0 if every attempt overlapped an update.
+Uint16 ProfileSnapshot(const ISR_PROFILE *profile, ISR_PROFILE *copy)
+{
+    const volatile ISR_PROFILE *source = profile;
+    Uint16 sequence;
+    Uint16 i;
+
+    for (i = 0; i < PROFILE_SNAPSHOT_TRIES; i++)
+    {
+        sequence = source->sequence;
+        if ((sequence & 1) != 0)
+        {
+            continue;                       // ISR in the middle of an update
+        }
+        *copy = *source;
+        if (source->sequence == sequence)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: isr_profiler.h
+/*
+// File Description:
+// Always-on execution time and jitter statistics for the firmware ISRs.
+//
+// Every profiled ISR takes two stamps on entry:
+//   - CPU Timer 1, free-running down from 0xFFFFFFFF at SYSCLK (5 ns per count), and
+//   - the ePWM2 TBCTR, which restarts from 0 on the SOCA period match, so it already
+//     holds the SOC-to-ISR-entry latency in TBCLK ticks (2 SYSCLK each).
+// This holds for dmach4_isr too: DMA CH4 is triggered by ADCAINT1, which ends the
+// conversions that ePWM2 SOCA started, so ePWM2 is the time base of its trigger as well.
+// ProfileRecord() at the end of the ISR turns them into two cycle counts per call:
+//   execution  CPU Timer 1 cycles from the entry stamp to ProfileRecord()
+//   latency    SYSCLK cycles from the ePWM2 SOCA to the entry stamp
+// For both it keeps min, max, sum (mean = sum / count) and a log2 histogram, and it
+// counts deadline overruns (latency + execution > deadline).
+//
+// Reading the statistics without halting the core:
+// IsrProfile[] lives in its own section (IsrProfileSection, GS RAM) so its address is
+// fixed in the .map file. With DBGM cleared (ERTM in main) CCS reads it in real-time
+// mode, e.g. Expressions window with continuous refresh, or a DSS script. The ISR
+// brackets every update with two increments of 'sequence': a reader copies the record,
+// and retries if 'sequence' was odd or changed during the copy. Writing 1 to
+// 'resetRequest' clears the statistics at the next call; 'deadline' is kept.
+//
+// CPU Timer 1 stops while the core is halted by the debugger (FREE = SOFT = 0), so
+// breakpoints and single stepping do not show up as execution time.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef ISR_PROFILER_H
+#define ISR_PROFILER_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+
+// Profiled ISRs, index into IsrProfile[]
+#define ISR_PROFILE_ADCA1       0       // adca1_isr, once per ADC sample
+#define ISR_PROFILE_DMACH4      1       // dmach4_isr, once per DMA half-buffer
+#define ISR_PROFILE_COUNT       2       // Number of profiled ISRs
+
+// Definitions for the statistics
+#define PROFILE_HIST_BINS       16      // Bin n counts values of n significant bits: 0, 1, 2-3, 4-7, ... >= 16384
+#define PROFILE_CYCLES_PER_TBCLK 2      // ePWM2 TBCLK = EPWMCLK = SYSCLK/2
+
+// Statistics of one ISR, all times in SYSCLK cycles
+typedef struct
+{
+    volatile Uint16 sequence;           // Odd while the ISR updates the record
+    volatile Uint16 resetRequest;       // Set to 1 (host or main loop) to clear the statistics
+    Uint32 deadline;                    // Latency + execution budget, overruns counted against it
+    Uint32 count;                       // Profiled calls
+    Uint32 overruns;                    // Calls that missed the deadline
+    Uint32 execMin;                     // Shortest execution time
+    Uint32 execMax;                     // Longest execution time
+    Uint64 execSum;                     // Sum of execution times
+    Uint32 latencyMin;                  // Shortest SOC-to-entry latency
+    Uint32 latencyMax;                  // Longest SOC-to-entry latency
+    Uint64 latencySum;                  // Sum of SOC-to-entry latencies
+    Uint32 execHist[PROFILE_HIST_BINS];     // log2 histogram of execution times
+    Uint32 latencyHist[PROFILE_HIST_BINS];  // log2 histogram of SOC-to-entry latencies
+} ISR_PROFILE;
+
+extern ISR_PROFILE IsrProfile[ISR_PROFILE_COUNT];   // Statistics, read by the host in real-time mode
+
+// Function Prototypes
+void ProfileInit(void);                                 // Start CPU Timer 1 as the free-running cycle counter
+void ProfileReset(ISR_PROFILE *profile, Uint32 deadline);   // Clear the statistics and set the deadline
+void ProfileRecord(ISR_PROFILE *profile, Uint32 entryStamp, Uint32 latency);    // Account one ISR call
+Uint16 ProfileSnapshot(const ISR_PROFILE *profile, ISR_PROFILE *copy);  // Consistent copy outside the ISR, 1 on success
+
+// CPU Timer 1 count, take it first thing in the ISR and pass it to ProfileRecord()
+static inline Uint32 ProfileStamp(void)
+{
+    return ReadCpuTimer1Counter();
+}
+
+#endif  // end of ISR_PROFILER_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,182 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: motor_model.c
+/*
+// File Description:
+// Fixed-step DC motor model. See motor_model.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "motor_model.h"
+#include "scaling.h"            // Input/output conversions follow ScaleTable
+
+#define MOTOR_PI        3.14159265f
+#define MOTOR_DAC_MAX   4095            // 12-bit DAC full scale
+
+MOTOR_PARAMS MotorParams;
+MOTOR_CONFIG MotorConfig;
+MOTOR_STATE MotorState;
+
+// Computed by MotorReset(), so MotorStep() does not divide
+static float32 invL;                    // 1/L
+static float32 invJ;                    // 1/J
+static float32 invStiction;             // 1/MOTOR_STICTION_SPEED
+static float32 dutyPerCount;            // ADC-B count -> duty fraction
+static float32 torquePerCount;          // ADC-D count -> Nm
+static float32 speedCounts;             // rad/s -> DAC-A counts
+static float32 currentCounts;           // A -> DAC-B counts
+static float32 currentCarry;            // Low-order part of the current lost by the last update
+static float32 speedCarry;              // Low-order part of the speed lost by the last update
+
+// Armature and shaft equations for one state
+static inline void MotorDerivative(float32 i, float32 w, float32 *di, float32 *dw)
+{
+    float32 friction = w * invStiction;
+
+    if (friction > 1.0f)
+    {
+        friction = 1.0f;
+    }
+    else if (friction < -1.0f)
+    {
+        friction = -1.0f;
+    }
+    *di = (MotorState.voltage - MotorParams.r * i - MotorParams.ke * w) * invL;
+    *dw = (MotorParams.kt * i - MotorParams.b * w - MotorParams.tc * friction - MotorState.loadTorque) * invJ;
+}
+
+// Add a step increment to a state variable with compensated (Kahan) summation. Near steady
+// state the increment drops below half an LSB of the state and a plain add would stall.
+static inline float32 MotorAccumulate(float32 x, float32 dx, float32 *carry)
+{
+    float32 y = dx - *carry;
+    float32 t = x + y;
+
+    *carry = (t - x) - y;
+    return t;
+}
+
+// Load the default motor and integrator for steps of dt seconds, motor at rest
+void MotorInit(float32 dt)
+{
+    MotorParams.r = 8.0f;
+    MotorParams.l = 4.0e-3f;
+    MotorParams.kt = 0.08f;
+    MotorParams.ke = 0.08f;
+    MotorParams.j = 1.0e-4f;
+    MotorParams.b = 1.0e-5f;
+    MotorParams.tc = 2.0e-3f;
+    MotorParams.vdc = 48.0f;
+
+    MotorConfig.integrator = MOTOR_RK4;
+    MotorConfig.dt = dt;
+    MotorReset();
+}
+
+// Stop the motor and recompute the constants from MotorParams and ScaleTable. Not safe
+// against a running MotorStep(): call it with the ADC interrupt disabled.
+void MotorReset(void)
+{
+    invL = 1.0f / MotorParams.l;
+    invJ = 1.0f / MotorParams.j;
+    invStiction = 1.0f / MOTOR_STICTION_SPEED;
+    dutyPerCount = ScaleTable[SCALE_CH_DUTY].gain * 1.0e-4f;       // [0.01 %] per count
+    torquePerCount = ScaleTable[SCALE_CH_TORQUE].gain * 1.0e-4f;   // [0.1 mNm] per count
+    speedCounts = 10.0f / ScaleTable[SCALE_CH_SPEED].gain;         // [0.1 rad/s] per count
+    currentCounts = 1000.0f / ScaleTable[SCALE_CH_CURRENT].gain;   // [mA] per count
+
+    MotorState.current = 0.0f;
+    MotorState.speed = 0.0f;
+    MotorState.angle = 0.0f;
+    MotorState.voltage = 0.0f;
+    MotorState.loadTorque = 0.0f;
+    MotorState.steps = 0;
+    currentCarry = 0.0f;
+    speedCarry = 0.0f;
+}
+
+// Advance the model by MotorConfig.dt with the inputs held over the step
+void MotorStep(Uint16 dutyRaw, Uint16 torqueRaw)
+{
+    float32 dt = MotorConfig.dt;
+    float32 i = MotorState.current;
+    float32 w = MotorState.speed;
+    float32 duty = (float32)((int16)dutyRaw - ScaleTable[SCALE_CH_DUTY].offset) * dutyPerCount;
+    float32 di1, dw1, di2, dw2, di3, dw3, di4, dw4;
+
+    if (duty < 0.0f)
+    {
+        duty = 0.0f;
+    }
+    else if (duty > 1.0f)
+    {
+        duty = 1.0f;
+    }
+    MotorState.voltage = duty * MotorParams.vdc;
+    MotorState.loadTorque = (float32)((int16)torqueRaw - ScaleTable[SCALE_CH_TORQUE].offset) * torquePerCount;
+
+    MotorDerivative(i, w, &di1, &dw1);
+    switch (MotorConfig.integrator)             // di1/dw1 end up as the increments over the step
+    {
+    case MOTOR_RK2:
+        MotorDerivative(i + dt * di1, w + dt * dw1, &di2, &dw2);
+        di1 = 0.5f * dt * (di1 + di2);
+        dw1 = 0.5f * dt * (dw1 + dw2);
+        break;
+
+    case MOTOR_RK4:
+        MotorDerivative(i + 0.5f * dt * di1, w + 0.5f * dt * dw1, &di2, &dw2);
+        MotorDerivative(i + 0.5f * dt * di2, w + 0.5f * dt * dw2, &di3, &dw3);
+        MotorDerivative(i + dt * di3, w + dt * dw3, &di4, &dw4);
+        di1 = (dt / 6.0f) * (di1 + 2.0f * (di2 + di3) + di4);
+        dw1 = (dt / 6.0f) * (dw1 + 2.0f * (dw2 + dw3) + dw4);
+        break;
+
+    default:                            // MOTOR_EULER
+        di1 = dt * di1;
+        dw1 = dt * dw1;
+        break;
+    }
+    i = MotorAccumulate(i, di1, &currentCarry);
+    w = MotorAccumulate(w, dw1, &speedCarry);
+
+    MotorState.angle += 0.5f * dt * (MotorState.speed + w);
+    if (MotorState.angle > MOTOR_PI)
+    {
+        MotorState.angle -= 2.0f * MOTOR_PI;
+    }
+    else if (MotorState.angle < -MOTOR_PI)
+    {
+        MotorState.angle += 2.0f * MOTOR_PI;
+    }
+    MotorState.current = i;
+    MotorState.speed = w;
+    MotorState.steps++;
+}
+
+// Convert one output to a DAC code around the channel offset, rounded and limited
+static Uint16 MotorDacCode(float32 counts, int16 offset)
+{
+    counts += (float32)offset + 0.5f;
+    if (counts < 0.0f)
+    {
+        return 0;
+    }
+    if (counts > (float32)MOTOR_DAC_MAX)
+    {
+        return MOTOR_DAC_MAX;
+    }
+    return (Uint16)counts;
+}
+
+// DAC codes of the present speed (ADC-A scaling) and current (ADC-C scaling)
+void MotorOutputs(Uint16 *speedDac, Uint16 *currentDac)
+{
+    *speedDac = MotorDacCode(MotorState.speed * speedCounts, ScaleTable[SCALE_CH_SPEED].offset);
+    *currentDac = MotorDacCode(MotorState.current * currentCounts, ScaleTable[SCALE_CH_CURRENT].offset);
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
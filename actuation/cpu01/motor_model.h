@@ -0,0 +1,91 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: motor_model.h
+/*
+// File Description:
+// Fixed-step DC motor / actuator model, stepped once per ADC sample from adca1_isr so the
+// board can close the loop without OPAL-RT (DAC_SOURCE = DAC_SOURCE_MODEL).
+//
+// Plant, with armature voltage V = duty * vdc and load torque TL from the inputs:
+//   L di/dt = V - R i - Ke w
+//   J dw/dt = Kt i - B w - Tc sat(w / MOTOR_STICTION_SPEED) - TL
+//   dtheta/dt = w
+// Coulomb friction is smoothed over +-MOTOR_STICTION_SPEED so the fixed step does not
+// chatter around standstill.
+//
+// Inputs come from the same ADC channels the DACs used to forward: ADC-B (DutyCycle,
+// 0..100 %) and ADC-D (LoadTorque, +-0.2 Nm), converted with ScaleTable. Outputs go to
+// the DACs in the scaling of the channels OPAL-RT used to drive: DAC-A = speed as on
+// ADC-A (+-600 rad/s), DAC-B = armature current as on ADC-C (+-2.5 A).
+//
+// Integrators (MotorConfig.integrator, may be changed at run time):
+//   MOTOR_EULER  1 derivative per step, first order
+//   MOTOR_RK2    2 derivatives per step (Heun), second order
+//   MOTOR_RK4    4 derivatives per step, fourth order (default)
+// motorCycles/motorCyclesMax in actuation_cpu01.c hold the measured cost of one step.
+//
+// Default parameters: a 48 V, 0.08 Nm/A motor that reaches 600 rad/s unloaded and
+// 0.2 Nm at 2.5 A, electrical time constant 0.5 ms, mechanical 125 ms. All in float32
+// on the FPU; 1/L and 1/J are computed once by MotorInit(). The state is updated with
+// compensated summation so it does not stall short of steady state in float32.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef MOTOR_MODEL_H
+#define MOTOR_MODEL_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+
+// Integrators
+#define MOTOR_EULER         0           // Forward Euler
+#define MOTOR_RK2           1           // Heun (explicit trapezoid)
+#define MOTOR_RK4           2           // Classical Runge-Kutta
+#define MOTOR_STICTION_SPEED 0.1f       // [rad/s] Coulomb friction ramps in over +-0.1 rad/s
+
+// Motor parameters, SI units
+typedef struct
+{
+    float32 r;                          // Armature resistance [ohm]
+    float32 l;                          // Armature inductance [H]
+    float32 kt;                         // Torque constant [Nm/A]
+    float32 ke;                         // Back-EMF constant [V s/rad]
+    float32 j;                          // Rotor + load inertia [kg m^2]
+    float32 b;                          // Viscous friction [Nm s/rad]
+    float32 tc;                         // Coulomb friction [Nm]
+    float32 vdc;                        // Supply voltage at 100 % duty [V]
+} MOTOR_PARAMS;
+
+// Model configuration, read by MotorStep() on every call
+typedef struct
+{
+    Uint16 integrator;                  // MOTOR_EULER, MOTOR_RK2, MOTOR_RK4
+    float32 dt;                         // Step [s], one ADC sample period
+} MOTOR_CONFIG;
+
+// Model state and outputs
+typedef struct
+{
+    float32 current;                    // Armature current [A]
+    float32 speed;                      // Mechanical speed [rad/s]
+    float32 angle;                      // Shaft angle [rad], wrapped to +-pi
+    float32 voltage;                    // Armature voltage of the last step [V]
+    float32 loadTorque;                 // Load torque of the last step [Nm]
+    Uint32 steps;                       // Steps since MotorInit()
+} MOTOR_STATE;
+
+extern MOTOR_PARAMS MotorParams;        // Change, then call MotorInit()
+extern MOTOR_CONFIG MotorConfig;
+extern MOTOR_STATE MotorState;
+
+// Function Prototypes
+void MotorInit(float32 dt);                             // Default parameters applied, motor at rest
+void MotorReset(void);                                  // Motor at rest, recompute from MotorParams
+void MotorStep(Uint16 dutyRaw, Uint16 torqueRaw);       // Advance one step from raw ADC-B/ADC-D results
+void MotorOutputs(Uint16 *speedDac, Uint16 *currentDac);   // DAC codes of the present speed and current
+
+#endif  // end of MOTOR_MODEL_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: pwm_output.c
+/*
+// File Description:
+// Closed-loop ePWM1/ePWM5 switching stage with optional HRPWM edges. See pwm_output.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "actuation_cpu01.h"    // Build configuration and shared acquisition state
+#include "pwm_output.h"
+
+// Interface of the SFO library: the scale factor it computes and the modules it may
+// calibrate, ePWM[0] unused (PWM_CH in SFO_V8.h)
+int MEP_ScaleFactor;
+volatile struct EPWM_REGS *ePWM[PWM_CH] =
+    {&EPwm1Regs, &EPwm1Regs, &EPwm2Regs, &EPwm3Regs, &EPwm4Regs, &EPwm5Regs, &EPwm6Regs, &EPwm7Regs, &EPwm8Regs};
+
+volatile PWM_STATUS PwmStatus;
+
+// Up-count at TBCLK = EPWMCLK, set on zero, clear on CMPA, CMPA (and CMPAHR) shadow loaded on zero
+static void PwmOutputModule(volatile struct EPWM_REGS *epwm)
+{
+    // Setup TBCLK
+    epwm->TBCTL.bit.CTRMODE = 0;                // Count up
+    epwm->TBPRD = PWM_PERIOD_TICKS - 1;         // Set timer period (10 us at 100 kHz)
+    epwm->TBCTR = 0x0000;                       // Clear counter
+    epwm->TBCTL.bit.HSPCLKDIV = 0;              // TBCLK = EPWMCLK, required for HRPWM
+    epwm->TBCTL.bit.CLKDIV = 0;                 // Set the clock division to 0
+
+    // Setup shadow register load on ZERO
+    epwm->CMPCTL.bit.SHDWAMODE = 0;             // CMPA writes go to the shadow register
+    epwm->CMPCTL.bit.LOADAMODE = 0;             // Shadow to active on CTR = 0
+    epwm->CMPA.all = 0;                         // 0 % until the first command
+
+    // Set actions
+    epwm->AQCTLA.bit.ZRO = 2;                   // Set PWMxA on Zero
+    epwm->AQCTLA.bit.CAU = 1;                   // Clear PWMxA on event A, up count
+
+    EALLOW;                                     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+#if PWM_OUTPUT_MODE == PWM_OUTPUT_HRPWM
+    epwm->HRCNFG.all = 0;                       // Clear all bits first
+    epwm->HRCNFG.bit.EDGMODE = 2;               // MEP on the falling edge of PWMxA
+    epwm->HRCNFG.bit.CTLMODE = 0;               // CMPAHR controls the MEP
+    epwm->HRCNFG.bit.HRLOAD = 0;                // CMPAHR shadow loaded on CTR = 0, with CMPA
+    epwm->HRCNFG.bit.AUTOCONV = 1;              // CMPAHR fraction scaled by HRMSTEP in hardware
+#else
+    epwm->HRCNFG.all = 0;                       // MEP off
+#endif
+    EDIS;                                       // Using EDIS to clear the EALLOW
+}
+
+// ePWM1 runs free and syncs ePWM5 on every period; both start at 0 % duty
+void PwmOutputInit(Uint16 phaseOffset)
+{
+#if PWM_OUTPUT_MODE == PWM_OUTPUT_HRPWM
+    // HRMSTEP must hold a scale factor before the first high-resolution edge
+    do
+    {
+        PwmOutputCalibrate();
+    } while (PwmStatus.sfoStatus == SFO_INCOMPLETE);
+#endif
+
+    PwmOutputModule(&EPwm1Regs);
+    EPwm1Regs.TBCTL.bit.PHSEN = 0;              // Disable phase loading
+    EPwm1Regs.TBPHS.bit.TBPHS = 0x0000;         // Phase is 0
+    EPwm1Regs.TBCTL.bit.SYNCOSEL = 1;           // SYNC output on CTR = 0
+
+    PwmOutputModule(&EPwm5Regs);
+    EPwm5Regs.TBCTL.bit.PHSEN = 1;              // Enable phase loading
+    EPwm5Regs.TBPHS.bit.TBPHS = phaseOffset;    // PWM5 phase offset
+
+    PwmStatus.command = 0;
+    PwmStatus.compare = 0;
+    PwmStatus.updates = 0;
+}
+
+// Convert the command to a CMPA:CMPAHR image and write it to both shadow registers.
+// A 32-bit write updates CMPA and CMPAHR together, so a period never sees half of it.
+void PwmOutputUpdate(Uint16 duty)
+{
+    Uint32 edge;                                // Falling edge in 1/256 TBCLK from CTR = 0
+    Uint32 compare;                             // CMPA in bits 31:16, CMPAHR fraction in bits 15:8
+
+    if (duty > PWM_DUTY_FULL_SCALE)
+    {
+        duty = PWM_DUTY_FULL_SCALE;             // 100 %: CMPA above TBPRD, never cleared
+    }
+    edge = (Uint32)((float32)duty * PWM_EDGE_SCALE + 0.5f);
+
+#if PWM_OUTPUT_MODE == PWM_OUTPUT_HRPWM
+    if ((PwmStatus.hrActive == 1) && (edge >= PWM_HR_EDGE_TICKS * 256UL) &&
+        (edge <= (PWM_PERIOD_TICKS - PWM_HR_EDGE_TICKS) * 256UL))
+    {
+        compare = ((edge >> 8) << 16) | ((edge & 0xFF) << 8);
+    }
+    else
+#endif
+    {
+        compare = ((edge + 0x80) >> 8) << 16;   // Nearest TBCLK
+    }
+
+    EPwm1Regs.CMPA.all = compare;
+    EPwm5Regs.CMPA.all = compare;
+
+    PwmStatus.command = duty;
+    PwmStatus.compare = compare;
+    PwmStatus.updates++;
+}
+
+#if PWM_OUTPUT_MODE == PWM_OUTPUT_HRPWM
+// One SFO() step; a completed calibration has already been written to HRMSTEP by the library
+void PwmOutputCalibrate(void)
+{
+    Uint16 status = SFO();
+
+    if (status == SFO_COMPLETE)
+    {
+        PwmStatus.mepScaleFactor = MEP_ScaleFactor;
+        PwmStatus.calibrations++;
+        PwmStatus.hrActive = 1;
+    }
+    else if (status == SFO_ERROR)
+    {
+        PwmStatus.sfoErrors++;
+        PwmStatus.hrActive = 0;                 // Auto-conversion is not reliable, use whole TBCLK edges
+    }
+    PwmStatus.sfoStatus = status;
+}
+#endif
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
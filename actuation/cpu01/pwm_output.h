@@ -0,0 +1,73 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: pwm_output.h
+/*
+// File Description:
+// Closed-loop switching stage on ePWM1/ePWM5 (PWM_OUTPUT_MODE = PWM_OUTPUT_DUTY or
+// PWM_OUTPUT_HRPWM), emulating the bridge of a real motor drive.
+//
+// Both modules count up at TBCLK = EPWMCLK (100 MHz) with a period of PWM_CARRIER_HZ, set
+// PWMxA on zero and clear it on CMPA. The duty command is in DutyCycle counts (0 to
+// PWM_DUTY_FULL_SCALE = 0 to 100 %, as SCALE_CH_DUTY) and is written to the CMPA shadow
+// register by PwmOutputUpdate(); the shadow is loaded on every CTR = 0, so every period
+// switches on the newest command and a write can never land in the middle of a period.
+// ePWM5 takes the same compare value, phase shifted by the offset given to PwmOutputInit().
+//
+// PWM_OUTPUT_DUTY places the falling edge on the nearest TBCLK (10 ns).
+// PWM_OUTPUT_HRPWM adds the fractional part in CMPAHR with automatic conversion, so the
+// MEP places the edge to within one micro step (~150-180 ps). The MEP scale factor comes
+// from the SFO V8 library (SFO_V8.h, link SFO_v8_fpu_lib_build_c28.lib from the F2837xD
+// support library): PwmOutputInit() runs it to completion before the first edge and
+// PwmOutputCalibrate() must be called from the background loop to follow temperature and
+// voltage drift. The MEP is not active in the first and last PWM_HR_EDGE_TICKS of a period,
+// so edges there fall back to the nearest TBCLK, as they do after an SFO error.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef PWM_OUTPUT_H
+#define PWM_OUTPUT_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+#include "SFO_V8.h"             // Scale factor optimizer: SFO(), SFO_INCOMPLETE/SFO_COMPLETE/SFO_ERROR
+
+// Definitions for the carrier
+#ifndef PWM_CARRIER_HZ
+#define PWM_CARRIER_HZ          100000UL    // Switching frequency
+#endif
+#define PWM_TBCLK_HZ            100000000UL // TBCLK = EPWMCLK = SYSCLK/2, required by the HRPWM
+#define PWM_PERIOD_TICKS        (PWM_TBCLK_HZ / PWM_CARRIER_HZ)     // TBCLK ticks per period: 1000 = 10 us
+#if (PWM_PERIOD_TICKS > 0x10000UL) || (PWM_PERIOD_TICKS < 32)
+#error "PWM_CARRIER_HZ out of range for a 16-bit up-count period at 100 MHz"
+#endif
+
+// Definitions for the duty command
+#define PWM_DUTY_FULL_SCALE     4095        // DutyCycle count for 100 %
+#define PWM_EDGE_SCALE          ((float32)PWM_PERIOD_TICKS * 256.0f / (float32)PWM_DUTY_FULL_SCALE)   // 1/256 TBCLK per count
+#define PWM_HR_EDGE_TICKS       3           // TBCLK ticks at each end of the period without MEP
+
+// State and counters, readable by the host
+typedef struct
+{
+    Uint16 command;                     // Last duty command [DutyCycle counts]
+    Uint32 compare;                     // Last CMPA:CMPAHR written to ePWM1/ePWM5
+    Uint32 updates;                     // Commands written
+    Uint16 hrActive;                    // 1 while CMPAHR is used (PWM_OUTPUT_HRPWM, MEP scale factor valid)
+    Uint16 sfoStatus;                   // Result of the last SFO() call, SFO_INCOMPLETE/SFO_COMPLETE/SFO_ERROR
+    Uint16 mepScaleFactor;              // MEP steps per TBCLK from the last completed calibration
+    Uint32 calibrations;                // Completed SFO() calibrations
+    Uint32 sfoErrors;                   // SFO() calls that returned SFO_ERROR
+} PWM_STATUS;
+
+extern volatile PWM_STATUS PwmStatus;
+
+// Function Prototypes
+void PwmOutputInit(Uint16 phaseOffset);     // ePWM1/ePWM5 at PWM_CARRIER_HZ, 0 % duty, MEP calibrated in PWM_OUTPUT_HRPWM
+void PwmOutputUpdate(Uint16 duty);          // Duty command for the next period, in DutyCycle counts
+void PwmOutputCalibrate(void);              // One SFO() step from the background loop (PWM_OUTPUT_HRPWM)
+
+#endif  // end of PWM_OUTPUT_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,208 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: qep_encoder.c
+/*
+// File Description:
+// eQEP1 quadrature encoder position and speed estimation. See qep_encoder.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "actuation_cpu01.h"    // Build configuration and shared acquisition state
+#include "qep_encoder.h"
+
+#define QEP_PI              3.14159265f
+#define QEP_STS_CDEF        0x0004      // QEPSTS: capture direction error, write 1 to clear
+#define QEP_STS_COEF        0x0008      // QEPSTS: capture overflow error, write 1 to clear
+#define QEP_STS_QDF         0x0020      // QEPSTS: 1 = counting up
+#define QEP_STS_UPEVNT      0x0080      // QEPSTS: unit position event, write 1 to clear
+#define QEP_STS_CLEAR       (QEP_STS_CDEF | QEP_STS_COEF | QEP_STS_UPEVNT)
+
+volatile QEP_STATUS QepStatus;
+
+static Uint32 lastCount;                // QPOSCNT of the last sample
+static int32 rawPosition;               // Counts since QepEncoderInit()
+static int32 homeOffset;                // rawPosition at position 0
+static int32 window[QEP_WINDOW];        // rawPosition of the last QEP_WINDOW samples, oldest at windowHead
+static Uint16 windowHead;
+static Uint16 lastPeriod;               // Last valid capture period [CAPCLK], 0 = none
+static Uint16 discard;                  // The next capture period spans an overflow or a direction change
+static float32 unitScale;               // [rad/s] per count in the window
+static float32 captureScale;            // [rad/s] times CAPCLK ticks per unit period
+
+// A difference of counter values taken to -QEP_COUNTS_PER_REV/2 .. +QEP_COUNTS_PER_REV/2
+static int32 QepWrap(int32 counts)
+{
+    counts %= (int32)QEP_COUNTS_PER_REV;
+    if (counts > (int32)(QEP_COUNTS_PER_REV / 2))
+    {
+        counts -= (int32)QEP_COUNTS_PER_REV;
+    }
+    else if (counts < -(int32)(QEP_COUNTS_PER_REV / 2))
+    {
+        counts += (int32)QEP_COUNTS_PER_REV;
+    }
+    return counts;
+}
+
+// 4x quadrature count over one revolution, index latched, capture unit timing QEP_UNIT_COUNTS counts
+void QepEncoderInit(float32 samplePeriod)
+{
+    Uint16 i;
+
+    InitEQep1Gpio();                            // GPIO20-23: EQEP1A, EQEP1B, EQEP1S, EQEP1I
+
+    EQep1Regs.QEPCTL.all = 0x0000;              // Counter stopped while configuring
+    EQep1Regs.QCAPCTL.all = 0x0000;             // Capture unit stopped while configuring
+    EQep1Regs.QEINT.all = 0x0000;               // No interrupts: adca1_isr reads the module on every sample
+    EQep1Regs.QCLR.all = 0xFFFF;                // Clear all interrupt flags
+
+    // Quadrature decoder
+    EQep1Regs.QDECCTL.all = 0x0000;
+    EQep1Regs.QDECCTL.bit.QSRC = 0;             // Quadrature count mode
+    EQep1Regs.QDECCTL.bit.XCR = 0;              // Count both edges of QEPA and QEPB: 4 counts per line
+
+    // Position counter: one revolution, the index is latched but does not reset it
+    EQep1Regs.QPOSINIT = 0;
+    EQep1Regs.QPOSMAX = QEP_COUNTS_PER_REV - 1;
+    EQep1Regs.QPOSCNT = 0;
+    EQep1Regs.QEPCTL.bit.FREE_SOFT = 2;         // Keep counting through emulation halts
+    EQep1Regs.QEPCTL.bit.PCRM = 1;              // Wrap at QPOSMAX, so a lost count cannot move the revolution boundary
+    EQep1Regs.QEPCTL.bit.IEI = 0;               // The index does not initialize the counter
+    EQep1Regs.QEPCTL.bit.IEL = 1;               // Latch QPOSCNT in QPOSILAT on the rising edge of the index
+    EQep1Regs.QEPCTL.bit.QCLM = 0;              // Reading QPOSCNT latches QCTMR and QCPRD
+    EQep1Regs.QEPCTL.bit.UTE = 0;               // The ADC sample is the unit time, the unit timer is not used
+    EQep1Regs.QEPCTL.bit.WDE = 0;               // No watchdog: a stopped encoder is seen by the capture timer
+
+    // Capture unit
+    EQep1Regs.QCAPCTL.bit.UPPS = QEP_UNIT_PRESCALE;     // Unit position event every QEP_UNIT_COUNTS counts
+    EQep1Regs.QCAPCTL.bit.CCPS = QEP_CAP_PRESCALE;      // CAPCLK = SYSCLK / 2^QEP_CAP_PRESCALE
+    EQep1Regs.QCAPCTL.bit.CEN = 1;              // Enable the capture unit
+    EQep1Regs.QEPSTS.all = QEP_STS_CLEAR;       // Clear the capture flags
+
+    lastCount = 0;
+    rawPosition = 0;
+    homeOffset = 0;
+    for (i = 0; i < QEP_WINDOW; i++)
+    {
+        window[i] = 0;
+    }
+    windowHead = 0;
+    lastPeriod = 0;
+    discard = 1;                                // The first period starts at the enable, not at an event
+    unitScale = 2.0f * QEP_PI / ((float32)QEP_COUNTS_PER_REV * (float32)QEP_WINDOW * samplePeriod);
+    captureScale = 2.0f * QEP_PI * (float32)QEP_UNIT_COUNTS * QEP_CAPCLK_HZ / (float32)QEP_COUNTS_PER_REV;
+
+    QepStatus.position = 0;
+    QepStatus.turns = 0;
+    QepStatus.angle = 0;
+    QepStatus.speed = 0.0f;
+    QepStatus.speedScaled = 0;
+    QepStatus.speedUnit = 0.0f;
+    QepStatus.speedCapture = 0.0f;
+    QepStatus.method = QEP_METHOD_CAPTURE;
+    QepStatus.homed = 0;
+    QepStatus.indexEvents = 0;
+    QepStatus.indexErrors = 0;
+    QepStatus.samples = 0;
+
+    EQep1Regs.QEPCTL.bit.QPEN = 1;              // Start counting
+}
+
+// One sample: position from the counter and the index, both speed estimates, the one in use
+void QepEncoderSample(void)
+{
+    Uint32 count = EQep1Regs.QPOSCNT;           // Also latches QCTMRLAT/QCPRDLAT
+    Uint16 status = EQep1Regs.QEPSTS.all;
+    Uint16 timer = EQep1Regs.QCTMRLAT;          // CAPCLK since the last unit event
+    Uint16 period = EQep1Regs.QCPRDLAT;         // CAPCLK between the last two unit events
+    int32 atIndex;                              // rawPosition at which the index came
+    int32 slip;                                 // Counts lost (-) or gained (+) since the last index
+    int32 position;
+    Uint16 ticks;
+    float32 speed;
+    float32 fast;
+
+    // Multi-turn position: the samples are far less than half a revolution apart
+    rawPosition += QepWrap((int32)count - (int32)lastCount);
+    lastCount = count;
+
+    // Index: every one after the first must be a whole number of revolutions from position 0
+    if (EQep1Regs.QFLG.bit.IEL == 1)
+    {
+        atIndex = rawPosition - QepWrap((int32)count - (int32)EQep1Regs.QPOSILAT);
+        if (QepStatus.homed == 0)
+        {
+            homeOffset = atIndex;
+            QepStatus.homed = 1;
+        }
+        else
+        {
+            slip = QepWrap(atIndex - homeOffset);
+            if (slip != 0)
+            {
+                homeOffset += slip;             // The index is right, the count was not
+                QepStatus.indexErrors++;
+            }
+        }
+        QepStatus.indexEvents++;
+        EQep1Regs.QCLR.bit.IEL = 1;
+    }
+    position = rawPosition - homeOffset;
+    QepStatus.position = position;
+    QepStatus.turns = (position >= 0) ? position / (int32)QEP_COUNTS_PER_REV :
+                                        -((-position - 1) / (int32)QEP_COUNTS_PER_REV) - 1;
+    QepStatus.angle = (Uint32)(position - QepStatus.turns * (int32)QEP_COUNTS_PER_REV);
+
+    // Unit time: counts over the window, independent of the index corrections
+    QepStatus.speedUnit = (float32)(rawPosition - window[windowHead]) * unitScale;
+    window[windowHead] = rawPosition;
+    if (++windowHead >= QEP_WINDOW)
+    {
+        windowHead = 0;
+    }
+
+    // Capture timer: the last valid unit period, or the time since the last event once that is longer
+    if ((status & (QEP_STS_COEF | QEP_STS_CDEF)) != 0)
+    {
+        lastPeriod = 0;                         // Too slow to time, or turning round
+        discard = ((status & QEP_STS_UPEVNT) == 0) ? 1 : 0;     // An event latched with the error has the bad period
+        EQep1Regs.QEPSTS.all = QEP_STS_CLEAR;
+    }
+    else if ((status & QEP_STS_UPEVNT) != 0)
+    {
+        lastPeriod = (discard == 1) ? 0 : period;
+        discard = 0;
+        EQep1Regs.QEPSTS.all = QEP_STS_UPEVNT;
+    }
+    ticks = (timer > lastPeriod) ? timer : lastPeriod;
+    if (lastPeriod == 0)
+    {
+        QepStatus.speedCapture = 0.0f;
+    }
+    else
+    {
+        speed = captureScale / (float32)ticks;
+        QepStatus.speedCapture = ((status & QEP_STS_QDF) != 0) ? speed : -speed;
+    }
+
+    // Estimate in use, with hysteresis between the two thresholds
+    fast = (QepStatus.speedUnit < 0.0f) ? -QepStatus.speedUnit : QepStatus.speedUnit;
+    if (fast > QEP_SPEED_FAST)
+    {
+        QepStatus.method = QEP_METHOD_UNIT;
+    }
+    else if (fast < QEP_SPEED_SLOW)
+    {
+        QepStatus.method = QEP_METHOD_CAPTURE;
+    }
+    speed = (QepStatus.method == QEP_METHOD_UNIT) ? QepStatus.speedUnit : QepStatus.speedCapture;
+    QepStatus.speed = speed;
+    speed *= 10.0f;                             // [0.1 rad/s]
+    QepStatus.speedScaled = (speed >= 32767.0f) ? 32767 : (speed <= -32767.0f) ? -32767 : (int16)speed;
+    QepStatus.samples++;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,92 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: qep_encoder.h
+/*
+// File Description:
+// Motor speed and position from a quadrature encoder on eQEP1 (SPEED_INPUT = SPEED_INPUT_QEP),
+// in place of the analog speed on ADC-A2 (0.293 rad/s per count).
+//
+// EQEP1A, EQEP1B and EQEP1I come in on GPIO20, 21 and 23 (InitEQep1Gpio(), which also
+// takes GPIO22 for the unused strobe). Every edge of A and B is counted, so a QEP_LINES
+// encoder gives QEP_COUNTS_PER_REV counts per revolution; the position counter wraps at one
+// revolution. QepEncoderSample() is called from adca1_isr on every sample. Its read of
+// QPOSCNT also latches the capture timer, so all of one sample is taken at once.
+//
+// Position: the change of the counter since the last sample is added to a 32-bit multi-turn
+// position. The first index pulse defines position 0. Every later index must come a whole
+// number of revolutions from it: if it does not, counts were lost or gained (noise, a
+// missing edge), indexErrors is incremented and the position is corrected on the spot.
+//
+// Speed, two estimates on every sample:
+//   Unit time (M method): counts over the last QEP_WINDOW samples. The error is one count
+//       per window, small at high speed.
+//   Capture timer (T method): the capture unit times QEP_UNIT_COUNTS counts with CAPCLK =
+//       SYSCLK / 2^QEP_CAP_PRESCALE. The error is one CAPCLK per unit period, small at low
+//       speed. If no unit event has come for longer than the last period, the estimate falls
+//       as the elapsed time grows, so a stopping motor reads as slowing down. A timer
+//       overflow (slower than QEP_UNIT_COUNTS counts per 65536 CAPCLK, 0.15 rad/s) or a
+//       direction change between unit events gives 0 until the next valid period.
+// The unit-time estimate is published above QEP_SPEED_FAST and the capture-timer estimate
+// below QEP_SPEED_SLOW; in between, the one in use stays. With the defaults both errors are
+// equal at about 170 rad/s.
+//
+// QepStatus is published on every sample. The capture buffer mmSpeed[] takes speedScaled
+// in [0.1 rad/s], the unit of SCALE_CH_SPEED, instead of ADC-A.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef QEP_ENCODER_H
+#define QEP_ENCODER_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+
+// Definitions for the encoder
+#ifndef QEP_LINES
+#define QEP_LINES           1024        // Encoder lines per revolution
+#endif
+#define QEP_COUNTS_PER_REV  (4UL * QEP_LINES)   // Edges of A and B per revolution
+#if (QEP_COUNTS_PER_REV > 0x10000UL) || (QEP_COUNTS_PER_REV < 16)
+#error "QEP_LINES out of range"
+#endif
+
+// Definitions for the speed estimation
+#define QEP_WINDOW          25          // Samples per unit-time estimate: 0.5 ms at 50 kHz
+#define QEP_UNIT_PRESCALE   2           // UPPS: one unit position event every 4 counts
+#define QEP_UNIT_COUNTS     (1U << QEP_UNIT_PRESCALE)
+#define QEP_CAP_PRESCALE    7           // CCPS: CAPCLK = SYSCLK / 128 = 640 ns
+#define QEP_CAPCLK_HZ       (200000000.0f / (float32)(1U << QEP_CAP_PRESCALE))
+#define QEP_SPEED_FAST      150.0f      // [rad/s] Unit-time estimate from here up
+#define QEP_SPEED_SLOW      100.0f      // [rad/s] Capture-timer estimate from here down
+
+#define QEP_METHOD_CAPTURE  0           // QepStatus.speed is the capture-timer estimate
+#define QEP_METHOD_UNIT     1           // QepStatus.speed is the unit-time estimate
+
+// Position and speed of the last sample, readable by the host
+typedef struct
+{
+    int32 position;                     // Counts from the first index (from startup until it comes), multi-turn
+    int32 turns;                        // Whole revolutions in position, rounded toward minus infinity
+    Uint32 angle;                       // Counts into the current revolution, 0..QEP_COUNTS_PER_REV-1
+    float32 speed;                      // Estimate in use [rad/s]
+    int16 speedScaled;                  // speed in [0.1 rad/s], as SCALE_CH_SPEED
+    float32 speedUnit;                  // Unit-time estimate [rad/s]
+    float32 speedCapture;               // Capture-timer estimate [rad/s]
+    Uint16 method;                      // QEP_METHOD_CAPTURE or QEP_METHOD_UNIT
+    Uint16 homed;                       // 1 once the first index has been seen
+    Uint32 indexEvents;                 // Index pulses seen
+    Uint32 indexErrors;                 // Index pulses that were not a whole number of revolutions from the first
+    Uint32 samples;                     // QepEncoderSample() calls
+} QEP_STATUS;
+
+extern volatile QEP_STATUS QepStatus;
+
+// Function Prototypes
+void QepEncoderInit(float32 samplePeriod);  // eQEP1 counting and capturing, position 0, samplePeriod in s
+void QepEncoderSample(void);                // Read eQEP1 and publish QepStatus, from adca1_isr on every sample
+
+#endif  // end of QEP_ENCODER_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
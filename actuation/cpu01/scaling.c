@@ -0,0 +1,25 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: scaling.c
+/*
+// File Description:
+// Default gain/offset descriptors for the four acquisition channels. The inputs
+// span {0.0, 3.0} [V] = {0, 4095} counts with the ADC references; bipolar
+// quantities are centered on count 2048.
+// -----------------------------------------------------------------------------
+ */
+
+#include "scaling.h"
+
+SCALE_CHANNEL ScaleTable[SCALE_NUM_CHANNELS] =
+{
+    { 2.93f, 2048 },                // SCALE_CH_SPEED:   0.293 rad/s per count  -> [0.1 rad/s]
+    { 2.442f, 0 },                  // SCALE_CH_DUTY:    100 % / 4095 counts    -> [0.01 %]
+    { 1.22f, 2048 },                // SCALE_CH_CURRENT: 0.00122 A per count    -> [mA]
+    { 0.977f, 2048 },               // SCALE_CH_TORQUE:  0.2 Nm / 2048 counts   -> [0.1 mNm]
+};
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
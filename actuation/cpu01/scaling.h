@@ -0,0 +1,55 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: scaling.h
+/*
+// File Description:
+// Per-channel gain/offset descriptors used to convert raw 12-bit ADC counts into
+// signed engineering units inside adca1_isr.
+//
+// The conversion is evaluated in single-precision float on the C28x FPU32
+// (I16TOF32, MPYF32, F32TOI16), so no double-precision run-time support routines
+// are pulled into the ISR. It needs neither IQmath nor TMU, so the code links
+// unchanged against 2837xD_RAM_lnk_cpu1.cmd and the 2837xD_RAM_IQMATH_lnk_cpu1.cmd /
+// 2837xD_RAM_TMU_lnk_cpu1.cmd variants.
+//
+// Result units (int16, truncated toward zero):
+// SCALE_CH_SPEED   Motor Mechanical Speed  [0.1 rad/s]  {-6000, 6000}
+// SCALE_CH_DUTY    Duty Cycle              [0.01 %]     {0, 10000}
+// SCALE_CH_CURRENT Motor Armature Current  [mA]         {-2500, 2500}
+// SCALE_CH_TORQUE  Load Torque             [0.1 mNm]    {-2000, 2000}
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef SCALING_H
+#define SCALING_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+
+// Channel indices into ScaleTable
+#define SCALE_CH_SPEED      0       // ADC-A2 -- mmSpeed
+#define SCALE_CH_DUTY       1       // ADC-B0 -- DutyCycle
+#define SCALE_CH_CURRENT    2       // ADC-C3 -- maCurrent
+#define SCALE_CH_TORQUE     3       // ADC-D3 -- LoadTorque
+#define SCALE_NUM_CHANNELS  4       // Number of scaled channels
+
+// Gain/offset descriptor for one ADC channel: result = gain * (raw - offset)
+typedef struct
+{
+    float32 gain;                   // Engineering units per ADC count
+    int16 offset;                   // ADC count that maps to zero
+} SCALE_CHANNEL;
+
+extern SCALE_CHANNEL ScaleTable[SCALE_NUM_CHANNELS];   // Descriptors, may be retuned at run time
+
+// Convert one raw ADC result with the given descriptor
+static inline int16 ScaleSample(const SCALE_CHANNEL *channel, Uint16 raw)
+{
+    return (int16)(channel->gain * (float32)((int16)raw - channel->offset));
+}
+
+#endif  // end of SCALING_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,264 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: sci_driver.c
+/*
+// File Description:
+// Interrupt driven SCI-A driver with software TX/RX queues. See sci_driver.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "sci_driver.h"
+
+// Data register access (the host build replaces these with its FIFO model)
+#ifndef SCI_TX_WRITE
+#define SCI_TX_WRITE(data)  (SciaRegs.SCITXBUF.all = (data))
+#endif
+#ifndef SCI_RX_READ
+#define SCI_RX_READ()       (SciaRegs.SCIRXBUF.all)
+#endif
+
+#define SCI_TX_MASK         (SCI_TX_QUEUE_SIZE - 1)
+#define SCI_RX_MASK         (SCI_RX_QUEUE_SIZE - 1)
+
+// Software queues, kept out of the 2K-word .ebss
+#pragma DATA_SECTION(sciTxQueue, "SciQueueSection")
+#pragma DATA_SECTION(sciRxQueue, "SciQueueSection")
+static Uint16 sciTxQueue[SCI_TX_QUEUE_SIZE];
+static Uint16 sciRxQueue[SCI_RX_QUEUE_SIZE];
+
+volatile SCI_STATS SciStats;            // SCI-A counters
+
+static volatile Uint16 sciTxHead;       // Next free TX slot, written by SciWrite()
+static volatile Uint16 sciTxTail;       // Next TX byte to send, written by scia_tx_isr()
+static volatile Uint16 sciRxHead;       // Next free RX slot, written by scia_rx_isr()
+static volatile Uint16 sciRxTail;       // Next RX byte to read, written by SciRead()
+
+#ifdef CPU1
+// LSPCLK and pin mux for SCI-A; these registers belong to CPU1, whichever CPU owns SCI-A
+void SciInitPins(void)
+{
+    EALLOW;                             // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    ClkCfgRegs.LOSPCP.bit.LSPCLKDIV = 0;    // LSPCLK = SYSCLK
+
+    // GPIO42 = SCITXDA, GPIO43 = SCIRXDA (mux position 15)
+    GpioCtrlRegs.GPBGMUX1.bit.GPIO42 = 3;
+    GpioCtrlRegs.GPBMUX1.bit.GPIO42 = 3;
+    GpioCtrlRegs.GPBDIR.bit.GPIO42 = 1;
+    GpioCtrlRegs.GPBGMUX1.bit.GPIO43 = 3;
+    GpioCtrlRegs.GPBMUX1.bit.GPIO43 = 3;
+    GpioCtrlRegs.GPBPUD.bit.GPIO43 = 0;     // Pull-up on RX
+    GpioCtrlRegs.GPBQSEL1.bit.GPIO43 = 3;   // Asynchronous input
+    EDIS;                               // Using EDIS to clear the EALLOW
+}
+#endif
+
+// (Re)initialize SCI-A: 8N1, FIFOs on, RX interrupt on, TX interrupt enabled by SciWrite()
+void SciOpen(Uint32 baud, Uint16 loopback)
+{
+    Uint32 brr = (SCI_LSPCLK_HZ / 8 + baud / 2) / baud - 1;    // Rounded to the nearest rate
+
+    if (brr > 0xFFFF)
+    {
+        brr = 0xFFFF;                   // Slowest rate, 381 baud
+    }
+
+#ifdef CPU1
+    SciInitPins();                      // On CPU2 this is done by CPU1 before it hands SCI-A over
+#endif
+    EALLOW;                             // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    CpuSysRegs.PCLKCR7.bit.SCI_A = 1;   // Clock SCI-A
+    EDIS;                               // Using EDIS to clear the EALLOW
+
+    // Disable the interrupts while the queues are reset
+    PieCtrlRegs.PIEIER9.bit.INTx1 = 0;
+    PieCtrlRegs.PIEIER9.bit.INTx2 = 0;
+
+    SciaRegs.SCICTL1.all = 0x0000;          // Hold the SCI in reset
+    SciaRegs.SCICCR.all = 0x0007;           // 1 stop bit, no parity, 8 char bits, idle-line protocol
+    SciaRegs.SCICCR.bit.LOOPBKENA = loopback;
+    SciaRegs.SCIHBAUD.all = (Uint16)(brr >> 8);
+    SciaRegs.SCILBAUD.all = (Uint16)(brr & 0xFF);
+    SciaRegs.SCIFFCT.all = 0x0000;          // No TX delay, no auto baud
+
+    SciaRegs.SCIFFTX.all = 0xC000 | SCI_TX_FIFO_LEVEL;  // SCI reset released, FIFO mode, TX FIFO held in reset, TX interrupt off
+    SciaRegs.SCIFFRX.all = 0x0001;          // RX FIFO held in reset, interrupt at 1 byte
+    SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1;    // Clear stale flags
+    SciaRegs.SCIFFRX.bit.RXFFOVRCLR = 1;
+    SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1;
+    SciaRegs.SCIFFTX.bit.TXFIFORESET = 1;   // Release the FIFOs
+    SciaRegs.SCIFFRX.bit.RXFIFORESET = 1;
+    SciaRegs.SCIFFRX.bit.RXFFIENA = 1;      // RX FIFO interrupt on
+
+    sciTxHead = 0;
+    sciTxTail = 0;
+    sciRxHead = 0;
+    sciRxTail = 0;
+    SciStats.baud = (brr == 0) ? SCI_LSPCLK_HZ / 16 : SCI_LSPCLK_HZ / ((brr + 1) * 8);
+
+    SciaRegs.SCICTL1.all = 0x0023;          // Enable TX, RX, internal SCICLK, relinquish SCI from reset
+
+    // Map and enable the FIFO interrupts
+    EALLOW;                             // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    PieVectTable.SCIA_RX_INT = &scia_rx_isr;    // Function for SCI-A receive FIFO
+    PieVectTable.SCIA_TX_INT = &scia_tx_isr;    // Function for SCI-A transmit FIFO
+    EDIS;                               // Using EDIS to clear the EALLOW
+    PieCtrlRegs.PIEIER9.bit.INTx1 = 1;      // SCIA_RX_INT
+    PieCtrlRegs.PIEIER9.bit.INTx2 = 1;      // SCIA_TX_INT
+    IER |= M_INT9;                          // Enable group 9 interrupts
+}
+
+// Free space in the TX queue [bytes]
+Uint16 SciTxFree(void)
+{
+    return SCI_TX_QUEUE_SIZE - (Uint16)(sciTxHead - sciTxTail);
+}
+
+// 1 once everything queued has left the TX FIFO (the last byte may still be shifting out)
+Uint16 SciTxIdle(void)
+{
+    return (sciTxHead == sciTxTail) && (SciaRegs.SCIFFTX.bit.TXFFST == 0);
+}
+
+// Queue up to count bytes without waiting; returns the number queued
+Uint16 SciWrite(const Uint16 *data, Uint16 count)
+{
+    Uint16 head = sciTxHead;
+    Uint16 space = SciTxFree();
+    Uint16 i;
+
+    if (count > space)
+    {
+        SciStats.txQueueFull += count - space;
+        count = space;
+    }
+    for (i = 0; i < count; i++)
+    {
+        sciTxQueue[head & SCI_TX_MASK] = data[i] & 0x00FF;
+        head++;
+    }
+    sciTxHead = head;                       // Publish the bytes to scia_tx_isr()
+
+    if (count != 0)
+    {
+        SciaRegs.SCIFFTX.bit.TXFFIENA = 1;  // Fires at once if the FIFO is at or below its level
+    }
+    return count;
+}
+
+// Take up to count received bytes without waiting; returns the number taken
+Uint16 SciRead(Uint16 *data, Uint16 count)
+{
+    Uint16 tail = sciRxTail;
+    Uint16 taken = 0;
+
+    while ((taken < count) && (tail != sciRxHead))
+    {
+        data[taken++] = sciRxQueue[tail & SCI_RX_MASK];
+        tail++;
+    }
+    sciRxTail = tail;                       // Release the slots to scia_rx_isr()
+    return taken;
+}
+
+// Send SCI_TEST_LENGTH bytes in internal loopback mode and check what comes back.
+// Reopens SCI-A in loopback mode; call SciOpen() afterwards for normal operation.
+Uint16 SciLoopbackTest(Uint32 baud)
+{
+    Uint16 pattern[SCI_TEST_LENGTH];        // Bytes sent
+    Uint16 echo[SCI_TEST_LENGTH];           // Bytes received
+    Uint16 received = 0;
+    Uint32 polls;                           // 10 us polls allowed: SCI_TEST_MARGIN times the line time, plus 100 us
+    Uint32 wait;
+    Uint16 i;
+
+    SciOpen(baud, 1);
+    for (i = 0; i < SCI_TEST_LENGTH; i++)
+    {
+        pattern[i] = (i * 37 + 0x55) & 0x00FF;  // Every bit position toggles
+    }
+    SciWrite(pattern, SCI_TEST_LENGTH);
+
+    polls = (SCI_TEST_LENGTH * 10UL * SCI_TEST_MARGIN * 100000UL) / baud + 10;
+    for (wait = 0; (wait < polls) && (received < SCI_TEST_LENGTH); wait++)
+    {
+        DELAY_US(10);                       // Let the interrupts move the bytes
+        received += SciRead(&echo[received], SCI_TEST_LENGTH - received);
+    }
+
+    SciStats.loopback = SCI_TEST_PASS;
+    if (received != SCI_TEST_LENGTH)
+    {
+        SciStats.loopback = SCI_TEST_FAIL;
+    }
+    for (i = 0; i < received; i++)
+    {
+        if (echo[i] != pattern[i])
+        {
+            SciStats.loopback = SCI_TEST_FAIL;
+        }
+    }
+    return SciStats.loopback;
+}
+
+// TX FIFO at or below SCI_TX_FIFO_LEVEL: top it up from the queue
+interrupt void scia_tx_isr(void)
+{
+    Uint16 tail = sciTxTail;
+    Uint16 head = sciTxHead;
+    Uint16 space = SCI_FIFO_DEPTH - SciaRegs.SCIFFTX.bit.TXFFST;
+    Uint16 sent = 0;
+
+    while ((sent < space) && (tail != head))
+    {
+        SCI_TX_WRITE(sciTxQueue[tail & SCI_TX_MASK]);
+        tail++;
+        sent++;
+    }
+    sciTxTail = tail;
+    SciStats.txBytes += sent;
+
+    if (tail == head)
+    {
+        SciaRegs.SCIFFTX.bit.TXFFIENA = 0;  // Queue empty, SciWrite() re-enables
+    }
+
+    SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1;    // Clear the TX FIFO interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge PIE group 9 to enable further interrupts
+}
+
+// RX FIFO holds at least one byte: move everything into the queue
+interrupt void scia_rx_isr(void)
+{
+    Uint16 head = sciRxHead;
+    Uint16 data;
+
+    while (SciaRegs.SCIFFRX.bit.RXFFST != 0)
+    {
+        data = SCI_RX_READ() & 0x00FF;      // Drop the FE/PE flags in the upper byte
+        if ((Uint16)(head - sciRxTail) >= SCI_RX_QUEUE_SIZE)
+        {
+            SciStats.rxQueueDrops++;        // SciRead() not keeping up
+        }
+        else
+        {
+            sciRxQueue[head & SCI_RX_MASK] = data;
+            head++;
+            SciStats.rxBytes++;
+        }
+    }
+    sciRxHead = head;
+
+    if (SciaRegs.SCIFFRX.bit.RXFFOVF == 1)
+    {
+        SciStats.rxFifoOverflows++;         // Bytes lost in hardware
+        SciaRegs.SCIFFRX.bit.RXFFOVRCLR = 1;
+    }
+
+    SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1;    // Clear the RX FIFO interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge PIE group 9 to enable further interrupts
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: sci_driver.h
+/*
+// File Description:
+// Non-blocking, interrupt driven SCI-A driver for telemetry (SCI_MODE = SCI_ON).
+//
+// Unlike F2837xD_sci_io.c (9600 baud, busy-waits on TXRDY/RXRDY per character), this
+// driver never waits:
+//   - LSPCLK runs at SYSCLK (200 MHz), so baud rates up to 12.5 Mbaud can be set;
+//     SCI_BAUD (default 5 Mbaud) is converted to BRR = LSPCLK / (8 * baud) - 1.
+//   - SciWrite() copies as many bytes as fit into a software TX queue and returns.
+//     The TX FIFO interrupt (SCIA_TX_INT, PIE 9.2) fires whenever the 16-level
+//     FIFO has drained to SCI_TX_FIFO_LEVEL and refills it from the queue. It is
+//     disabled while the queue is empty.
+//   - The RX FIFO interrupt (SCIA_RX_INT, PIE 9.1) moves received bytes into an RX
+//     queue which SciRead() empties. RX is meant for short commands, so it
+//     interrupts on every byte (the SCI FIFO has no receive timeout).
+// The F2837xD DMA has no SCI trigger source, so the FIFO interrupt is the cheapest
+// way to feed the transmitter: one interrupt per SCI_FIFO_DEPTH - SCI_TX_FIFO_LEVEL bytes.
+//
+// Bytes are held one per Uint16 word, as everywhere on the C28x.
+//
+// SciLoopbackTest() runs a pattern through the SCI in internal loopback mode
+// (SCICCR.LOOPBKENA), exercising the queues, FIFOs and both interrupts.
+// On LAUNCHXL-F28379D, SCI-A is on GPIO42 (TX) / GPIO43 (RX), the XDS100 virtual COM port.
+// The driver also builds for CPU2 (cpu02 project); CPU1 then calls SciInitPins() and
+// assigns SCI-A to CPU2 (CPUSEL5) before CPU2 opens it.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef SCI_DRIVER_H
+#define SCI_DRIVER_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+
+// Definitions for the SCI clock and FIFOs
+#define SCI_LSPCLK_HZ       200000000UL     // LSPCLK = SYSCLK (LSPCLKDIV = 0)
+#define SCI_FIFO_DEPTH      16              // Hardware FIFO levels
+#define SCI_TX_FIFO_LEVEL   4               // Refill the TX FIFO once it drains to this level
+#define SCI_TX_QUEUE_SIZE   2048            // Software TX queue [bytes], power of two
+#define SCI_RX_QUEUE_SIZE   256             // Software RX queue [bytes], power of two
+#define SCI_TEST_LENGTH     64              // Bytes sent by SciLoopbackTest()
+#define SCI_TEST_MARGIN     2               // Time allowed for the loopback pattern, in multiples of its line time
+
+// SciLoopbackTest() results (SciStats.loopback)
+#define SCI_TEST_NOT_RUN    0               // No loopback test since reset
+#define SCI_TEST_PASS       1               // Pattern received intact
+#define SCI_TEST_FAIL       2               // Pattern missing or corrupted
+
+// Driver counters, readable by the host
+typedef struct
+{
+    Uint32 txBytes;                         // Bytes moved into the TX FIFO
+    Uint32 rxBytes;                         // Bytes moved out of the RX FIFO
+    Uint32 txQueueFull;                     // Bytes SciWrite() could not queue
+    Uint32 rxQueueDrops;                    // Bytes lost because the RX queue was full
+    Uint32 rxFifoOverflows;                 // RX FIFO overruns (RXFFOVF)
+    Uint16 loopback;                        // SCI_TEST_* result of the last SciLoopbackTest()
+    Uint32 baud;                            // Actual baud rate after BRR rounding
+} SCI_STATS;
+
+extern volatile SCI_STATS SciStats;         // SCI-A counters
+
+// Function Prototypes
+#ifdef CPU1
+void SciInitPins(void);                             // LSPCLK and GPIO42/43 mux, CPU1 only
+#endif
+void SciOpen(Uint32 baud, Uint16 loopback);         // (Re)initialize SCI-A, queues and interrupts; loopback = 1 for LOOPBKENA
+Uint16 SciWrite(const Uint16 *data, Uint16 count);  // Queue up to count bytes, returns the number queued
+Uint16 SciRead(Uint16 *data, Uint16 count);         // Take up to count received bytes, returns the number taken
+Uint16 SciTxFree(void);                             // Free space in the TX queue [bytes]
+Uint16 SciTxIdle(void);                             // 1 once the queue and the TX FIFO are empty
+Uint16 SciLoopbackTest(Uint32 baud);                // Loopback self-test, returns SCI_TEST_PASS or SCI_TEST_FAIL
+interrupt void scia_tx_isr(void);                   // TX FIFO interrupt
+interrupt void scia_rx_isr(void);                   // RX FIFO interrupt
+
+#endif  // end of SCI_DRIVER_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: sdfm_current.c
+/*
+// File Description:
+// SDFM1 filter 1 armature current acquisition and over-current trip. See sdfm_current.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "actuation_cpu01.h"    // Build configuration and shared acquisition state
+#include "sdfm_current.h"
+#include "scaling.h"            // Per-channel ADC gain/offset descriptors
+
+#define SDFM_SINC3          3           // SST, CS1_CS0: sinc3 structure
+#define SDFM_FLG_IFH1       0x00000001UL    // SDIFLG: filter 1 over the high threshold
+#define SDFM_FLG_IFL1       0x00000002UL    // SDIFLG: filter 1 under the low threshold
+#define SDFM_FLG_MIF        0x80000000UL    // SDIFLG: master interrupt flag
+#define SDFM_FLG_TRIP       (SDFM_FLG_IFH1 | SDFM_FLG_IFL1)
+#define SDFM_SETTLE_US      10          // Comparator filter settling after the start: 3 x COSR bits, twice over
+
+volatile SDFM_STATUS SdfmStatus;
+
+// Comparator threshold for a current: the sinc3 output runs from 0 (-full scale) to COSR^3 (+full scale)
+static Uint16 SdfmThreshold(float32 current)
+{
+    float32 full = (float32)SDFM_COMPARATOR_OSR * (float32)SDFM_COMPARATOR_OSR * (float32)SDFM_COMPARATOR_OSR;
+
+    return (Uint16)(full * (SDFM_FULL_SCALE_MA + current) / (2.0f * SDFM_FULL_SCALE_MA));
+}
+
+// Sinc3 data filter at SDFM_OSR and sinc3 comparator at SDFM_COMPARATOR_OSR on filter 1, data
+// scaled into ScaleTable[SCALE_CH_CURRENT]
+void SdfmCurrentInit(void)
+{
+    Uint32 full = (Uint32)SDFM_OSR * SDFM_OSR * SDFM_OSR;     // Data filter output span
+    Uint16 shift = 0;
+
+    while ((full >> shift) > SDFM_CODE_SPAN)
+    {
+        shift++;                                // +-2048 at full scale, or the OSR's own range if smaller
+    }
+
+    GPIO_SetupPinMux(SDFM_DATA_GPIO, GPIO_MUX_CPU1, SDFM_GPIO_MUX);
+    GPIO_SetupPinOptions(SDFM_DATA_GPIO, GPIO_INPUT, GPIO_ASYNC);
+    GPIO_SetupPinMux(SDFM_CLOCK_GPIO, GPIO_MUX_CPU1, SDFM_GPIO_MUX);
+    GPIO_SetupPinOptions(SDFM_CLOCK_GPIO, GPIO_INPUT, GPIO_ASYNC);
+
+    SdfmStatus.shift = shift;
+    SdfmStatus.gain = SDFM_FULL_SCALE_MA * (float32)(1UL << shift) / (0.5f * (float32)full);
+    SdfmStatus.highThreshold = SdfmThreshold(SDFM_TRIP_MA);
+    SdfmStatus.lowThreshold = SdfmThreshold(-SDFM_TRIP_MA);
+    SdfmStatus.fault = 0;
+    SdfmStatus.tripData = 0;
+    SdfmStatus.trips = 0;
+
+    ScaleTable[SCALE_CH_CURRENT].gain = SdfmStatus.gain;
+    ScaleTable[SCALE_CH_CURRENT].offset = SDFM_CODE_ZERO;
+
+    EALLOW;                                     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    Sdfm1Regs.SDMFILEN.bit.MFE = 0;             // Filters stopped while configuring
+    Sdfm1Regs.SDCTL.bit.MIE = 0;
+    Sdfm1Regs.SDCTLPARM1.bit.MOD = 0;           // Mode 0: data on the rising edge of the modulator clock
+
+    // Data filter
+    Sdfm1Regs.SDDFPARM1.all = 0x0000;
+    Sdfm1Regs.SDDFPARM1.bit.DOSR = SDFM_OSR - 1;
+    Sdfm1Regs.SDDFPARM1.bit.SST = SDFM_SINC3;
+    Sdfm1Regs.SDDFPARM1.bit.AE = 0;             // No data interrupt: adca1_isr or DMA CH3 take the newest result
+    Sdfm1Regs.SDIPARM1.bit.DR = 0;              // 16-bit two's complement
+    Sdfm1Regs.SDIPARM1.bit.SH = shift;
+
+    // Comparator filter
+    Sdfm1Regs.SDCPARM1.all = 0x0000;
+    Sdfm1Regs.SDCPARM1.bit.COSR = SDFM_COMPARATOR_OSR - 1;
+    Sdfm1Regs.SDCPARM1.bit.CS1_CS0 = SDFM_SINC3;
+    Sdfm1Regs.SDCMPH1.bit.HLT = SdfmStatus.highThreshold;
+    Sdfm1Regs.SDCMPL1.bit.LLT = SdfmStatus.lowThreshold;
+    Sdfm1Regs.SDCPARM1.bit.MFIE = 0;            // A stopped modulator clock is not reported
+
+    Sdfm1Regs.SDDFPARM1.bit.FEN = 1;            // Start the data filter
+    Sdfm1Regs.SDMFILEN.bit.MFE = 1;             // Start the module
+    EDIS;                                       // Using EDIS to clear the EALLOW
+
+    DELAY_US(SDFM_SETTLE_US);                   // The first comparator outputs are partial sums and would trip
+
+    EALLOW;                                     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    Sdfm1Regs.SDIFLGCLR.all = 0xFFFFFFFFUL;     // Clear all flags
+    Sdfm1Regs.SDCPARM1.bit.IEH = 1;             // Trip on over-current in either direction
+    Sdfm1Regs.SDCPARM1.bit.IEL = 1;
+    Sdfm1Regs.SDCTL.bit.MIE = 1;                // Comparator trips reach the PIE
+    EDIS;                                       // Using EDIS to clear the EALLOW
+}
+
+void SdfmFaultClear(void)
+{
+    EALLOW;                                     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    Sdfm1Regs.SDIFLGCLR.all = SDFM_FLG_TRIP | SDFM_FLG_MIF;
+    SdfmStatus.fault = 0;
+    Sdfm1Regs.SDCPARM1.bit.IEH = 1;             // A current still past the limit trips again at once
+    Sdfm1Regs.SDCPARM1.bit.IEL = 1;
+    EDIS;                                       // Using EDIS to clear the EALLOW
+}
+
+// Comparator trip: latch it, mask both directions and acknowledge
+interrupt void sd1_isr(void)
+{
+    Uint32 flags = Sdfm1Regs.SDIFLG.all;
+
+    if (SdfmStatus.fault == 0)
+    {
+        SdfmStatus.tripData = (int16)Sdfm1Regs.SDDATA1.bit.DATA16;
+    }
+    SdfmStatus.fault |= (Uint16)(flags & SDFM_FLG_TRIP);
+    SdfmStatus.trips++;
+
+    EALLOW;                                     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    Sdfm1Regs.SDCPARM1.bit.IEH = 0;             // Until SdfmFaultClear()
+    Sdfm1Regs.SDCPARM1.bit.IEL = 0;
+    Sdfm1Regs.SDIFLGCLR.all = (flags & SDFM_FLG_TRIP) | SDFM_FLG_MIF;
+    EDIS;                                       // Using EDIS to clear the EALLOW
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP5;     // Acknowledge PIE group 5 to enable further interrupts
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
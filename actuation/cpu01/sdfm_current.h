@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: sdfm_current.h
+/*
+// File Description:
+// Armature current from a sigma-delta modulator on SDFM1 filter 1 (SDFM_MODE = SDFM_ON), in
+// place of the analog current on ADC-C3.
+//
+// The modulator bit stream comes in on SD1_D1 (GPIO122) with its own SDFM_CLOCK_HZ bit clock
+// on SD1_C1 (GPIO123), both on mux position 7 (mode 0: data taken on the rising clock edge).
+// Two filters of the module run on the same stream in hardware:
+//   Data filter: sinc3 decimating by SDFM_OSR (156 kHz at 128). Its 16-bit result is shifted
+//       by SdfmStatus.shift so the full-scale range spans +-2048, the code range of ADC-C
+//       about mid-scale. adca1_isr (ADC_CAPTURE_ISR) or DMA CH3 on ADCAINT1
+//       (ADC_CAPTURE_DMA) takes the newest result at every ePWM2 SOCA, so it lands in the
+//       ADC-C slot of the trigger, filter bank, stream and capture buffers as if ADC-C had
+//       converted it; SdfmCurrentCode() maps it to a 12-bit code. The SDRAM store keeps the
+//       raw 16-bit result. ScaleTable[SCALE_CH_CURRENT] is set to the gain of the filter, so
+//       maCurrent[] stays in mA.
+//   Comparator filter: sinc3 decimating by SDFM_COMPARATOR_OSR (625 kHz at 32), checked
+//       against SDFM_TRIP_MA in both directions on every output. A trip raises sd1_isr
+//       (PIE 5.9) at most 4 x SDFM_COMPARATOR_OSR bit clocks (6.4 us) after the current steps
+//       past the limit, long before the next sample is converted.
+// The comparator interrupts are armed once the first, partial outputs of the filters have passed.
+// sd1_isr latches the direction of the trip in SdfmStatus.fault and disables the comparator
+// interrupts, so a persisting over-current interrupts the CPU only once; SdfmFaultClear()
+// clears the latch and re-arms them.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef SDFM_CURRENT_H
+#define SDFM_CURRENT_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+
+// Definitions for the modulator
+#define SDFM_CLOCK_HZ       20000000UL  // Bit clock of the modulator on SD1_C1
+#define SDFM_FULL_SCALE_MA  2500.0f     // [mA] Current at the full-scale modulator input
+#define SDFM_DATA_GPIO      122         // SD1_D1
+#define SDFM_CLOCK_GPIO     123         // SD1_C1
+#define SDFM_GPIO_MUX       7           // SD1_D1/SD1_C1 on both pins
+
+// Definitions for the filters
+#ifndef SDFM_OSR
+#define SDFM_OSR            128         // Data filter oversampling ratio
+#endif
+#if (SDFM_OSR < 8) || (SDFM_OSR > 256)
+#error "SDFM_OSR out of range"
+#endif
+#define SDFM_COMPARATOR_OSR 32          // Comparator filter oversampling ratio, the largest it has
+#ifndef SDFM_TRIP_MA
+#define SDFM_TRIP_MA        1800.0f     // [mA] Over-current limit, either direction
+#endif
+
+// Definitions for the ADC-C code space
+#define SDFM_CODE_ZERO      2048        // Code of zero current
+#define SDFM_CODE_MAX       4095        // Largest 12-bit code
+#define SDFM_CODE_SPAN      4096        // Data filter full scale after the shift, at most
+
+// SdfmStatus.fault
+#define SDFM_FAULT_HIGH     0x0001      // Over-current, positive (SDIFLG.IFH1)
+#define SDFM_FAULT_LOW      0x0002      // Over-current, negative (SDIFLG.IFL1)
+
+// Filter setup and comparator trips, readable by the host
+typedef struct
+{
+    Uint16 shift;                       // SDIPARM1.SH of the data filter
+    float32 gain;                       // [mA] per data filter count
+    Uint16 highThreshold;               // SDCMPH1.HLT
+    Uint16 lowThreshold;                // SDCMPL1.LLT
+    Uint16 fault;                       // SDFM_FAULT_* latched since the last SdfmFaultClear()
+    int16 tripData;                     // Data filter result when the latch was set
+    Uint32 trips;                       // sd1_isr calls
+} SDFM_STATUS;
+
+extern volatile SDFM_STATUS SdfmStatus;
+
+// ADC-C code of a data filter result: mid-scale at zero current, clamped to 12 bits
+static inline Uint16 SdfmCurrentCode(int16 data)
+{
+    int16 code = SDFM_CODE_ZERO + data;
+
+    return (code < 0) ? 0 : (code > SDFM_CODE_MAX) ? SDFM_CODE_MAX : (Uint16)code;
+}
+
+// Function Prototypes
+void SdfmCurrentInit(void);             // Pins, data and comparator filters, current scaling; filters running
+void SdfmFaultClear(void);              // Clear the fault latch and re-arm the comparator interrupts
+interrupt void sd1_isr(void);           // SDFM1 comparator trip
+
+#endif  // end of SDFM_CURRENT_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,256 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: sdram_store.c
+/*
+// File Description:
+// Deep capture store in external SDRAM on EMIF1. See sdram_store.h for the modes and the
+// bandwidth budget.
+//
+// SDRAM timing for a 16-bit PC133 part at EMIF1CLK = 100 MHz (SYSCLK/2):
+// tRFC 70 ns, tRP/tRCD/tWR 20 ns, tRAS 50 ns, tRC 70 ns, tRRD 15 ns, tXSR 80 ns,
+// 8192 refreshes per 64 ms.
+// -----------------------------------------------------------------------------
+ */
+
+#include "sdram_store.h"
+#include "actuation_cpu01.h"    // Build configuration and shared acquisition state
+#include "isr_profiler.h"       // ISR execution time and latency statistics
+
+// F2837xD_Emif.c, no prototypes in the device support headers
+extern void Emif1Initialize(void);
+extern void setup_emif1_pinmux_sdram_16bit(Uint16 cpu_sel);
+
+// A half-buffer period in SYSCLK cycles, the time each block move has
+#define SDRAM_BLOCK_PERIOD_CYCLES   (DMA_CAPTURE_HALF_SIZE * (ADC_SAMPLE_PERIOD + 1) * PROFILE_CYCLES_PER_TBCLK)
+
+#if SDRAM_BLOCK_CYCLES * 100 > SDRAM_BUDGET_PERCENT * SDRAM_BLOCK_PERIOD_CYCLES
+#error "SDRAM block moves exceed SDRAM_BUDGET_PERCENT of the ADC_SAMPLE_PERIOD half-buffer period"
+#endif
+
+#define SDRAM_DMA_SOFTWARE  0           // DMACHSRCSEL: no peripheral, started with PERINTFRC only
+
+SDRAM_CONFIG SdramConfig = { SDRAM_STORE_RING, SDRAM_STORE_SAMPLES };
+volatile SDRAM_STATUS SdramStatus;
+static Uint16 sdramStartMode;           // Mode and depth taken by the pending start request
+static Uint32 sdramStartDepth;
+
+// Set up EMIF1 for the SDRAM and DMA channels 5/6 for the block moves and the readback.
+// Remuxes GPIO29-52 and GPIO69-93 to EMIF1: call before SCI-A claims GPIO42/43.
+void SdramStoreInit(void)
+{
+    union SDRAM_CR_REG control;
+
+    EALLOW;                                         // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    ClkCfgRegs.PERCLKDIVSEL.bit.EMIF1CLKDIV = 1;    // EMIF1CLK = SYSCLK/2
+    EDIS;                                           // Using EDIS to clear the EALLOW
+
+    Emif1Initialize();                              // Module soft reset
+
+    EALLOW;
+    Emif1ConfigRegs.EMIF1MSEL.all = MSEL_EMIF1_CPU1;    // CPU1 and its DMA own EMIF1
+    Emif1ConfigRegs.EMIF1ACCPROT0.all = 0;          // CPU writes, CPU fetches and DMA writes allowed
+    EDIS;
+
+    setup_emif1_pinmux_sdram_16bit(GPIO_MUX_CPU1);
+
+    // Timing in EMIF1CLK cycles minus one
+    EALLOW;
+    Emif1Regs.SDRAM_TR.bit.T_RFC = 6;
+    Emif1Regs.SDRAM_TR.bit.T_RP = 1;
+    Emif1Regs.SDRAM_TR.bit.T_RCD = 1;
+    Emif1Regs.SDRAM_TR.bit.T_WR = 1;
+    Emif1Regs.SDRAM_TR.bit.T_RAS = 4;
+    Emif1Regs.SDRAM_TR.bit.T_RC = 6;
+    Emif1Regs.SDRAM_TR.bit.T_RRD = 1;
+    Emif1Regs.SDR_EXT_TMNG.bit.T_XS = 7;
+    Emif1Regs.SDRAM_RCR.bit.REFRESH_RATE = 781;     // 7.8 us between refreshes
+    EDIS;
+
+    DELAY_US(200);                                  // SDRAM power-up time before the first command
+
+    // Writing SDRAM_CR starts the initialization sequence, so it is written once
+    control.all = 0;
+    control.bit.PAGESIGE = 2;                       // 1024-word pages
+    control.bit.IBANK = 2;                          // 4 banks
+    control.bit.BIT_11_9_LOCK = 1;                  // CL is writable
+    control.bit.CL = 3;                             // CAS latency 3
+    control.bit.NM = 1;                             // 16-bit data bus
+    EALLOW;
+    Emif1Regs.SDRAM_CR.all = control.all;
+    EDIS;
+
+    // Channel 5 -- block moves: one sample (a column of the four rows) per burst, a half per transfer
+    DMACH5BurstConfig(SDRAM_STORE_CHANNELS - 1, 2 * DMA_CAPTURE_HALF_SIZE, 1);     // Next row, next SDRAM word
+    DMACH5TransferConfig(DMA_CAPTURE_HALF_SIZE - 1, 1 - (SDRAM_STORE_CHANNELS - 1) * 2 * DMA_CAPTURE_HALF_SIZE, 1);   // Next column of row 0
+    DMACH5WrapConfig(0xFFFF, 0, 0xFFFF, 0);                     // No wrap
+    DMACH5ModeConfig(SDRAM_DMA_SOFTWARE, PERINT_ENABLE, ONESHOT_ENABLE, CONT_DISABLE, SYNC_DISABLE, SYNC_SRC,
+                     OVRFLOW_DISABLE, SIXTEEN_BIT, CHINT_END, CHINT_DISABLE);
+
+    // Channel 6 -- readback: consecutive frames into on-chip RAM, size set per read
+    DMACH6BurstConfig(SDRAM_STORE_CHANNELS - 1, 1, 1);
+    DMACH6TransferConfig(0, 1, 1);
+    DMACH6WrapConfig(0xFFFF, 0, 0xFFFF, 0);
+    DMACH6ModeConfig(SDRAM_DMA_SOFTWARE, PERINT_ENABLE, ONESHOT_ENABLE, CONT_DISABLE, SYNC_DISABLE, SYNC_SRC,
+                     OVRFLOW_DISABLE, SIXTEEN_BIT, CHINT_END, CHINT_DISABLE);
+
+    SdramStatus.mode = SDRAM_STORE_OFF;
+    SdramStatus.startRequest = 0;
+    SdramStatus.stopRequest = 0;
+    SdramStatus.depth = 0;
+    SdramStatus.head = 0;
+    SdramStatus.stored = 0;
+    SdramStatus.firstSample = 0;
+    SdramStatus.blocks = 0;
+    SdramStatus.moves = 0;
+    SdramStatus.lateBlocks = 0;
+    SdramStatus.reads = 0;
+}
+
+// Take SdramConfig and start recording at the next half-buffer. Returns 0 if the settings are invalid.
+Uint16 SdramStoreStart(void)
+{
+    Uint32 depth = SdramConfig.depth;
+
+    if (((SdramConfig.mode != SDRAM_STORE_FILL) && (SdramConfig.mode != SDRAM_STORE_RING)) ||
+        (depth == 0) || (depth > SDRAM_STORE_SAMPLES))
+    {
+        return 0;
+    }
+
+    sdramStartMode = SdramConfig.mode;
+    sdramStartDepth = (depth + DMA_CAPTURE_HALF_SIZE - 1) / DMA_CAPTURE_HALF_SIZE * DMA_CAPTURE_HALF_SIZE;
+    if (sdramStartDepth > SDRAM_STORE_SAMPLES)
+    {
+        sdramStartDepth -= DMA_CAPTURE_HALF_SIZE;   // SDRAM_STORE_SAMPLES is a whole number of blocks
+    }
+    SdramStatus.stopRequest = 0;
+    SdramStatus.startRequest = 1;
+    return 1;
+}
+
+// Stop recording at the next half-buffer; the samples stored so far are kept
+void SdramStoreStop(void)
+{
+    SdramStatus.stopRequest = 1;
+}
+
+// Called from dmach4_isr with the half of DmaCaptureBuffer the previous transfer completed.
+// Channel 5 has a whole half-buffer period to move it before the capture channels reuse it.
+void SdramStoreBlock(Uint16 half)
+{
+    Uint32 block = SdramStatus.blocks++;
+    Uint32 source = (Uint32)&DmaCaptureBuffer[DMA_CAPTURE_ADCA][half * DMA_CAPTURE_HALF_SIZE];
+    Uint32 destination;
+
+    if (SdramStatus.stopRequest != 0)
+    {
+        SdramStatus.stopRequest = 0;
+        SdramStatus.mode = SDRAM_STORE_OFF;
+    }
+    if (SdramStatus.startRequest != 0)
+    {
+        SdramStatus.startRequest = 0;
+        SdramStatus.mode = sdramStartMode;
+        SdramStatus.depth = sdramStartDepth;
+        SdramStatus.head = 0;
+        SdramStatus.stored = 0;
+        SdramStatus.firstSample = block * DMA_CAPTURE_HALF_SIZE;
+    }
+    if (SdramStatus.mode == SDRAM_STORE_OFF)
+    {
+        return;
+    }
+
+    if (DmaRegs.CH5.CONTROL.bit.RUNSTS == 1)
+    {
+        SdramStatus.lateBlocks++;               // Over budget: stop rather than leave a gap
+        SdramStatus.mode = SDRAM_STORE_OFF;
+        return;
+    }
+
+    destination = SDRAM_ADDRESS(SdramStatus.head * SDRAM_STORE_CHANNELS);
+    EALLOW;     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+    DmaRegs.CH5.SRC_BEG_ADDR_SHADOW = source;
+    DmaRegs.CH5.SRC_ADDR_SHADOW = source;
+    DmaRegs.CH5.DST_BEG_ADDR_SHADOW = destination;
+    DmaRegs.CH5.DST_ADDR_SHADOW = destination;
+    DmaRegs.CH5.CONTROL.bit.RUN = 1;
+    DmaRegs.CH5.CONTROL.bit.PERINTFRC = 1;      // One software trigger runs the whole block
+    EDIS;       // Using EDIS to clear the EALLOW
+    SdramStatus.moves++;
+
+    if (SdramStatus.stored == SdramStatus.depth)
+    {
+        SdramStatus.firstSample += DMA_CAPTURE_HALF_SIZE;   // RING: the oldest block is overwritten
+    }
+    else
+    {
+        SdramStatus.stored += DMA_CAPTURE_HALF_SIZE;
+    }
+    SdramStatus.head += DMA_CAPTURE_HALF_SIZE;
+    if (SdramStatus.head == SdramStatus.depth)
+    {
+        SdramStatus.head = 0;
+        if (SdramStatus.mode == SDRAM_STORE_FILL)
+        {
+            SdramStatus.mode = SDRAM_STORE_OFF;
+        }
+    }
+}
+
+// Copy up to count stored samples, from the sample-th oldest on, into frames[] with DMA channel 6.
+// Returns the number of frames being copied: fewer than count where the ring wraps or the
+// store ends (read the rest with a second call), 0 while recording, while channel 5 or a previous
+// read still runs, or if sample is past the end. Poll SdramStoreReadBusy() before using frames[].
+Uint16 SdramStoreRead(Uint32 sample, Uint16 count, Uint16 (*frames)[SDRAM_STORE_CHANNELS])
+{
+    Uint32 slot;
+    Uint32 source;
+    Uint32 destination = (Uint32)&frames[0][0];
+
+    if ((SdramStatus.mode != SDRAM_STORE_OFF) || (SdramStatus.startRequest != 0) ||
+        (DmaRegs.CH5.CONTROL.bit.RUNSTS == 1) || (DmaRegs.CH6.CONTROL.bit.RUNSTS == 1) ||
+        (count == 0) || (sample >= SdramStatus.stored))
+    {
+        return 0;
+    }
+
+    // Once the ring is full the oldest sample is in the slot written next
+    slot = sample + ((SdramStatus.stored == SdramStatus.depth) ? SdramStatus.head : 0);
+    if (slot >= SdramStatus.depth)
+    {
+        slot -= SdramStatus.depth;
+    }
+    if (count > SdramStatus.stored - sample)
+    {
+        count = (Uint16)(SdramStatus.stored - sample);
+    }
+    if (count > SdramStatus.depth - slot)
+    {
+        count = (Uint16)(SdramStatus.depth - slot);
+    }
+
+    source = SDRAM_ADDRESS(slot * SDRAM_STORE_CHANNELS);
+    EALLOW;
+    DmaRegs.CH6.SRC_BEG_ADDR_SHADOW = source;
+    DmaRegs.CH6.SRC_ADDR_SHADOW = source;
+    DmaRegs.CH6.DST_BEG_ADDR_SHADOW = destination;
+    DmaRegs.CH6.DST_ADDR_SHADOW = destination;
+    DmaRegs.CH6.TRANSFER_SIZE = count - 1;
+    DmaRegs.CH6.CONTROL.bit.RUN = 1;
+    DmaRegs.CH6.CONTROL.bit.PERINTFRC = 1;
+    EDIS;
+    SdramStatus.reads++;
+    return count;
+}
+
+// 1 while channel 6 is copying frames
+Uint16 SdramStoreReadBusy(void)
+{
+    return DmaRegs.CH6.CONTROL.bit.RUNSTS;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: sdram_store.h
+/*
+// File Description:
+// Deep capture store in external SDRAM on EMIF1 CS0 (SDRAM_MODE = SDRAM_ON, needs
+// ADC_CAPTURE_MODE = ADC_CAPTURE_DMA).
+//
+// Every half-buffer that DMA CH1-4 complete in DmaCaptureBuffer (dma_capture.h) is moved
+// to the SDRAM by DMA channel 5 before it is reused. dmach4_isr only reprograms the channel
+// and forces one software trigger; the channel then runs the whole block in one-shot mode,
+// one sample per burst, interleaving the four rows into frames of ADC-A, ADC-B, ADC-C, ADC-D
+// (with SDFM_ON the ADC-C word is the signed SDFM data filter result, see sdfm_current.h).
+// With 4-word bursts the capture channels wait at most one burst for the DMA. The CPU never
+// touches the SDRAM: DMA channel 6 copies stored frames back into on-chip RAM on request.
+//
+// Modes:
+//   SDRAM_STORE_FILL   record the next depth samples, then stop
+//   SDRAM_STORE_RING   record until stopped; the store keeps the newest depth samples
+// SdramConfig can be edited at any time; SdramStoreStart() and SdramStoreStop() take effect
+// at the next half-buffer, from dmach4_isr, so a capture always starts and ends on a block.
+// Stored samples are numbered from the oldest one held (SdramStatus.firstSample is its
+// number since the DMA capture started) and can be read back once the store has stopped.
+//
+// Bandwidth budget: moving one block costs SDRAM_BLOCK_CYCLES of DMA time, which must stay
+// under SDRAM_BUDGET_PERCENT of a half-buffer period at the configured ADC_SAMPLE_PERIOD
+// (checked when sdram_store.c is compiled). If a move is still running when the next block
+// completes anyway, the store stops rather than leave a gap (SdramStatus.lateBlocks).
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef SDRAM_STORE_H
+#define SDRAM_STORE_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+#include "dma_capture.h"        // DMA ping-pong ADC capture
+
+// Definitions for the SDRAM (16-bit, 4 banks x 8192 rows x 1024 columns, 512 Mbit)
+#define SDRAM_BASE          0x80000000UL    // EMIF1 CS0 window
+#ifndef SDRAM_WORDS
+#define SDRAM_WORDS         0x2000000UL     // 32M 16-bit words
+#endif
+#ifndef SDRAM_ADDRESS
+#define SDRAM_ADDRESS(word) (SDRAM_BASE + (Uint32)(word))  // DMA address of a word of the SDRAM
+#endif
+
+// Definitions for the store
+#define SDRAM_STORE_CHANNELS    DMA_CAPTURE_CHANNELS    // Words per stored sample (frame)
+#define SDRAM_STORE_SAMPLES     (SDRAM_WORDS / SDRAM_STORE_CHANNELS)    // 8M samples, 167 s at 50 kHz
+#define SDRAM_BLOCK_WORDS       (DMA_CAPTURE_CHANNELS * DMA_CAPTURE_HALF_SIZE)  // Words moved per half-buffer
+
+// Definitions for the bandwidth budget
+#define SDRAM_DMA_CYCLES_PER_WORD   8       // SYSCLK per word: GS RAM read, EMIF1 write at SYSCLK/2, row changes and refresh
+#define SDRAM_BLOCK_CYCLES      (SDRAM_BLOCK_WORDS * SDRAM_DMA_CYCLES_PER_WORD)    // DMA time of one block move
+#define SDRAM_BUDGET_PERCENT    25          // Share of a half-buffer period the moves may take
+
+// SdramConfig.mode, SdramStatus.mode
+#define SDRAM_STORE_OFF     0           // Not recording
+#define SDRAM_STORE_FILL    1
+#define SDRAM_STORE_RING    2
+
+// Store settings, editable at any time, taken by SdramStoreStart()
+typedef struct
+{
+    Uint16 mode;                        // SDRAM_STORE_FILL or SDRAM_STORE_RING
+    Uint32 depth;                       // Samples to keep, rounded up to whole half-buffers
+} SDRAM_CONFIG;
+
+// State and counters, readable by the host
+typedef struct
+{
+    Uint16 mode;                        // SDRAM_STORE_* running now
+    Uint16 startRequest;                // Set by SdramStoreStart(), cleared when the store starts
+    Uint16 stopRequest;                 // Set by SdramStoreStop(), cleared when the store stops
+    Uint32 depth;                       // Samples the running capture keeps
+    Uint32 head;                        // Sample slot the next block is written to
+    Uint32 stored;                      // Samples held, oldest at firstSample
+    Uint32 firstSample;                 // Number of the oldest sample held, counted from the start of the DMA capture
+    Uint32 blocks;                      // Half-buffers completed since the DMA capture started
+    Uint32 moves;                       // Blocks moved to the SDRAM
+    Uint32 lateBlocks;                  // Blocks that found the previous move still running (capture stopped)
+    Uint32 reads;                       // Readbacks started
+} SDRAM_STATUS;
+
+extern SDRAM_CONFIG SdramConfig;
+extern volatile SDRAM_STATUS SdramStatus;
+
+// Function Prototypes
+void SdramStoreInit(void);                  // EMIF1 SDRAM interface, DMA CH5/CH6, store stopped
+Uint16 SdramStoreStart(void);               // Start recording per SdramConfig at the next half-buffer, 0 if invalid
+void SdramStoreStop(void);                  // Stop recording at the next half-buffer
+void SdramStoreBlock(Uint16 half);          // From dmach4_isr: a half of DmaCaptureBuffer is complete
+Uint16 SdramStoreRead(Uint32 sample, Uint16 count, Uint16 (*frames)[SDRAM_STORE_CHANNELS]);  // Start a readback
+Uint16 SdramStoreReadBusy(void);            // 1 while a readback is running
+
+#endif  // end of SDRAM_STORE_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
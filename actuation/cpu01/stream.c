@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: stream.c
+/*
+// File Description:
+// Single-producer/single-consumer sample ring for continuous streaming. See stream.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "stream.h"
+
+// Record ring, in its own GS RAM block away from the capture and DMA buffers
+#pragma DATA_SECTION(StreamRing, "StreamRingSection")
+STREAM_RECORD StreamRing[STREAM_RING_SIZE];
+
+volatile STREAM_STATS StreamStats;      // Streaming counters
+STREAM_SINK StreamSink = StreamDiscard; // Replaced by the transport once it is set up
+
+static volatile Uint16 streamHead;      // Next slot to write, producer only
+static volatile Uint16 streamTail;      // Next slot to read, consumer only
+static Uint32 streamTimestamp;          // Sample number of the next record
+
+// Empty the ring and clear the counters; call before the producer starts
+void StreamInit(void)
+{
+    streamHead = 0;
+    streamTail = 0;
+    streamTimestamp = 0;
+    StreamStats.pushed = 0;
+    StreamStats.drained = 0;
+    StreamStats.overflows = 0;
+    StreamStats.highWater = 0;
+}
+
+// Producer: append one sample. Every call advances the timestamp, stored or not.
+void StreamPush(const Uint16 adc[STREAM_CHANNELS])
+{
+    Uint16 head = streamHead;
+    Uint16 fill = head - streamTail;    // Free-running indices, modulo 2^16
+    volatile STREAM_RECORD *slot;
+
+    if (fill >= STREAM_RING_SIZE)
+    {
+        StreamStats.overflows++;        // Consumer too slow, drop the newest record
+        streamTimestamp++;
+        return;
+    }
+
+    // Fill the slot through a volatile pointer so it is complete before head moves
+    slot = &StreamRing[head & STREAM_RING_MASK];
+    slot->timestamp = streamTimestamp++;
+    slot->adc[0] = adc[0];
+    slot->adc[1] = adc[1];
+    slot->adc[2] = adc[2];
+    slot->adc[3] = adc[3];
+    streamHead = head + 1;              // Publish the record
+
+    StreamStats.pushed++;
+    if (fill >= StreamStats.highWater)
+    {
+        StreamStats.highWater = fill + 1;
+    }
+}
+
+// Consumer: offer the pending records to StreamSink in at most two contiguous runs
+Uint16 StreamDrain(void)
+{
+    Uint16 tail = streamTail;
+    Uint16 pending = streamHead - tail;
+    Uint16 taken = 0;
+    Uint16 run;
+    Uint16 accepted;
+
+    while (pending != 0)
+    {
+        run = STREAM_RING_SIZE - (tail & STREAM_RING_MASK);     // Records up to the end of the ring
+        if (run > pending)
+        {
+            run = pending;
+        }
+        accepted = StreamSink(&StreamRing[tail & STREAM_RING_MASK], run);
+        tail += accepted;
+        taken += accepted;
+        pending -= accepted;
+        streamTail = tail;              // Release the slots to the producer
+        if (accepted < run)
+        {
+            break;                      // Sink is busy, try again on the next pass
+        }
+    }
+
+    StreamStats.drained += taken;
+    return taken;
+}
+
+// Default sink: accepts and drops everything, so the ring never overflows without a transport
+Uint16 StreamDiscard(const STREAM_RECORD *records, Uint16 count)
+{
+    (void)records;
+    return count;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
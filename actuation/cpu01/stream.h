@@ -0,0 +1,65 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: stream.h
+/*
+// File Description:
+// Continuous streaming of every ADC sample (STREAM_MODE = STREAM_ON).
+//
+// The acquisition path (adca1_isr, or ProcessCaptureBlock in DMA mode) is the single
+// producer: StreamPush() appends one timestamped record per sample to a ring in GS15.
+// The background loop in main() is the single consumer: StreamDrain() hands every
+// contiguous run of records to StreamSink, which may take fewer than offered when its
+// transport is busy. No locks are needed: head is only written by the producer, tail
+// only by the consumer, both are 16-bit (atomic on the C28x) and free-running, and
+// the ring size is a power of two.
+//
+// If the ring is full the new record is dropped and counted in StreamStats.overflows;
+// the consumer sees the loss as a jump in the record timestamps. The timestamp is the
+// sample number since streaming started, in ePWM2 periods (ADC_SAMPLE_PERIOD).
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef STREAM_H
+#define STREAM_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+
+// Definitions for the ring
+#define STREAM_RING_SIZE    512         // Records, power of two: 10 ms at 50 kHz
+#define STREAM_RING_MASK    (STREAM_RING_SIZE - 1)
+#define STREAM_CHANNELS     4           // ADC-A (mmSpeed), ADC-B (DutyCycle), ADC-C (maCurrent), ADC-D (LoadTorque)
+
+// One sample of all four channels
+typedef struct
+{
+    Uint32 timestamp;                   // Sample number since StreamInit()
+    Uint16 adc[STREAM_CHANNELS];        // Raw 12-bit SOC0 results of ADC-A..D
+} STREAM_RECORD;
+
+// Consumer of drained records: returns how many of the count records it accepted
+typedef Uint16 (*STREAM_SINK)(const STREAM_RECORD *records, Uint16 count);
+
+// Counters, readable by the host
+typedef struct
+{
+    Uint32 pushed;                      // Records written into the ring
+    Uint32 drained;                     // Records accepted by the sink
+    Uint32 overflows;                   // Records dropped because the ring was full
+    Uint16 highWater;                   // Largest ring fill level seen by StreamPush()
+} STREAM_STATS;
+
+extern volatile STREAM_STATS StreamStats;   // Streaming counters
+extern STREAM_SINK StreamSink;              // Where StreamDrain() sends the records
+
+// Function Prototypes
+void StreamInit(void);                                  // Empty the ring and clear the counters
+void StreamPush(const Uint16 adc[STREAM_CHANNELS]);     // Producer: append one sample (ISR context)
+Uint16 StreamDrain(void);                               // Consumer: pass pending records to StreamSink, returns the number taken
+Uint16 StreamDiscard(const STREAM_RECORD *records, Uint16 count);  // Default sink: accepts and drops everything
+
+#endif  // end of STREAM_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
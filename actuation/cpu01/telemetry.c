@@ -0,0 +1,171 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: telemetry.c
+/*
+// File Description:
+// Telemetry frame encoder on top of the stream ring and SCI-A. See telemetry.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "telemetry.h"
+#include "sci_driver.h"         // Non-blocking SCI-A driver
+
+// CRC-16/CCITT-FALSE, one nibble at a time (16 words instead of a 256-word table)
+static const Uint16 crcNibble[16] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+// Frame being filled and its encoded copy, one byte per word
+#pragma DATA_SECTION(tlmRaw, "TelemetrySection")
+#pragma DATA_SECTION(tlmEncoded, "TelemetrySection")
+static Uint16 tlmRaw[TLM_RAW_MAX];
+static Uint16 tlmEncoded[TLM_ENCODED_MAX];
+
+volatile TELEMETRY_STATS TelemetryStats;    // Encoder counters
+
+static Uint16 tlmSequence;              // Sequence number of the next frame
+static Uint16 tlmCount;                 // Samples in tlmRaw
+static Uint32 tlmNext;                  // Timestamp that continues the frame
+static Uint16 tlmPending;               // Encoded bytes in tlmEncoded waiting for queue space
+
+// Reset the encoder; the first frame carries sequence number 0
+void TelemetryInit(void)
+{
+    tlmSequence = 0;
+    tlmCount = 0;
+    tlmPending = 0;
+    TelemetryStats.frames = 0;
+    TelemetryStats.samples = 0;
+    TelemetryStats.bytes = 0;
+    TelemetryStats.shortFrames = 0;
+    TelemetryStats.busy = 0;
+}
+
+Uint16 TelemetryCrc(Uint16 crc, const Uint16 *data, Uint16 count)
+{
+    Uint16 i;
+
+    for (i = 0; i < count; i++)
+    {
+        crc = (crc << 4) ^ crcNibble[(crc >> 12) ^ ((data[i] >> 4) & 0x0F)];
+        crc = (crc << 4) ^ crcNibble[(crc >> 12) ^ (data[i] & 0x0F)];
+    }
+    return crc;
+}
+
+// Consistent Overhead Byte Stuffing: every zero is replaced by the distance to the next one
+Uint16 TelemetryCobs(const Uint16 *raw, Uint16 count, Uint16 *encoded)
+{
+    Uint16 code = 1;                    // Distance to the next zero, written at codeIndex
+    Uint16 codeIndex = 0;
+    Uint16 out = 1;
+    Uint16 i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (raw[i] != 0)
+        {
+            encoded[out++] = raw[i];
+            code++;
+        }
+        if ((raw[i] == 0) || (code == 0xFF))
+        {
+            encoded[codeIndex] = code;
+            codeIndex = out++;
+            code = 1;
+        }
+    }
+    encoded[codeIndex] = code;
+    encoded[out++] = TLM_DELIMITER;
+    return out;
+}
+
+// Close the frame in tlmRaw and encode it into tlmEncoded
+static void TelemetryClose(void)
+{
+    Uint16 length = TLM_HEADER_BYTES + tlmCount * TLM_SAMPLE_BYTES;
+    Uint32 first = tlmNext - tlmCount;
+    Uint16 crc;
+
+    tlmRaw[0] = (TLM_VERSION << 4) | TLM_TYPE_SAMPLES;
+    tlmRaw[1] = tlmSequence & 0xFF;
+    tlmRaw[2] = tlmSequence >> 8;
+    tlmRaw[3] = (Uint16)first & 0xFF;
+    tlmRaw[4] = ((Uint16)first >> 8) & 0xFF;
+    tlmRaw[5] = (Uint16)(first >> 16) & 0xFF;
+    tlmRaw[6] = (Uint16)(first >> 24) & 0xFF;
+    tlmRaw[7] = tlmCount;
+    crc = TelemetryCrc(TLM_CRC_INIT, tlmRaw, length);
+    tlmRaw[length] = crc & 0xFF;
+    tlmRaw[length + 1] = crc >> 8;
+
+    tlmPending = TelemetryCobs(tlmRaw, length + TLM_CRC_BYTES, tlmEncoded);
+    TelemetryStats.samples += tlmCount;
+    tlmSequence++;
+    tlmCount = 0;
+}
+
+// Queue the encoded frame if SCI-A can take all of it; returns 1 once nothing is pending
+static Uint16 TelemetrySend(void)
+{
+    if (tlmPending == 0)
+    {
+        return 1;
+    }
+    if (SciTxFree() < tlmPending)
+    {
+        TelemetryStats.busy++;
+        return 0;                       // Try again on the next pass
+    }
+    SciWrite(tlmEncoded, tlmPending);
+    TelemetryStats.frames++;
+    TelemetryStats.bytes += tlmPending;
+    tlmPending = 0;
+    return 1;
+}
+
+// StreamSink: pack records into frames and send them, accepting only what can be framed now
+Uint16 TelemetrySink(const STREAM_RECORD *records, Uint16 count)
+{
+    Uint16 taken = 0;
+    Uint16 *slot;
+
+    while (taken < count)
+    {
+        if (TelemetrySend() == 0)
+        {
+            break;                      // Encoded frame still waiting, leave the rest in the ring
+        }
+        if ((tlmCount != 0) && (records[taken].timestamp != tlmNext))
+        {
+            TelemetryStats.shortFrames++;
+            TelemetryClose();           // Records were lost in the ring, start a new frame
+            continue;
+        }
+
+        // Two channels in three bytes
+        slot = &tlmRaw[TLM_HEADER_BYTES + tlmCount * TLM_SAMPLE_BYTES];
+        slot[0] = records[taken].adc[0] & 0xFF;
+        slot[1] = ((records[taken].adc[0] >> 8) & 0x0F) | ((records[taken].adc[1] & 0x0F) << 4);
+        slot[2] = (records[taken].adc[1] >> 4) & 0xFF;
+        slot[3] = records[taken].adc[2] & 0xFF;
+        slot[4] = ((records[taken].adc[2] >> 8) & 0x0F) | ((records[taken].adc[3] & 0x0F) << 4);
+        slot[5] = (records[taken].adc[3] >> 4) & 0xFF;
+        tlmNext = records[taken].timestamp + 1;
+        taken++;
+
+        if (++tlmCount == TLM_SAMPLES_PER_FRAME)
+        {
+            TelemetryClose();
+        }
+    }
+    TelemetrySend();                    // Ship a frame completed by the last record
+    return taken;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,47 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: telemetry.h
+/*
+// File Description:
+// Firmware encoder of the binary telemetry protocol (telemetry_protocol.h).
+//
+// TelemetrySink() is installed as the StreamSink, so it runs in the background loop
+// and never in an ISR. It packs the drained records into a frame as they arrive and
+// sends the frame once it holds TLM_SAMPLES_PER_FRAME samples or the next record does
+// not follow on (ring overflow). A frame is only handed to SciWrite() when the SCI
+// queue can take all of it; otherwise the sink stops accepting records and the stream
+// ring absorbs the backlog until the next pass.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+#include "stream.h"             // Continuous sample streaming ring
+#include "telemetry_protocol.h" // Wire format
+
+// Encoder counters, readable by the host
+typedef struct
+{
+    Uint32 frames;                      // Frames queued on SCI-A
+    Uint32 samples;                     // Samples sent in those frames
+    Uint32 bytes;                       // Encoded bytes queued, delimiters included
+    Uint32 shortFrames;                 // Frames sent early because of a timestamp gap
+    Uint32 busy;                        // Passes that stopped because the SCI queue was full
+} TELEMETRY_STATS;
+
+extern volatile TELEMETRY_STATS TelemetryStats;     // Encoder counters
+
+// Function Prototypes
+void TelemetryInit(void);                                           // Reset the encoder and the sequence number
+Uint16 TelemetrySink(const STREAM_RECORD *records, Uint16 count);   // StreamSink: frame records onto SCI-A
+Uint16 TelemetryCrc(Uint16 crc, const Uint16 *data, Uint16 count);  // CRC-16/CCITT-FALSE over count bytes
+Uint16 TelemetryCobs(const Uint16 *raw, Uint16 count, Uint16 *encoded);    // COBS encode and delimit, returns the encoded length
+
+#endif  // end of TELEMETRY_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
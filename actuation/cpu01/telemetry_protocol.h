@@ -0,0 +1,56 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: telemetry_protocol.h
+/*
+// File Description:
+// Wire format of the binary telemetry stream sent over SCI-A. Shared by the firmware
+// encoder (telemetry.c) and the Linux decoder (host/telemetry_decoder.c), so it only
+// holds plain definitions and no device types.
+//
+// A frame carries up to TLM_SAMPLES_PER_FRAME consecutive samples of all four channels:
+//
+//   offset  size  field
+//   0       1     type: TLM_VERSION in bits 7:4, TLM_TYPE_SAMPLES in bits 3:0
+//   1       2     sequence number, +1 per frame, wraps at 2^16
+//   3       4     timestamp of the first sample (StreamRecord sample number)
+//   7       1     number of samples n, 1..TLM_SAMPLES_PER_FRAME
+//   8       6n    samples: ADC-A, ADC-B, ADC-C, ADC-D packed as 12-bit values,
+//                 two channels in three bytes: lo(x0), hi(x0) | lo(x1) << 4, x1 >> 4
+//   8+6n    2     CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) of bytes 0..7+6n
+//
+// Multi-byte fields are little-endian. The frame is COBS encoded (no zero bytes) and
+// terminated by a single 0x00 delimiter, so a receiver resynchronizes on the next
+// zero after any error. Samples within a frame always have consecutive timestamps.
+//
+// Loss detection: a gap in the sequence numbers counts frames lost on the link, a gap
+// between the expected and the received timestamp counts samples missing for any
+// reason (link loss or a full stream ring on the target).
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef TELEMETRY_PROTOCOL_H
+#define TELEMETRY_PROTOCOL_H
+
+// Frame layout
+#define TLM_VERSION             1               // Protocol version, bits 7:4 of the type byte
+#define TLM_TYPE_SAMPLES        1               // Frame of packed ADC samples
+#define TLM_CHANNELS            4               // ADC-A (mmSpeed), ADC-B (DutyCycle), ADC-C (maCurrent), ADC-D (LoadTorque)
+#define TLM_SAMPLE_BYTES        6               // Four 12-bit values
+#define TLM_SAMPLES_PER_FRAME   16              // Samples per full frame: 0.32 ms at 50 kHz
+#define TLM_HEADER_BYTES        8               // Type, sequence, timestamp, count
+#define TLM_CRC_BYTES           2
+#define TLM_RAW_MAX             (TLM_HEADER_BYTES + TLM_SAMPLES_PER_FRAME * TLM_SAMPLE_BYTES + TLM_CRC_BYTES)
+#define TLM_ENCODED_MAX         (TLM_RAW_MAX + TLM_RAW_MAX / 254 + 2)   // COBS overhead plus the delimiter
+#define TLM_DELIMITER           0x00            // Frame delimiter
+#define TLM_CRC_INIT            0xFFFF          // CRC-16/CCITT-FALSE start value
+
+// Link budget of a full frame: 108 bytes for 16 samples, 6.75 bytes = 67.5 bits per
+// sample on an 8N1 line, so 50 kHz needs 3.4 Mbaud of the default 5 Mbaud.
+#define TLM_LINE_BITS_PER_FRAME (10UL * TLM_ENCODED_MAX)
+
+#endif  // end of TELEMETRY_PROTOCOL_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
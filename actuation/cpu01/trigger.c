@@ -0,0 +1,201 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: trigger.c
+/*
+// File Description:
+// Trigger engine for the circular capture buffers. See trigger.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "trigger.h"
+#include "actuation_cpu01.h"    // Build configuration and shared acquisition state
+
+#define TRIG_DEFAULT_AUTO_TIMEOUT 50000UL   // 1 s at 50 kHz
+
+TRIGGER_CONFIG TriggerConfig;           // Pending configuration, applied on arm
+TRIGGER_STATUS TriggerStatus;           // Engine state
+
+static TRIGGER_CONFIG active;           // Configuration in use, only touched by TriggerSample()
+static volatile Uint32 *gpioData;       // GPyDAT register of the GPIO source
+static Uint32 gpioMask;                 // Bit of the GPIO source in *gpioData
+static Uint16 edgeArmed;                // Edge/window types: the previous sample was on the arming side
+static Uint16 fillCount;                // Pre-trigger samples recorded since arming
+static Uint16 postRemaining;            // Samples left to record after the trigger
+static Uint32 waitCount;                // Samples spent armed, for the auto timeout
+
+// Load the default configuration: rising edge on GPIO0 (PWM1A), no history, normal mode
+void TriggerInit(void)
+{
+    TriggerConfig.source = TRIG_SRC_GPIO;
+    TriggerConfig.gpio = 0;
+    TriggerConfig.type = TRIG_TYPE_RISING;
+    TriggerConfig.mode = TRIG_MODE_NORMAL;
+    TriggerConfig.level = 1;
+    TriggerConfig.levelHigh = 1;
+    TriggerConfig.hysteresis = 0;
+    TriggerConfig.preTrigger = 0;
+    TriggerConfig.autoTimeout = TRIG_DEFAULT_AUTO_TIMEOUT;
+
+    TriggerStatus.state = TRIG_STATE_STOPPED;
+    TriggerStatus.startIndex = 0;
+    TriggerStatus.triggerIndex = 0;
+    TriggerStatus.captures = 0;
+    TriggerStatus.forced = 0;
+    TriggerArm();
+}
+
+// Request a new capture with the current TriggerConfig; safe to call with the ISR running
+void TriggerArm(void)
+{
+    TriggerStatus.armRequest = 1;
+}
+
+// Apply the pending configuration, in the context of TriggerSample()
+static void TriggerStart(void)
+{
+    active = TriggerConfig;
+    if (active.preTrigger >= RESULTS_BUFFER_SIZE)
+    {
+        active.preTrigger = RESULTS_BUFFER_SIZE - 1;    // Keep at least the trigger sample
+    }
+    gpioData = (volatile Uint32 *)&GpioDataRegs + (active.gpio / 32) * GPY_DATA_OFFSET + GPYDAT;
+    gpioMask = 1UL << (active.gpio % 32);
+
+    edgeArmed = 0;
+    fillCount = 0;
+    waitCount = 0;
+    TriggerStatus.state = (active.preTrigger != 0) ? TRIG_STATE_FILLING : TRIG_STATE_ARMED;
+    TriggerStatus.armRequest = 0;
+}
+
+// Evaluate the trigger condition for one value, tracking the arming side for edges and windows
+static inline Uint16 TriggerCondition(int16 value)
+{
+    Uint16 fire = 0;
+    Uint16 inside;
+
+    switch (active.type)
+    {
+    case TRIG_TYPE_RISING:
+        fire = (edgeArmed != 0) && (value >= active.level);
+        if (value < active.level - active.hysteresis)
+        {
+            edgeArmed = 1;
+        }
+        else if (fire != 0)
+        {
+            edgeArmed = 0;
+        }
+        break;
+
+    case TRIG_TYPE_FALLING:
+        fire = (edgeArmed != 0) && (value <= active.level);
+        if (value > active.level + active.hysteresis)
+        {
+            edgeArmed = 1;
+        }
+        else if (fire != 0)
+        {
+            edgeArmed = 0;
+        }
+        break;
+
+    case TRIG_TYPE_ABOVE:
+        fire = (value >= active.level);
+        break;
+
+    case TRIG_TYPE_BELOW:
+        fire = (value <= active.level);
+        break;
+
+    case TRIG_TYPE_ENTER:
+        inside = (value >= active.level) && (value <= active.levelHigh);
+        fire = (edgeArmed != 0) && (inside != 0);
+        edgeArmed = !inside;
+        break;
+
+    case TRIG_TYPE_EXIT:
+        inside = (value >= active.level) && (value <= active.levelHigh);
+        fire = (edgeArmed != 0) && (inside == 0);
+        edgeArmed = inside;
+        break;
+
+    default:
+        break;
+    }
+    return fire;
+}
+
+// Run the engine for one sample. adc[] holds the raw SOC0 results of ADC-A..D.
+// The caller stores the sample at resultsIndex (and advances it circularly) unless TRIG_SAMPLE_SKIP is returned.
+Uint16 TriggerSample(const Uint16 adc[TRIG_NUM_ADC])
+{
+    Uint16 state;
+    Uint16 fire;
+    int16 value;
+
+    if (TriggerStatus.armRequest != 0)
+    {
+        TriggerStart();
+    }
+
+    state = TriggerStatus.state;
+    if ((state == TRIG_STATE_STOPPED) || (state == TRIG_STATE_DONE) || (state == TRIG_STATE_HELD))
+    {
+        return TRIG_SAMPLE_SKIP;
+    }
+
+    if (active.source == TRIG_SRC_GPIO)
+    {
+        value = ((*gpioData & gpioMask) != 0) ? 1 : 0;
+    }
+    else
+    {
+        value = (int16)adc[active.source];
+    }
+    fire = TriggerCondition(value);
+
+    if (state == TRIG_STATE_FILLING)
+    {
+        if (++fillCount >= active.preTrigger)
+        {
+            TriggerStatus.state = TRIG_STATE_ARMED;     // History complete, triggers accepted from the next sample
+        }
+        return TRIG_SAMPLE_STORE;
+    }
+
+    if (state == TRIG_STATE_ARMED)
+    {
+        if ((fire == 0) && (active.mode == TRIG_MODE_AUTO) && (++waitCount >= active.autoTimeout))
+        {
+            fire = 1;                                   // Nothing happened, show the signal anyway
+            TriggerStatus.forced++;
+        }
+        if (fire == 0)
+        {
+            return TRIG_SAMPLE_STORE;                   // Keep rolling the history
+        }
+        TriggerStatus.triggerIndex = resultsIndex;      // This sample is stored there
+        postRemaining = RESULTS_BUFFER_SIZE - active.preTrigger;
+        waitCount = 0;
+        TriggerStatus.state = TRIG_STATE_POST;
+    }
+
+    if (--postRemaining != 0)
+    {
+        return TRIG_SAMPLE_STORE;
+    }
+
+    // Capture complete: the oldest sample follows this one in the circular buffer
+    TriggerStatus.startIndex = (TriggerStatus.triggerIndex >= active.preTrigger) ?
+                               TriggerStatus.triggerIndex - active.preTrigger :
+                               TriggerStatus.triggerIndex + RESULTS_BUFFER_SIZE - active.preTrigger;
+    TriggerStatus.captures++;
+    TriggerStatus.state = (active.mode == TRIG_MODE_SINGLE) ? TRIG_STATE_DONE : TRIG_STATE_HELD;
+    return TRIG_SAMPLE_LAST;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
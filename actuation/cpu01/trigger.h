@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: trigger.h
+/*
+// File Description:
+// Oscilloscope-style trigger engine for the mmSpeed/maCurrent capture buffers.
+//
+// The capture buffers are used as a circular history. Once armed, every sample is
+// stored; the engine first waits until preTrigger samples have been recorded, then
+// evaluates the trigger condition on every sample. The sample that fires the trigger
+// is stored at triggerIndex and is followed by RESULTS_BUFFER_SIZE - preTrigger - 1
+// more, so a complete capture always fills the whole buffer. Reading it in time order
+// starts at startIndex and wraps at RESULTS_BUFFER_SIZE.
+//
+// Sources: the raw 12-bit SOC0 result of ADC-A..D (level in ADC counts) or any GPIO
+// input (level 0 or 1).
+//
+// Trigger types:
+// TRIG_TYPE_RISING     value was below level - hysteresis, is now >= level
+// TRIG_TYPE_FALLING    value was above level + hysteresis, is now <= level
+// TRIG_TYPE_ABOVE      value >= level
+// TRIG_TYPE_BELOW      value <= level
+// TRIG_TYPE_ENTER      value was outside [level, levelHigh], is now inside
+// TRIG_TYPE_EXIT       value was inside [level, levelHigh], is now outside
+//
+// Modes:
+// TRIG_MODE_NORMAL     wait for a trigger indefinitely, hold each capture (TRIG_STATE_HELD)
+// TRIG_MODE_AUTO       as normal, but force a trigger after autoTimeout samples
+// TRIG_MODE_SINGLE     stop after one capture (TRIG_STATE_DONE) until re-armed
+//
+// A held capture is not overwritten: nothing is stored until the reader has taken it and
+// re-armed. TRIG_STATE_HELD asks the reader to re-arm as soon as it is done, whereas
+// TRIG_STATE_DONE waits for the user.
+//
+// TriggerConfig can be edited at any time (CCS or host); it takes effect when
+// TriggerStatus.armRequest is set to 1 or TriggerArm() is called. The default
+// configuration reproduces the original behaviour: rising edge on GPIO0 (PWM1A),
+// no pre-trigger history, normal mode.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef TRIGGER_H
+#define TRIGGER_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+
+// Trigger sources
+#define TRIG_SRC_ADCA       0           // ADC-A2 -- mmSpeed
+#define TRIG_SRC_ADCB       1           // ADC-B0 -- DutyCycle
+#define TRIG_SRC_ADCC       2           // ADC-C3 -- maCurrent
+#define TRIG_SRC_ADCD       3           // ADC-D3 -- LoadTorque
+#define TRIG_SRC_GPIO       4           // GPIO input selected by TRIGGER_CONFIG.gpio
+#define TRIG_NUM_ADC        4           // Number of ADC results passed to TriggerSample()
+
+// Trigger types
+#define TRIG_TYPE_RISING    0           // Rising edge through level
+#define TRIG_TYPE_FALLING   1           // Falling edge through level
+#define TRIG_TYPE_ABOVE     2           // Level: at or above level
+#define TRIG_TYPE_BELOW     3           // Level: at or below level
+#define TRIG_TYPE_ENTER     4           // Window: enters [level, levelHigh]
+#define TRIG_TYPE_EXIT      5           // Window: leaves [level, levelHigh]
+
+// Trigger modes
+#define TRIG_MODE_NORMAL    0           // Wait for a trigger, hold each capture until re-armed
+#define TRIG_MODE_AUTO      1           // Force a trigger after autoTimeout samples
+#define TRIG_MODE_SINGLE    2           // One capture, then stop
+
+// Engine states (TriggerStatus.state)
+#define TRIG_STATE_STOPPED  0           // Not capturing
+#define TRIG_STATE_FILLING  1           // Recording the pre-trigger history
+#define TRIG_STATE_ARMED    2           // Waiting for the trigger condition
+#define TRIG_STATE_POST     3           // Triggered, recording post-trigger samples
+#define TRIG_STATE_DONE     4           // Single capture complete
+#define TRIG_STATE_HELD     5           // Normal/auto capture complete, held until re-armed
+
+// TriggerSample() results
+#define TRIG_SAMPLE_SKIP    0           // Do not store this sample
+#define TRIG_SAMPLE_STORE   1           // Store this sample at resultsIndex
+#define TRIG_SAMPLE_LAST    2           // Store this sample, it completes the capture
+
+// Trigger configuration
+typedef struct
+{
+    Uint16 source;                      // TRIG_SRC_*
+    Uint16 gpio;                        // GPIO number for TRIG_SRC_GPIO
+    Uint16 type;                        // TRIG_TYPE_*
+    Uint16 mode;                        // TRIG_MODE_*
+    int16 level;                        // Threshold, or window lower bound [ADC counts or 0/1]
+    int16 levelHigh;                    // Window upper bound
+    int16 hysteresis;                   // Edge types: distance the value must retreat before re-arming
+    Uint16 preTrigger;                  // Samples kept from before the trigger, < RESULTS_BUFFER_SIZE
+    Uint32 autoTimeout;                 // TRIG_MODE_AUTO: samples without a trigger before one is forced
+} TRIGGER_CONFIG;
+
+// Trigger state published for the host
+typedef struct
+{
+    volatile Uint16 state;              // TRIG_STATE_*
+    volatile Uint16 armRequest;         // Set to 1 to apply TriggerConfig and re-arm at the next sample
+    volatile Uint16 startIndex;         // Oldest sample of the last complete capture
+    volatile Uint16 triggerIndex;       // Trigger sample of the last complete capture
+    volatile Uint32 captures;           // Completed captures
+    volatile Uint32 forced;             // Captures triggered by the auto timeout
+} TRIGGER_STATUS;
+
+extern TRIGGER_CONFIG TriggerConfig;    // Pending configuration
+extern TRIGGER_STATUS TriggerStatus;    // Engine state
+
+// Function Prototypes
+void TriggerInit(void);                                 // Load the default configuration and arm
+void TriggerArm(void);                                  // Apply TriggerConfig and start a new capture
+Uint16 TriggerSample(const Uint16 adc[TRIG_NUM_ADC]);   // Run the engine for one sample, returns TRIG_SAMPLE_*
+
+#endif  // end of TRIGGER_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
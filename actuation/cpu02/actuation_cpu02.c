@@ -0,0 +1,172 @@
+    // ----------------------------------------------------------------------------- //
+    // Beginning of File
+    //
+    // File: actuation_cpu02.c
+    /*
+    // File Description:
+    // CPU2 application. CPU1 (actuation_cpu01.c, built with CPU2_MODE = CPU2_ON) keeps the
+    // hard real-time ADC/DAC loop and posts blocks of stream records through the IPC driver
+    // (ipc_link.h). CPU2 takes everything that does not have to meet the 20 us sample
+    // deadline:
+    //   - a low-pass filter per channel and min/max/mean statistics (cpu2_process.h),
+    //   - the telemetry encoder and the SCI-A driver (../cpu01/telemetry.c, sci_driver.c).
+    // Results are published in Cpu2Status in the CPU2-to-CPU1 message RAM.
+    //
+    // Project setup: build with CPU2 defined, link 2837xD_RAM_lnk_cpu2.cmd and
+    // F2837xD_Headers_nonBIOS_cpu2.cmd, add ../cpu01 to the include path and link
+    // ../cpu01/telemetry.c, ../cpu01/sci_driver.c and ../cpu01/ipc_batch.c. Load the CPU1
+    // and CPU2 images and run both cores; CPU1 waits for CPU2 before it starts posting.
+    //
+    // Timing: one block of IPC_BLOCK_RECORDS samples arrives every 0.64 ms and must be
+    // released within IPC_BLOCK_SLOTS blocks (2.56 ms), after which CPU1 keeps the
+    // records in its 10 ms stream ring. With CPU2_LINK = CPU2_LINK_GSRAM a page arrives
+    // every 13.6 ms; CPU2 reads it in place and has about 40 ms before CPU1 runs out of pages.
+    // -----------------------------------------------------------------------------
+     */
+
+    #include "F28x_Project.h"       // Device Header File and Examples Include File
+    #include "actuation_cpu01.h"    // Shared build configuration (SCI_MODE, SCI_BAUD, CPU2_LINK)
+    #include "ipc_link.h"           // Shared block and status layout
+    #include "ipc_batch.h"          // Batched, interrupt-driven IPC
+    #include "cpu2_process.h"       // Filters and statistics
+    #include "sci_driver.h"         // Non-blocking SCI-A driver
+    #include "telemetry.h"          // Telemetry frame encoder
+
+    #define CPU2_PENDING_MASK (IPC_BLOCK_SLOTS - 1)     // IPC_BLOCK_SLOTS is a power of two
+
+    // Shared message RAM: CPU1 owns the blocks (DSECT here), CPU2 owns the status
+    #if CPU2_LINK == CPU2_LINK_GSRAM
+    #pragma DATA_SECTION(IpcBlocks, "Cpu1ToCpu2PageSection")    // Writable only once CPU1 has switched a page to CPU2; read once its message arrives
+    #else
+    #pragma DATA_SECTION(IpcBlocks, "Cpu1ToCpu2Section")
+    #endif
+    #pragma DATA_SECTION(Cpu2Status, "Cpu2ToCpu1Section")
+    IPC_SAMPLE_BLOCK IpcBlocks[IPC_BLOCK_SLOTS];
+    volatile CPU2_STATUS Cpu2Status;
+
+    // Blocks announced by CPU1 and not released yet, filled by QueueBlocks() in cpu1_ipc0_isr
+    IPC_BATCH ipcCpu1;                  // IPC driver instance for IPC_LINK_INT
+    Uint16 pendingSlot[IPC_BLOCK_SLOTS];    // Slot of each pending block
+    Uint16 pendingCount[IPC_BLOCK_SLOTS];   // Records in each pending block
+    volatile Uint16 pendingHead;        // Next free entry, written by cpu1_ipc0_isr
+    volatile Uint16 pendingTail;        // Oldest pending block, written by the background loop
+    Uint16 blockProcessed;              // Oldest pending block has been filtered
+    Uint16 blockSent;                   // Records of the oldest pending block taken by the telemetry
+
+    // Function Prototypes
+    interrupt void cpu1_ipc0_isr(void); // IPC messages from CPU1
+    void QueueBlocks(const tIpcMessage *messages, Uint16 count);  // IpcBatchService() callback
+    void ServiceBlocks(void);           // Process, send and release the pending blocks
+
+    // Beginning of the main section of code
+    void main(void)
+    {
+        InitSysCtrl();                  // Initialize System Control (watchdog, CPU2 clocks)
+
+        DINT;               // Clear all interrupts and initialize PIE vector table
+        InitPieCtrl();      // Initialize the PIE Control
+        IER = 0x0000;       // Set IER to 0
+        IFR = 0x0000;       // Set IFR to 0
+        InitPieVectTable(); // Initialize the Pie Vector Table
+
+        Cpu2ProcessInit();  // Clear the filters, statistics and Cpu2Status
+        pendingHead = 0;
+        pendingTail = 0;
+        blockProcessed = 0;
+        blockSent = 0;
+
+        // Map ISR functions
+        EALLOW;                                     // (Bit 6) — Emulation access enable bit - Enable access to emulation and other protected registers
+        PieVectTable.IPC0_INT = &cpu1_ipc0_isr;     // Function for IPC interrupt 0 from CPU1
+        EDIS;                                       // Using EDIS to clear the EALLOW
+        IpcBatchInit(&ipcCpu1, IPC_LINK_INT, IPC_LINK_INT, QueueBlocks, NULL);
+
+        // Enable global interrupts and higher priority real-time debug events
+        PieCtrlRegs.PIEIER1.bit.INTx13 = 1;     // IPC0_INT
+        IER |= M_INT1;          // Enable group 1 interrupts
+        EINT;                   // Enable Global interrupt INTM
+        ERTM;                   // Enable Global real time interrupt DBGM
+
+    #if SCI_MODE == SCI_ON
+        while ((IpcRegs.IPCSTS.all & IPC_FLAG_SCI_GRANTED) == 0)
+        {
+            // CPU1 still setting up the SCI-A pins and ownership
+        }
+        IpcRegs.IPCACK.all = IPC_FLAG_SCI_GRANTED;
+        SciLoopbackTest(SCI_BAUD);              // Check the SCI-A queues, FIFOs and interrupts in loopback
+        SciOpen(SCI_BAUD, 0);                   // Open SCI-A to the host
+        TelemetryInit();                        // First frame gets sequence number 0
+    #endif
+
+        IpcRegs.IPCSET.all = IPC_FLAG_CPU2_READY;   // CPU1 may start posting
+
+        // Background loop: everything CPU1 hands over is handled here, outside any ISR
+        do {
+            ServiceBlocks();
+        } while(1);
+    }
+
+    // IPC interrupt 0: CPU1 has posted blocks
+    interrupt void cpu1_ipc0_isr(void)
+    {
+        IpcRegs.IPCACK.all = IPC_FLAG0;             // Clear the IPC0 flag before looking, so a new one interrupts again
+        IpcBatchService(&ipcCpu1);                  // Takes everything and tells CPU1
+        PieCtrlRegs.PIEACK.all = PIEACK_GROUP1;     // Acknowledge PIE group 1 to enable further interrupts
+    }
+
+    // Queue every sample block of a batch for ServiceBlocks()
+    void QueueBlocks(const tIpcMessage *messages, Uint16 count)
+    {
+        Uint16 head = pendingHead;
+        Uint16 i;
+
+        for (i = 0; i < count; i++)
+        {
+            if ((messages[i].ulcommand != IPC_CMD_SAMPLE_BLOCK) || (messages[i].uladdress >= IPC_BLOCK_SLOTS) ||
+                (messages[i].uldataw1 == 0) || (messages[i].uldataw1 > IPC_BLOCK_RECORDS) ||
+                ((Uint16)(head - pendingTail) >= IPC_BLOCK_SLOTS))
+            {
+                Cpu2Status.badMessages++;           // Not from IpcLinkSink(), or more blocks than slots
+                continue;
+            }
+            pendingSlot[head & CPU2_PENDING_MASK] = (Uint16)messages[i].uladdress;
+            pendingCount[head & CPU2_PENDING_MASK] = (Uint16)messages[i].uldataw1;
+            head++;
+        }
+        pendingHead = head;                         // Publish the blocks to ServiceBlocks()
+    }
+
+    // Filter, send and release pending blocks in order; a busy SCI-A queue ends the pass early
+    void ServiceBlocks(void)
+    {
+        const STREAM_RECORD *records;
+        Uint16 count;
+
+        while (pendingTail != pendingHead)
+        {
+            records = IpcBlocks[pendingSlot[pendingTail & CPU2_PENDING_MASK]].record;
+            count = pendingCount[pendingTail & CPU2_PENDING_MASK];
+
+            if (blockProcessed == 0)
+            {
+                Cpu2ProcessBlock(records, count);   // Once per block, even if the telemetry has to wait
+                blockProcessed = 1;
+            }
+    #if SCI_MODE == SCI_ON
+            blockSent += TelemetrySink(&records[blockSent], count - blockSent);
+            if (blockSent < count)
+            {
+                return;                             // SCI-A queue full, keep the slot
+            }
+    #endif
+
+            blockProcessed = 0;
+            blockSent = 0;
+            pendingTail++;
+            Cpu2Status.blocksDone++;                // Release the slot (GS RAM page) to CPU1
+        }
+    }
+
+    // ----------------------------------------------------------------------------- //
+    // End of file
+    // ----------------------------------------------------------------------------- //
@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: cpu2_process.c
+/*
+// File Description:
+// Low-pass filters and window statistics on CPU2. See cpu2_process.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include "cpu2_process.h"
+
+static Uint16 filterState[STREAM_CHANNELS];     // Low-pass output scaled by 2^CPU2_FILTER_SHIFT
+static Uint16 windowMin[STREAM_CHANNELS];       // Statistics of the open window
+static Uint16 windowMax[STREAM_CHANNELS];
+static Uint32 windowSum[STREAM_CHANNELS];
+static Uint16 windowCount;                      // Samples in the open window
+static Uint32 windowFirst;                      // Timestamp of its first sample
+static Uint32 nextTimestamp;                    // Timestamp expected next
+static Uint16 started;                          // A sample has been processed
+
+// Reset everything; called before CPU2 reports ready
+void Cpu2ProcessInit(void)
+{
+    Uint16 ch;
+
+    for (ch = 0; ch < STREAM_CHANNELS; ch++)
+    {
+        filterState[ch] = 0;
+        Cpu2Status.filtered[ch] = 0;
+    }
+    windowCount = 0;
+    started = 0;
+    Cpu2Status.blocksDone = 0;
+    Cpu2Status.samples = 0;
+    Cpu2Status.lostSamples = 0;
+    Cpu2Status.badMessages = 0;
+    Cpu2Status.sequence = 0;
+    Cpu2Status.windows = 0;
+}
+
+// Publish the open window and start the next one
+static void Cpu2CloseWindow(void)
+{
+    Uint16 ch;
+
+    Cpu2Status.sequence++;                      // Odd: update in progress
+    Cpu2Status.window.firstTimestamp = windowFirst;
+    for (ch = 0; ch < STREAM_CHANNELS; ch++)
+    {
+        Cpu2Status.window.min[ch] = windowMin[ch];
+        Cpu2Status.window.max[ch] = windowMax[ch];
+        Cpu2Status.window.mean[ch] = (Uint16)((windowSum[ch] + windowCount / 2) / windowCount);
+    }
+    Cpu2Status.windows++;
+    Cpu2Status.sequence++;                      // Even: window consistent
+    windowCount = 0;
+}
+
+void Cpu2ProcessBlock(const STREAM_RECORD *records, Uint16 count)
+{
+    Uint16 i;
+    Uint16 ch;
+    Uint16 x;
+
+    for (i = 0; i < count; i++)
+    {
+        if ((started != 0) && (records[i].timestamp != nextTimestamp))
+        {
+            Cpu2Status.lostSamples += records[i].timestamp - nextTimestamp;
+        }
+        started = 1;
+        nextTimestamp = records[i].timestamp + 1;
+
+        if (windowCount == 0)
+        {
+            windowFirst = records[i].timestamp;
+            for (ch = 0; ch < STREAM_CHANNELS; ch++)
+            {
+                windowMin[ch] = 0xFFFF;
+                windowMax[ch] = 0;
+                windowSum[ch] = 0;
+            }
+        }
+
+        for (ch = 0; ch < STREAM_CHANNELS; ch++)
+        {
+            x = records[i].adc[ch];
+            filterState[ch] += x - (filterState[ch] >> CPU2_FILTER_SHIFT);     // 12-bit input, 16-bit state
+            if (x < windowMin[ch])
+            {
+                windowMin[ch] = x;
+            }
+            if (x > windowMax[ch])
+            {
+                windowMax[ch] = x;
+            }
+            windowSum[ch] += x;
+        }
+
+        if (++windowCount == CPU2_STATS_WINDOW)
+        {
+            Cpu2CloseWindow();
+        }
+    }
+
+    for (ch = 0; ch < STREAM_CHANNELS; ch++)
+    {
+        Cpu2Status.filtered[ch] = filterState[ch] >> CPU2_FILTER_SHIFT;
+    }
+    Cpu2Status.samples += count;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,27 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: cpu2_process.h
+/*
+// File Description:
+// Sample processing on CPU2: a first-order low-pass per channel and min/max/mean
+// statistics over windows of CPU2_STATS_WINDOW samples. Results are published in
+// Cpu2Status (ipc_link.h), where CPU1 and the debugger can read them.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef CPU2_PROCESS_H
+#define CPU2_PROCESS_H
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+#include "ipc_link.h"           // Shared block and status layout
+
+// Function Prototypes
+void Cpu2ProcessInit(void);                                             // Clear the filters, statistics and Cpu2Status
+void Cpu2ProcessBlock(const STREAM_RECORD *records, Uint16 count);      // Filter and account count records
+
+#endif  // end of CPU2_PROCESS_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,71 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: c28x_host.h
+/*
+// File Description:
+// Forced include (gcc -include) for compiling the cpu01 firmware and the F2837xD
+// device support sources on a Linux host. It supplies what the TI C2000 compiler
+// provides implicitly:
+//   - exact-width DSP28 data types (Uint16 is 16 bits, as on the C28x),
+//   - the __cregister and interrupt keywords,
+//   - asm()/__asm() statements, routed to HostAsm() so EINT/DINT still toggle INTM.
+// The *Regs globals from F2837xD_GlobalVariableDefs.c become plain memory.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef C28X_HOST_H
+#define C28X_HOST_H
+
+// System headers first, so the keyword macros below cannot reach them
+#include <assert.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include <time.h>
+
+// DSP28 data types with C28x widths (F2837xD_device.h skips its own when this is set)
+#define DSP28_DATA_TYPES
+typedef int16_t     int16;
+typedef int32_t     int32;
+typedef int64_t     int64;
+typedef uint16_t    Uint16;
+typedef uint32_t    Uint32;
+typedef uint64_t    Uint64;
+typedef float       float32;
+typedef double      float64;
+
+// C28x compiler keywords
+#define __cregister
+#define cregister
+#define interrupt
+#define __interrupt
+
+// Inline assembly is interpreted by the host emulation (host_device.c)
+void HostAsm(const char *statement);
+#define __asm(statement)    HostAsm(statement)
+#define asm(statement)      HostAsm(statement)
+
+// C28x compiler intrinsics
+Uint16 __disable_interrupts(void);
+Uint16 __enable_interrupts(void);
+void __restore_interrupts(Uint16 state);
+
+// SCI-A data registers: sci_driver.c is built with SCI_TX_WRITE/SCI_RX_READ routed here (see Makefile)
+void HostSciTxWrite(Uint16 data);
+Uint16 HostSciRxRead(void);
+
+// EMIF1 SDRAM window: sdram_store.c is built with SDRAM_ADDRESS routed here (see Makefile)
+Uint32 HostEmif1Address(Uint32 word);
+
+#endif  // end of C28X_HOST_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,78 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: filter_reference.c
+/*
+// File Description:
+// Reference filter bank. See filter_reference.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include <string.h>
+#include "filter_reference.h"
+
+void FilterReferenceInit(FILTER_REFERENCE *ref, const FILTER_COEFFS *coeffs)
+{
+    memset(ref, 0, sizeof(*ref));
+    ref->coeffs = *coeffs;
+}
+
+void FilterReferenceLoad(FILTER_REFERENCE *ref, const FILTER_COEFFS *coeffs)
+{
+    ref->next = *coeffs;
+    ref->pending = 1;
+}
+
+Uint16 FilterReferenceRun(FILTER_REFERENCE *ref, Uint16 raw)
+{
+    const FILTER_COEFFS *c;
+    FILTER_COEFFS next;
+    float32 v = (float32)raw;
+    float32 y;
+    Uint16 taps;
+    Uint16 i;
+
+    if (ref->pending != 0)
+    {
+        next = ref->next;                   // Init clears ref->next
+        FilterReferenceInit(ref, &next);
+    }
+    c = &ref->coeffs;
+
+    for (i = 0; i < c->biquads; i++)
+    {
+        y = c->biquad[i].b0 * v + ref->s1[i];
+        ref->s1[i] = c->biquad[i].b1 * v - c->biquad[i].a1 * y + ref->s2[i];
+        ref->s2[i] = c->biquad[i].b2 * v - c->biquad[i].a2 * y;
+        v = y;
+    }
+
+    taps = c->taps;
+    if (taps != 0)
+    {
+        ref->newest = (Uint16)((ref->newest + 1) % taps);
+        ref->x[ref->newest] = v;
+        y = 0.0f;
+        for (i = 0; i < taps; i++)
+        {
+            y += c->fir[i] * ref->x[(ref->newest + taps - i) % taps];
+        }
+        v = y;
+    }
+
+    ref->output = v;
+    v += 0.5f;
+    if (v < 0.0f)
+    {
+        return 0;
+    }
+    if (v > 4095.0f)
+    {
+        return 4095;
+    }
+    return (Uint16)v;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
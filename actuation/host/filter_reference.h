@@ -0,0 +1,43 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: filter_reference.h
+/*
+// File Description:
+// Plain reference of the firmware filter bank (../cpu01/filter_bank.h) for the host
+// checks. It is written independently of the firmware code: separate s1/s2 arrays, a
+// circular FIR delay line indexed modulo the tap count, and coefficient hand-over by a
+// pending copy. The arithmetic is the same float32 expressions in the same order, so
+// with floating-point contraction off (-ffp-contract=off, no FMA) every output must
+// match the firmware bit for bit.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef FILTER_REFERENCE_H
+#define FILTER_REFERENCE_H
+
+#include "filter_bank.h"
+
+// One channel of the reference
+typedef struct
+{
+    FILTER_COEFFS coeffs;                   // Coefficients in use
+    FILTER_COEFFS next;                     // Set taken at the next sample if pending != 0
+    Uint16 pending;
+    float32 s1[FILTER_MAX_BIQUADS];
+    float32 s2[FILTER_MAX_BIQUADS];
+    float32 x[FILTER_MAX_TAPS];             // FIR inputs, circular
+    Uint16 newest;                          // Index of the newest FIR input
+    float32 output;                         // Last output before rounding
+} FILTER_REFERENCE;
+
+// Function Prototypes
+void FilterReferenceInit(FILTER_REFERENCE *ref, const FILTER_COEFFS *coeffs);  // Start with coeffs, cleared state
+void FilterReferenceLoad(FILTER_REFERENCE *ref, const FILTER_COEFFS *coeffs);  // Take coeffs at the next sample
+Uint16 FilterReferenceRun(FILTER_REFERENCE *ref, Uint16 raw);                   // One sample, rounded and limited
+
+#endif  // end of FILTER_REFERENCE_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,2071 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: host_device.c
+/*
+// File Description:
+// Host emulation of the C28x core registers, the virtual ePWM/ADC clock and the few
+// device support routines that depend on 16-bit word addressing. See host_device.h.
+//
+// Replaced routines (renamed in the vendor sources by the Makefile):
+// InitSysCtrl       - polls PLL lock bits and reads TI OTP at a fixed address
+// InitGpio          - sizes its clear loop with sizeof() in 16-bit words
+// InitPieVectTable  - copies the vector table as 32-bit words (host pointers are 64-bit)
+// F28x_usDelay      - assembly busy loop; here it advances the virtual clock
+// SFO               - binary library that measures the MEP step on the HRPWM calibration logic
+//
+// SCI-A data registers are plain memory too; sci_driver.c is built with its
+// SCITXBUF/SCIRXBUF accesses routed to HostSciTxWrite()/HostSciRxRead().
+// -----------------------------------------------------------------------------
+ */
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+#include "host_device.h"
+#include "SFO_V8.h"             // Scale factor optimizer interface
+
+extern int MEP_ScaleFactor;                 // Defined by the application (pwm_output.c), as the SFO library expects
+
+// C28x core registers (__cregister on the target)
+volatile unsigned int IER;
+volatile unsigned int IFR;
+static Uint16 hostIntm = 1;                 // INTM, set out of reset
+
+extern const struct PIE_VECT_TABLE PieVectTableInit;   // Default vectors in F2837xD_PieVect.c
+
+HOST_INPUT_HOOK HostInputHook;
+HOST_SAMPLE_HOOK HostSampleHook;
+HOST_STATS HostStats;
+HOST_SCI_TX_HOOK HostSciTxHook;
+HOST_CLA_TASK HostClaTask1;
+HOST_DMA_HOOK HostDmaHook;
+HOST_EXT_PWM HostExtPwm;
+HOST_ENCODER HostEncoder;
+HOST_SDFM HostSdfm;
+HOST_CMPSS HostCmpss;
+
+static Uint64 hostTimePs;                   // Virtual time since reset [ps]
+static Uint64 hostStopPs;                   // HostRun() returns when the clock reaches this
+static Uint64 hostEpwmStartPs;              // Time the ePWM time bases started counting
+static Uint16 hostEpwmRunning;              // Set once TBCLKSYNC and ePWM2 up-count are seen
+static Uint64 hostNextSocaPs;               // Time of the next ePWM2 SOCA
+static Uint16 hostEpwm6Running;             // Set while ePWM6 counts up
+static Uint64 hostNextEpwm6Ps;              // Time of the next ePWM6 CTR = 0
+static Uint32 hostSample;                   // SOCA sequence number
+static jmp_buf hostStop;                    // Unwinds the firmware's endless main loop
+
+#define HOST_SCI_FIFO_DEPTH     16          // SCI FIFO levels
+#define HOST_SCI_ISR_PASSES     4           // Interrupt re-evaluations per SCI event
+
+static Uint16 sciTxFifo[HOST_SCI_FIFO_DEPTH];   // SCI-A TX FIFO, oldest first
+static Uint16 sciRxFifo[HOST_SCI_FIFO_DEPTH];   // SCI-A RX FIFO, oldest first
+static Uint16 sciShift;                     // Byte in the transmit shifter
+static Uint16 sciShiftBusy;                 // Set while a byte is being shifted out
+static Uint64 sciShiftDonePs;               // Time the shifter finishes the current byte
+
+static Uint16 hostEmif1Cs0[SDRAM_WORDS];    // EMIF1 CS0 SDRAM window, SDRAM_WORDS set by the Makefile
+
+#define HOST_ECAP_MODULES       6           // eCAP1..6, inputs INPUT7..12 of the Input X-BAR
+#define HOST_ECAP_CYCLE_PS      (1000000000000ULL / HOST_SYSCLK_HZ)     // Time stamp counter period
+#define HOST_PWM_WAVES          3           // ePWM1A, ePWM5A, HostExtPwm
+#define HOST_PWM_HISTORY        256         // Periods HostEpwmCompareAt() can look back on
+
+// eCAP: eCAP1-6 in capture mode count SYSCLK from TSCTRSTOP and latch the edges of the pin
+// their Input X-BAR input (INPUT7..12SELECT) selects: PWM1A on GPIO0 and PWM5A on GPIO8,
+// replayed period by period from the time bases with the CMPA:CMPAHR loaded at each CTR = 0
+// (and the MEP edge of HRCNFG/HRMSTEP), and HostExtPwm on its own pin. The ePWMs come out
+// of InitSysCtrl() frozen, as from reset, and ePWM5 is re-phased by TBPHS on every ePWM1
+// sync. CAP1-4, CEVT flags, one-shot/continuous stop and wrap,
+// CTRRSTx, REARM, ECCLR and SWSYNC down the eCAP1-3 and eCAP4-6 chains are modelled;
+// PRESCALE and the eCAP interrupts are not. Edges are replayed before every SOCA and at the
+// start and end of every DELAY_US, so the firmware may only write the eCAPs, and the ePWM1/
+// ePWM5 compare registers, from the background loop or at a SOCA.
+
+// State of an eCAP module that is not held in its registers
+typedef struct
+{
+    Uint16 running;                         // TSCTRSTOP seen set
+    Uint16 armed;                           // Latching events (one-shot: until CEVT of STOP_WRAP)
+    Uint16 event;                           // Mod4 counter, index of the next CAPx
+    Uint64 zeroPs;                          // Time the counter held base
+    Uint32 base;
+} HOST_ECAP;
+
+// A PWM pin as the Input X-BAR sees it: set at the start of every period, cleared after the high time
+typedef struct
+{
+    volatile struct EPWM_REGS *epwm;        // ePWMxA set on zero and cleared on CMPA(:CMPAHR), NULL for HostExtPwm
+    Uint16 gpio;                            // Pin the signal is on
+    Uint16 running;
+    Uint16 level;                           // Level after the last edge replayed
+    Uint64 nextPs;                          // Start of the next period
+    Uint64 fallPs;                          // Falling edge still due in the current period, 0 = none
+    Uint64 tripPs;                          // Time a trip zone forced the pin low, 0 = not tripped
+    Uint64 startPs[HOST_PWM_HISTORY];       // Start of the latest periods and the compare value loaded at each
+    Uint32 compare[HOST_PWM_HISTORY];
+    Uint16 head;                            // Slot of the current period
+    Uint16 count;                           // Slots in use
+} HOST_PWM_WAVE;
+
+static volatile struct ECAP_REGS *const ecapModule[HOST_ECAP_MODULES] =
+    {&ECap1Regs, &ECap2Regs, &ECap3Regs, &ECap4Regs, &ECap5Regs, &ECap6Regs};
+static HOST_ECAP hostEcap[HOST_ECAP_MODULES];
+static HOST_PWM_WAVE hostWave[HOST_PWM_WAVES] = {{&EPwm1Regs, 0}, {&EPwm5Regs, 8}, {NULL, 0}};
+static Uint64 hostEcapPs;                   // Time the eCAPs were last brought up to date
+
+#define HOST_QEP_STS_CDEF       0x0004      // QEPSTS: capture direction error
+#define HOST_QEP_STS_COEF       0x0008      // QEPSTS: capture overflow error
+#define HOST_QEP_STS_UPEVNT     0x0080      // QEPSTS: unit position event
+#define HOST_QEP_STS_W1C        0x008E      // QEPSTS FIMF, CDEF, COEF, UPEVNT: write 1 to clear
+#define HOST_QEP_STS_QDF        0x0020      // QEPSTS: counting up
+#define HOST_QEP_STS_MARK       0x8000      // Reserved QEPSTS bit: gone once the firmware writes the register
+
+// eQEP: eQEP1 follows HostEncoder, a shaft position in counts, and is brought up to date at
+// every SOCA only, so the firmware must read it from adca1_isr. Modelled: the quadrature
+// count wrapping at QPOSMAX (PCRM = 1 only), the index latch into QPOSILAT with QFLG.IEL, the
+// capture unit with unit position events on every 2^UPPS counts of shaft position, CAPCLK =
+// SYSCLK / 2^CCPS, QCPRD, QCTMR, CDEF on a direction change, COEF on an overflow, and the
+// QCTMRLAT/QCPRDLAT latch of a QPOSCNT read (QCLM = 0). Edge times inside a sample are
+// interpolated linearly. The write-one-to-clear bits of QEPSTS are emulated with a marker
+// in reserved bit 15: if the firmware has written the register since the last SOCA, the
+// bits it wrote as 1 are cleared. The unit timer, watchdog, strobe, position compare and
+// the eQEP interrupts are not modelled.
+
+// eQEP1 state behind the registers
+typedef struct
+{
+    Uint16 running;             // QPEN seen set
+    float64 shaft;              // HostEncoder position at the last update [counts]
+    Uint64 ps;                  // Time of the last update
+    Uint64 eventPs;             // Time of the last unit position event, or of the capture enable
+    int16 eventDir;             // Direction of the last unit position event, 0 = none yet
+    Uint16 up;                  // Direction of the last count
+    Uint16 flags;               // QEPSTS write-one-to-clear flags
+} HOST_QEP;
+
+static HOST_QEP hostQep;
+
+#define HOST_SDFM_FLG_IFH1      0x00000001UL    // SDIFLG: filter 1 comparator above HLT
+#define HOST_SDFM_FLG_IFL1      0x00000002UL    // SDIFLG: filter 1 comparator below LLT
+#define HOST_SDFM_FLG_AF1       0x00001000UL    // SDIFLG: filter 1 new data
+#define HOST_SDFM_FLG_MIF       0x80000000UL    // SDIFLG: master interrupt flag
+
+// SDFM: a second-order sigma-delta modulator converts HostSdfm.input into a bit stream at
+// HostSdfm.clockHz from reset, which SDFM1 filter 1 takes while SDMFILEN.MFE is set. Both
+// filters are cascaded integrator-comb filters of the order selected (sinc1-3), started from
+// zero when enabled. The comparator filter (COSR + 1) sets IFH1 on an output above HLT and
+// IFL1 on one below LLT, and MIF if that interrupt is enabled; the data filter (DOSR + 1,
+// FEN) loads SDDATA1 with every output less half its span, shifted right by SH in 16-bit
+// mode, and sets AF1. The module is brought up to date at every SOCA, before the inputs are
+// taken, and at the start and end of every DELAY_US; a rise of MIF then runs the ISR mapped
+// at PieVectTable.SD1_INT (PIE 5.9) if SDCTL.MIE and the PIE let it through. The last
+// HOST_SDFM_HISTORY bits are kept for HostSdfmBit(). Sincfast, modes 1-3, the modulator
+// failure detector, the data acknowledge interrupt, filters 2-4 and SDFM2 are not modelled.
+
+// Cascaded integrator-comb filter of up to three stages, modulo 2^32
+typedef struct
+{
+    Uint32 integrator[3];
+    Uint32 comb[3];             // Input of each comb stage at the previous output
+    Uint16 phase;               // Bits since the previous output
+} HOST_SINC;
+
+// SDFM1 filter 1 and the modulator, state behind the registers
+typedef struct
+{
+    float64 loop1;              // Modulator integrators
+    float64 loop2;
+    float64 feedback;           // Last bit as -1 or +1
+    Uint16 comparatorRunning;   // MFE seen set
+    Uint16 dataRunning;         // MFE and FEN seen set
+    HOST_SINC comparator;
+    HOST_SINC data;
+    Uint16 pending;             // MIF rose and its interrupt has not been taken
+    Uint16 history[HOST_SDFM_HISTORY];  // Bit n at n % HOST_SDFM_HISTORY
+} HOST_SDFM_STATE;
+
+static HOST_SDFM_STATE hostSdfm;
+
+#define HOST_CMPSS_STS_HLATCH   0x0002      // COMPSTS.COMPHLATCH, COMPSTSCLR.HLATCHCLR
+#define HOST_CMPSS_STS_LLATCH   0x0200      // COMPSTS.COMPLLATCH, COMPSTSCLR.LLATCHCLR
+#define HOST_TZ_INT             0x0001      // TZFLG/TZCLR: global interrupt flag
+#define HOST_TZ_OST             0x0004      // TZFLG/TZCLR: one-shot trip
+#define HOST_TZ_DCAEVT1         0x0008      // TZFLG/TZCLR: DCAEVT1
+#define HOST_TZ_FLAGS           0x007F      // TZFLG/TZCLR: every flag
+#define HOST_TZOST_DCAEVT1      0x0040      // TZOSTFLG: DCAEVT1 latch
+
+// CMPSS: CMPSS6 compares HostCmpss.input, an ADC code on CMPIN6P, with the DAC values (DACxVALS,
+// loaded at once) in its high and low comparators (COMPxINV), whose outputs follow the input
+// HOST_CMPSS_DELAY_PS later. Between the jumps its hook announces the input is looked at every
+// HOST_CMPSS_STEP_PS and a crossing is found to the picosecond by bisection, so a step is exact
+// and only a smooth excursion shorter than the step can be missed. The digital filters
+// (CLKPRESCALE, SAMPWIN, THRESH, FILINIT) take a majority vote at their sample clock and a rising
+// filter output sets COMPxLATCH. CTRIPH and CTRIPL (CTRIPxSEL, the synchronous path taken as the
+// asynchronous one) reach TRIP4 through mux 10 of the ePWM X-BAR. On ePWM1 and ePWM5, TRIP4 as DCAH
+// with DCAEVT1 on DCAH high (unfiltered) sets DCAEVT1 and, as a one-shot source, OST and TZOSTFLG
+// for as long as it is high; with TZA = force low PWM1A/PWM5A are held low for the eCAPs and the
+// GPIO0 read-back from the trip up to the first period after OST is cleared. TZFLG.INT then runs
+// the ISR mapped at PieVectTable.EPWM1_TZ_INT or EPWM5_TZ_INT (PIE 2.1/2.5). The module is brought
+// up to date before every SOCA and at the start and end of every DELAY_US; flag clears are taken
+// at the time of the previous update. Hysteresis, the ramp generator, the other CMPSS modules and
+// X-BAR inputs, cycle-by-cycle trips, the DC event filter and the force-high and toggle actions
+// are not modelled.
+// Digital filter of one CMPSS6 comparator
+typedef struct
+{
+    Uint16 input;               // Comparator output after COMPxINV, as the filter sees it
+    Uint32 window;              // Latest samples, newest in bit 0
+    Uint16 output;
+    Uint64 nextPs;              // Next sample clock
+} HOST_CMPSS_FILTER;
+
+// CMPSS6 and the ePWM1/ePWM5 trip zones, state behind the registers
+typedef struct
+{
+    Uint64 inputPs;             // CMPIN6P has been looked at up to this time
+    Uint16 level;               // Comparator outputs at inputPs: bit 0 high, bit 1 low
+    HOST_CMPSS_FILTER filter[2];        // High, low
+    Uint16 trip4;               // TRIP4 of the ePWM X-BAR
+    Uint16 pending[HOST_TRIP_EPWMS];    // TZFLG.INT rose and its interrupt has not been taken
+} HOST_CMPSS_STATE;
+
+static volatile struct EPWM_REGS *const tripEpwm[HOST_TRIP_EPWMS] = {&EPwm1Regs, &EPwm5Regs};
+static HOST_CMPSS_STATE hostCmpss;
+static Uint64 hostCmpssPs;                  // Time CMPSS6 and the trip zones were last brought up to date
+
+static void HostDmaTrigger(Uint16 persel);
+static void QepTrack(void);
+static void SdfmTrack(void);
+
+Uint64 HostWallNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (Uint64)now.tv_sec * 1000000000ULL + (Uint64)now.tv_nsec;
+}
+
+float64 HostTime(void)
+{
+    return (float64)hostTimePs * 1e-12;
+}
+
+// asm() statements: only the interrupt mask matters to the emulation
+void HostAsm(const char *statement)
+{
+    if (strstr(statement, "clrc INTM") != NULL)
+    {
+        hostIntm = 0;
+    }
+    else if (strstr(statement, "setc INTM") != NULL)
+    {
+        hostIntm = 1;
+    }
+}
+
+// Interrupt intrinsics: the returned state is the previous INTM in bit 0, as in ST1
+Uint16 __disable_interrupts(void)
+{
+    Uint16 state = hostIntm;
+
+    hostIntm = 1;
+    return state;
+}
+
+Uint16 __enable_interrupts(void)
+{
+    Uint16 state = hostIntm;
+
+    hostIntm = 0;
+    return state;
+}
+
+void __restore_interrupts(Uint16 state)
+{
+    hostIntm = state & 1;
+}
+
+// TBCLK period of an ePWM module [ps]
+static Uint64 EpwmTbclkPs(volatile struct EPWM_REGS *epwm)
+{
+    Uint64 epwmclk = HOST_SYSCLK_HZ >> ClkCfgRegs.PERCLKDIVSEL.bit.EPWMCLKDIV;
+    Uint64 hspclkdiv = (epwm->TBCTL.bit.HSPCLKDIV == 0) ? 1 : 2 * epwm->TBCTL.bit.HSPCLKDIV;
+    Uint64 clkdiv = 1ULL << epwm->TBCTL.bit.CLKDIV;
+
+    return (1000000000000ULL * hspclkdiv * clkdiv) / epwmclk;
+}
+
+// ePWM2 SOCA period [ps], up-count mode with SOCA on period match
+static Uint64 SocaPeriodPs(void)
+{
+    return ((Uint64)EPwm2Regs.TBPRD + 1) * EpwmTbclkPs(&EPwm2Regs);
+}
+
+// ePWM6 period [ps], up-count mode
+static Uint64 Epwm6PeriodPs(void)
+{
+    return ((Uint64)EPwm6Regs.TBPRD + 1) * EpwmTbclkPs(&EPwm6Regs);
+}
+
+// Level of an up-counting ePWMxA output that is set on zero and cleared on CMPA, unless a one-shot
+// trip forces it low
+static Uint16 EpwmOutputA(volatile struct EPWM_REGS *epwm)
+{
+    Uint64 tbclk = EpwmTbclkPs(epwm);
+    Uint64 period = (Uint64)epwm->TBPRD + 1;
+    Uint64 counter = ((hostTimePs - hostEpwmStartPs) / tbclk) % period;
+
+    if ((epwm->TZFLG.bit.OST == 1) && (epwm->TZCTL.bit.TZA == 2))
+    {
+        return 0;
+    }
+    return (counter < epwm->CMPA.bit.CMPA) ? 1 : 0;
+}
+
+// CPU Timer 1 down-count at the current virtual time, counted from the moment it was started
+static void UpdateCpuTimer1(void)
+{
+    static Uint16 running;
+    static Uint64 startPs;
+    Uint64 cycles;
+
+    if (CpuTimer1Regs.TCR.bit.TSS == 1)
+    {
+        running = 0;
+        return;
+    }
+    if (running == 0)
+    {
+        running = 1;
+        startPs = hostTimePs;
+    }
+    cycles = (hostTimePs - startPs) / (1000000000000ULL / HOST_SYSCLK_HZ);
+    CpuTimer1Regs.TIM.all = CpuTimer1Regs.PRD.all - (Uint32)(cycles % ((Uint64)CpuTimer1Regs.PRD.all + 1));
+}
+
+// IPC free-running counter at SYSCLK, from reset
+static void UpdateIpcCounter(void)
+{
+    IpcRegs.IPCCOUNTERL = (Uint32)(hostTimePs / (1000000000000ULL / HOST_SYSCLK_HZ));
+}
+
+// Load one ADC's SOC0 result if it is powered and triggered by ePWM2 SOCA
+static void ConvertSoc0(volatile struct ADC_REGS *adc, volatile struct ADC_RESULT_REGS *result, Uint16 value)
+{
+    if ((adc->ADCCTL1.bit.ADCPWDNZ == 1) && (adc->ADCSOC0CTL.bit.TRIGSEL == 7))
+    {
+        result->ADCRESULT0 = value & 0x0FFF;
+    }
+}
+
+// Replay one ePWM2 SOCA: convert, flag ADCINT1 and run the ISR if the PIE lets it through
+static void HostSoca(void)
+{
+    Uint16 adc[HOST_ADC_CHANNELS];
+    Uint16 pulse;
+    Uint16 ran = 0;                         // ADCA1 ISR or CLA task 1 ran for this sample
+    Uint64 start;
+    Uint64 elapsed;
+
+    HostStats.socaEvents++;
+    HostStats.samplePeriod = (float64)SocaPeriodPs() * 1e-12;
+
+    SdfmTrack();                            // The SDFM data register is an input of this sample
+    HostInputHook(hostSample, HostTime(), adc);
+    ConvertSoc0(&AdcaRegs, &AdcaResultRegs, adc[0]);
+    ConvertSoc0(&AdcbRegs, &AdcbResultRegs, adc[1]);
+    ConvertSoc0(&AdccRegs, &AdccResultRegs, adc[2]);
+    ConvertSoc0(&AdcdRegs, &AdcdResultRegs, adc[3]);
+
+    GpioDataRegs.GPADAT.bit.GPIO0 = EpwmOutputA(&EPwm1Regs);   // PWM1A read back on GPIO0
+    UpdateCpuTimer1();
+    UpdateIpcCounter();
+    QepTrack();
+    EPwm2Regs.TBCTR = HOST_ADC_LATENCY_TICKS;                   // Counter value seen at ISR entry
+
+    // ADCINT1 pulse: a set flag blocks further pulses unless INT1CONT is set
+    pulse = 0;
+    if (AdcaRegs.ADCINTSEL1N2.bit.INT1E == 1)
+    {
+        if ((AdcaRegs.ADCINTFLG.bit.ADCINT1 == 1) && (AdcaRegs.ADCINTSEL1N2.bit.INT1CONT == 0))
+        {
+            HostStats.adcOverflows++;
+        }
+        else
+        {
+            AdcaRegs.ADCINTFLG.bit.ADCINT1 = 1;
+            pulse = 1;
+        }
+    }
+
+    if ((pulse == 1) && (PieCtrlRegs.PIECTRL.bit.ENPIE == 1) && (PieCtrlRegs.PIEIER1.bit.INTx1 == 1) &&
+        ((IER & M_INT1) != 0) && (hostIntm == 0) && (PieVectTable.ADCA1_INT != NULL))
+    {
+        // Write-one-to-clear registers are plain memory here: zero them and look for the 1
+        AdcaRegs.ADCINTFLGCLR.all = 0;
+        PieCtrlRegs.PIEACK.all = 0;
+
+        hostIntm = 1;                       // The CPU sets INTM on interrupt entry
+        start = HostWallNs();
+        PieVectTable.ADCA1_INT();
+        elapsed = HostWallNs() - start;
+        hostIntm = 0;
+
+        HostStats.isrCalls++;
+        HostStats.isrNsTotal += elapsed;
+        if (elapsed > HostStats.isrNsMax)
+        {
+            HostStats.isrNsMax = elapsed;
+        }
+
+        if (AdcaRegs.ADCINTFLGCLR.bit.ADCINT1 == 1)
+        {
+            AdcaRegs.ADCINTFLG.bit.ADCINT1 = 0;
+        }
+        else
+        {
+            HostStats.missedFlagClears++;
+        }
+        if ((PieCtrlRegs.PIEACK.all & PIEACK_GROUP1) == 0)
+        {
+            HostStats.missedPieAcks++;
+        }
+        ran = 1;
+    }
+
+    // The same pulse starts CLA task 1 if it is attached to ADCAINT1 and enabled
+    if ((pulse == 1) && (DmaClaSrcSelRegs.CLA1TASKSRCSEL1.bit.TASK1 == CLA_TRIG_ADCAINT1) &&
+        (Cla1Regs.MIER.bit.INT1 == 1) && (HostClaTask1 != NULL))
+    {
+        start = HostWallNs();
+        HostClaTask1();
+        elapsed = HostWallNs() - start;
+
+        HostStats.claTaskCalls++;
+        HostStats.claNsTotal += elapsed;
+        if (elapsed > HostStats.claNsMax)
+        {
+            HostStats.claNsMax = elapsed;
+        }
+        ran = 1;
+    }
+
+    // And the DMA channels attached to ADCAINT1
+    if (pulse == 1)
+    {
+        HostDmaTrigger(DMA_ADCAINT1);
+    }
+
+    if ((ran == 1) && (HostSampleHook != NULL))
+    {
+        HostSampleHook(hostSample, adc);
+    }
+    hostSample++;
+}
+
+// DMA: ePWM6 is replayed like ePWM2 while it counts up; its SOCA on CTR = 0 triggers the
+// DMA channels whose DMACHSRCSEL selects DMA_EPWM6A, and every ADCINT1 pulse those that
+// select DMA_ADCAINT1. A software trigger (CONTROL.PERINTFRC) is taken after the trigger
+// or the ISR that wrote it, or on the next DELAY_US. Bursts, transfer and wrap stepping,
+// one-shot and continuous mode and the shadow-to-active reload at the start of every
+// transfer are modelled; each burst completes in the instant of its trigger. Address
+// registers hold the low 32 bits of host pointers and steps count 16-bit words. Channel
+// interrupts reach PieVectTable.DMA_CHx_INT through PIE group 7. Peripheral frame 2 (DACs,
+// CMPSS, SDFM) is only reached while SECMSEL.PF2SEL gives it to the DMA.
+
+// DMA channel registers, CH1..CH6
+static volatile struct CH_REGS *const dmaChannel[HOST_DMA_CHANNELS] =
+{
+    &DmaRegs.CH1, &DmaRegs.CH2, &DmaRegs.CH3, &DmaRegs.CH4, &DmaRegs.CH5, &DmaRegs.CH6
+};
+
+// Trigger source selected for a channel (0 = CH1)
+static Uint16 DmaTriggerSource(Uint16 ch)
+{
+    switch (ch)
+    {
+    case 0:  return DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH1;
+    case 1:  return DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH2;
+    case 2:  return DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH3;
+    case 3:  return DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH4;
+    case 4:  return DmaClaSrcSelRegs.DMACHSRCSEL2.bit.CH5;
+    default: return DmaClaSrcSelRegs.DMACHSRCSEL2.bit.CH6;
+    }
+}
+
+// Host pointer behind a DMA address register: firmware data and the register file share the
+// upper half of their host addresses with DmaRegs
+static volatile Uint16 *DmaPointer(Uint32 address)
+{
+    return (volatile Uint16 *)(((uintptr_t)&DmaRegs & ~(uintptr_t)0xFFFFFFFFUL) | address);
+}
+
+// EMIF1: the SDRAM window is a static array of SDRAM_WORDS words (EMIF_WORDS in the
+// Makefile, smaller than a real device); sdram_store.c gets its DMA addresses from
+// HostEmif1Address(). The EMIF1 registers and the pin mux are plain memory.
+
+// DMA address of a word of the EMIF1 SDRAM window
+Uint32 HostEmif1Address(Uint32 word)
+{
+    assert(word < SDRAM_WORDS);
+    assert(DmaPointer((Uint32)(uintptr_t)&hostEmif1Cs0[word]) == &hostEmif1Cs0[word]);
+    return (Uint32)(uintptr_t)&hostEmif1Cs0[word];
+}
+
+// Peripheral frame 2 (DACs, CMPSS, SDFM): the DMA reaches it only once SECMSEL.PF2SEL selects
+// it as the secondary master instead of the CLA; otherwise the word is not moved
+static Uint16 DmaFrameRefused(volatile Uint16 *word)
+{
+    static volatile void *const frame2[][2] =
+    {
+        {&DacaRegs, &DacaRegs + 1}, {&DacbRegs, &DacbRegs + 1}, {&DaccRegs, &DaccRegs + 1},
+        {&Cmpss1Regs, &Cmpss1Regs + 1}, {&Cmpss2Regs, &Cmpss2Regs + 1}, {&Cmpss3Regs, &Cmpss3Regs + 1},
+        {&Cmpss4Regs, &Cmpss4Regs + 1}, {&Cmpss5Regs, &Cmpss5Regs + 1}, {&Cmpss6Regs, &Cmpss6Regs + 1},
+        {&Cmpss7Regs, &Cmpss7Regs + 1}, {&Cmpss8Regs, &Cmpss8Regs + 1},
+        {&Sdfm1Regs, &Sdfm1Regs + 1}, {&Sdfm2Regs, &Sdfm2Regs + 1},
+    };
+    Uint16 i;
+
+    if (CpuSysRegs.SECMSEL.bit.PF2SEL == 1)
+    {
+        return 0;
+    }
+    for (i = 0; i < sizeof(frame2) / sizeof(frame2[0]); i++)
+    {
+        if (((volatile void *)word >= frame2[i][0]) && ((volatile void *)word < frame2[i][1]))
+        {
+            HostStats.dmaFrameRefusals++;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Move an address register on by a signed number of 16-bit words
+static Uint32 DmaStep(Uint32 address, int16 words)
+{
+    return address + (Uint32)((int32)words * (int32)sizeof(Uint16));
+}
+
+// One trigger on a channel: start a transfer if none is in progress and move one burst, or
+// the whole transfer in one-shot mode. Returns 1 if the channel interrupt is due.
+static Uint16 DmaService(volatile struct CH_REGS *ch)
+{
+    Uint16 due = 0;
+    Uint16 words = ch->MODE.bit.DATASIZE ? 2 : 1;
+    Uint16 n;
+    Uint16 w;
+
+    // Write-only control bits take effect in the order the firmware uses them
+    if (ch->CONTROL.bit.HALT == 1)
+    {
+        ch->CONTROL.bit.RUNSTS = 0;
+    }
+    if (ch->CONTROL.bit.SOFTRESET == 1)
+    {
+        ch->CONTROL.bit.TRANSFERSTS = 0;
+        ch->CONTROL.bit.BURSTSTS = 0;
+    }
+    if (ch->CONTROL.bit.RUN == 1)
+    {
+        ch->CONTROL.bit.RUNSTS = 1;
+    }
+    ch->CONTROL.all &= ~0x009F;             // RUN, HALT, SOFTRESET, PERINTFRC, PERINTCLR, ERRCLR read as 0
+    if ((ch->CONTROL.bit.RUNSTS == 0) || (ch->MODE.bit.PERINTE == 0))
+    {
+        return 0;
+    }
+
+    do
+    {
+        if (ch->CONTROL.bit.TRANSFERSTS == 0)
+        {
+            ch->SRC_BEG_ADDR_ACTIVE = ch->SRC_BEG_ADDR_SHADOW;
+            ch->SRC_ADDR_ACTIVE = ch->SRC_ADDR_SHADOW;
+            ch->DST_BEG_ADDR_ACTIVE = ch->DST_BEG_ADDR_SHADOW;
+            ch->DST_ADDR_ACTIVE = ch->DST_ADDR_SHADOW;
+            ch->TRANSFER_COUNT = ch->TRANSFER_SIZE;
+            ch->SRC_WRAP_COUNT = ch->SRC_WRAP_SIZE;
+            ch->DST_WRAP_COUNT = ch->DST_WRAP_SIZE;
+            ch->CONTROL.bit.TRANSFERSTS = 1;
+            due |= (ch->MODE.bit.CHINTMODE == 0);
+        }
+
+        for (n = 0; n <= ch->BURST_SIZE.all; n++)
+        {
+            for (w = 0; w < words; w++)
+            {
+                if (!DmaFrameRefused(&DmaPointer(ch->DST_ADDR_ACTIVE)[w]) &&
+                    !DmaFrameRefused(&DmaPointer(ch->SRC_ADDR_ACTIVE)[w]))
+                {
+                    DmaPointer(ch->DST_ADDR_ACTIVE)[w] = DmaPointer(ch->SRC_ADDR_ACTIVE)[w];
+                }
+            }
+            if (n < ch->BURST_SIZE.all)
+            {
+                ch->SRC_ADDR_ACTIVE = DmaStep(ch->SRC_ADDR_ACTIVE, ch->SRC_BURST_STEP);
+                ch->DST_ADDR_ACTIVE = DmaStep(ch->DST_ADDR_ACTIVE, ch->DST_BURST_STEP);
+            }
+        }
+        HostStats.dmaBursts++;
+
+        if (ch->TRANSFER_COUNT == 0)
+        {
+            ch->CONTROL.bit.TRANSFERSTS = 0;
+            due |= (ch->MODE.bit.CHINTMODE == 1);
+            if (ch->MODE.bit.CONTINUOUS == 0)
+            {
+                ch->CONTROL.bit.RUNSTS = 0;
+            }
+            break;
+        }
+        ch->TRANSFER_COUNT--;
+
+        // Next burst: transfer step, or back to the (stepped) beginning when the wrap count runs out
+        if (ch->SRC_WRAP_COUNT == 0)
+        {
+            ch->SRC_WRAP_COUNT = ch->SRC_WRAP_SIZE;
+            ch->SRC_BEG_ADDR_ACTIVE = DmaStep(ch->SRC_BEG_ADDR_ACTIVE, ch->SRC_WRAP_STEP);
+            ch->SRC_ADDR_ACTIVE = ch->SRC_BEG_ADDR_ACTIVE;
+        }
+        else
+        {
+            ch->SRC_WRAP_COUNT--;
+            ch->SRC_ADDR_ACTIVE = DmaStep(ch->SRC_ADDR_ACTIVE, ch->SRC_TRANSFER_STEP);
+        }
+        if (ch->DST_WRAP_COUNT == 0)
+        {
+            ch->DST_WRAP_COUNT = ch->DST_WRAP_SIZE;
+            ch->DST_BEG_ADDR_ACTIVE = DmaStep(ch->DST_BEG_ADDR_ACTIVE, ch->DST_WRAP_STEP);
+            ch->DST_ADDR_ACTIVE = ch->DST_BEG_ADDR_ACTIVE;
+        }
+        else
+        {
+            ch->DST_WRAP_COUNT--;
+            ch->DST_ADDR_ACTIVE = DmaStep(ch->DST_ADDR_ACTIVE, ch->DST_TRANSFER_STEP);
+        }
+    } while (ch->MODE.bit.ONESHOT == 1);
+
+    return due && (ch->MODE.bit.CHINTE == 1);
+}
+
+// Run a DMA channel ISR if the PIE lets it through and check its handshake
+static void DmaCallIsr(Uint16 ch)
+{
+    PINT isr = (&PieVectTable.DMA_CH1_INT)[ch];
+
+    if ((PieCtrlRegs.PIECTRL.bit.ENPIE == 0) || ((PieCtrlRegs.PIEIER7.all & (1U << ch)) == 0) ||
+        ((IER & M_INT7) == 0) || (hostIntm == 1) || (isr == NULL))
+    {
+        return;
+    }
+
+    PieCtrlRegs.PIEACK.all = 0;
+
+    hostIntm = 1;
+    isr();
+    hostIntm = 0;
+    HostStats.dmaIsrCalls++;
+    HostStats.dmaChIsrCalls[ch]++;
+
+    if ((PieCtrlRegs.PIEACK.all & PIEACK_GROUP7) == 0)
+    {
+        HostStats.dmaMissedPieAcks++;
+    }
+}
+
+// Software triggers (PERINTFRC) written by the firmware or a hook since the last look: each
+// forced channel is serviced as if its peripheral had fired, then its interrupt is taken
+static void HostDmaForced(void)
+{
+    Uint16 ch;
+
+    for (ch = 0; ch < HOST_DMA_CHANNELS; ch++)
+    {
+        if ((dmaChannel[ch]->CONTROL.bit.PERINTFRC == 1) && (DmaService(dmaChannel[ch]) == 1))
+        {
+            DmaCallIsr(ch);
+        }
+    }
+}
+
+// A DMA trigger: every channel attached to it moves its burst in priority order (CH1 first),
+// then the channel interrupts that fell due are taken
+static void HostDmaTrigger(Uint16 persel)
+{
+    Uint16 due[HOST_DMA_CHANNELS];
+    Uint16 ch;
+
+    for (ch = 0; ch < HOST_DMA_CHANNELS; ch++)
+    {
+        due[ch] = (DmaTriggerSource(ch) == persel) ? DmaService(dmaChannel[ch]) : 0;
+    }
+    for (ch = 0; ch < HOST_DMA_CHANNELS; ch++)
+    {
+        if (due[ch] == 1)
+        {
+            DmaCallIsr(ch);
+        }
+    }
+    if (HostDmaHook != NULL)
+    {
+        HostDmaHook(persel);
+    }
+    HostDmaForced();
+}
+
+// ePWM6 counts while the time bases are synchronized and it is in up-count mode, from zero
+// at the moment it is un-frozen
+static void Epwm6Track(void)
+{
+    if ((CpuSysRegs.PCLKCR0.bit.TBCLKSYNC == 0) || (EPwm6Regs.TBCTL.bit.CTRMODE != 0))
+    {
+        hostEpwm6Running = 0;
+    }
+    else if (hostEpwm6Running == 0)
+    {
+        hostEpwm6Running = 1;
+        hostNextEpwm6Ps = hostTimePs + Epwm6PeriodPs();
+    }
+}
+
+// Replay one ePWM6 CTR = 0: its SOCA, if enabled on that event, triggers the DMA
+static void HostEpwm6Zero(void)
+{
+    if ((EPwm6Regs.ETSEL.bit.SOCAEN == 1) && (EPwm6Regs.ETSEL.bit.SOCASEL == 1))
+    {
+        HostStats.epwm6SocaEvents++;
+        UpdateCpuTimer1();
+        UpdateIpcCounter();
+        HostDmaTrigger(DMA_EPWM6A);
+    }
+}
+
+// eCAP time stamp counter at a given time
+static Uint32 EcapCounter(const HOST_ECAP *e, Uint64 ps)
+{
+    return e->base + (Uint32)((ps - e->zeroPs) / HOST_ECAP_CYCLE_PS);
+}
+
+// Register writes the firmware made since the last call, taken at the time it made them:
+// counter start/stop, SWSYNC down the sync chain, REARM and ECCLR. The host only sees
+// ECCTL2 after the firmware has moved on, so a SWSYNC loads the chain whether or not
+// SYNCI_EN is still set (ecap_measure.c clears it right after the sync).
+static void EcapControl(Uint64 ps)
+{
+    volatile struct ECAP_REGS *cap;
+    HOST_ECAP *e;
+    Uint16 m;
+    Uint16 n;
+
+    for (m = 0; m < HOST_ECAP_MODULES; m++)
+    {
+        cap = ecapModule[m];
+        e = &hostEcap[m];
+        if (cap->ECCTL2.bit.TSCTRSTOP == 0)
+        {
+            e->running = 0;
+        }
+        else if (e->running == 0)
+        {
+            e->running = 1;
+            e->zeroPs = ps;
+            e->base = cap->TSCTR;
+        }
+        if (cap->ECCTL2.bit.SWSYNC == 1)
+        {
+            cap->ECCTL2.bit.SWSYNC = 0;                         // Write-only, reads 0
+            for (n = m; n < HOST_ECAP_MODULES; n++)             // Down the chain while SYNCO = SYNCI
+            {
+                hostEcap[n].zeroPs = ps;
+                hostEcap[n].base = ecapModule[n]->CTRPHS;
+                if ((n == 2) || (n == 5) || (ecapModule[n]->ECCTL2.bit.SYNCO_SEL != 0))
+                {
+                    break;                                      // eCAP1-3 and eCAP4-6 are separate chains
+                }
+            }
+        }
+        if (cap->ECCTL2.bit.REARM == 1)
+        {
+            cap->ECCTL2.bit.REARM = 0;                          // Write-only, reads 0
+            e->armed = 1;
+            e->event = 0;
+        }
+        if (cap->ECCLR.all != 0)
+        {
+            cap->ECFLG.all &= ~cap->ECCLR.all;
+            cap->ECCLR.all = 0;
+        }
+    }
+}
+
+// One edge on a pin: every running capture-mode module whose Input X-BAR input selects the pin
+// and whose next event has this polarity latches its counter (PRESCALE is not modelled)
+static void EcapEdge(Uint16 gpio, Uint16 level, Uint64 ps)
+{
+    const volatile Uint16 *select = &InputXbarRegs.INPUT7SELECT;    // INPUT7..12 feed eCAP1..6
+    volatile struct ECAP_REGS *cap;
+    HOST_ECAP *e;
+    Uint16 m;
+
+    for (m = 0; m < HOST_ECAP_MODULES; m++)
+    {
+        cap = ecapModule[m];
+        e = &hostEcap[m];
+        if ((e->running == 0) || (e->armed == 0) || (select[m] != gpio) ||
+            (cap->ECCTL2.bit.CAP_APWM != 0) || (cap->ECCTL1.bit.CAPLDEN == 0) ||
+            (((cap->ECCTL1.all >> (2 * e->event)) & 1) == level))   // CAPxPOL: 0 rising, 1 falling
+        {
+            continue;
+        }
+        (&cap->CAP1)[e->event] = EcapCounter(e, ps);
+        if (((cap->ECCTL1.all >> (2 * e->event + 1)) & 1) == 1)     // CTRRSTx
+        {
+            e->base = 0;
+            e->zeroPs = ps;
+        }
+        cap->ECFLG.all |= 2 << e->event;                            // CEVTx
+        if (e->event >= cap->ECCTL2.bit.STOP_WRAP)
+        {
+            e->event = 0;
+            e->armed = (cap->ECCTL2.bit.CONT_ONESHT == 0) ? 1 : 0;  // One-shot stops until REARM
+        }
+        else
+        {
+            e->event++;
+        }
+    }
+}
+
+// Start a waveform with the ePWM time bases: ePWM5 is zeroed by the ePWM1 sync where TBPHS
+// puts it, HostExtPwm rises HostExtPwm.delayPs after the time bases start
+static void PwmWaveStart(HOST_PWM_WAVE *w)
+{
+    Uint64 prd;
+
+    w->running = 1;
+    w->level = 0;
+    w->fallPs = 0;
+    w->tripPs = 0;
+    w->head = 0;
+    w->count = 0;
+    if (w->epwm == NULL)
+    {
+        w->gpio = HostExtPwm.gpio;
+        w->running = (HostExtPwm.periodPs != 0) ? 1 : 0;
+        w->nextPs = hostEpwmStartPs + HostExtPwm.delayPs;
+    }
+    else if (w->epwm->TBCTL.bit.PHSEN == 1)
+    {
+        prd = (Uint64)w->epwm->TBPRD + 1;
+        w->nextPs = hostEpwmStartPs + ((prd - w->epwm->TBPHS.bit.TBPHS % prd) % prd) * EpwmTbclkPs(w->epwm);
+    }
+    else
+    {
+        w->nextPs = hostEpwmStartPs;
+    }
+}
+
+// Length and high time of the period starting at startPs [ps]; an ePWM loads CMPA:CMPAHR from its
+// shadow here, and the MEP moves the falling edge by the CMPAHR fraction converted with HRMSTEP
+static void PwmWavePeriod(HOST_PWM_WAVE *w, Uint64 startPs, Uint64 *periodPs, Uint64 *highPs)
+{
+    volatile struct EPWM_REGS *epwm = w->epwm;
+    Uint64 tbclk;
+    Uint64 prd;
+    Uint32 compare;
+    Uint16 mep;
+
+    if (epwm == NULL)
+    {
+        *periodPs = HostExtPwm.periodPs;
+        *highPs = HostExtPwm.highPs;
+        return;
+    }
+    tbclk = EpwmTbclkPs(epwm);
+    prd = (Uint64)epwm->TBPRD + 1;
+    compare = epwm->CMPA.all;
+    mep = epwm->HRMSTEP.bit.HRMSTEP;
+    *periodPs = prd * tbclk;
+    *highPs = (Uint64)(compare >> 16) * tbclk;
+    if ((epwm->HRCNFG.bit.EDGMODE == 2) && (mep != 0))
+    {
+        *highPs += (Uint64)((((compare >> 8) & 0xFF) * mep + 0x80) >> 8) * tbclk / mep;
+    }
+    if ((compare >> 16) >= prd)
+    {
+        *highPs = *periodPs;                // CMPA beyond the period: never cleared
+    }
+
+    w->head = (w->head + 1) % HOST_PWM_HISTORY;
+    w->startPs[w->head] = startPs;
+    w->compare[w->head] = compare;
+    if (w->count < HOST_PWM_HISTORY)
+    {
+        w->count++;
+    }
+}
+
+// End of the period starting at startPs [ps] of a waveform whose ePWM loads TBPHS on the ePWM1
+// sync: the next zero after it where TBPHS puts it on the grid of ePWM1 zeros. The sync comes on
+// every ePWM1 period, so a phase written after the time bases started takes effect one period later.
+static Uint64 PwmWaveSynced(HOST_PWM_WAVE *w, Uint64 startPs, Uint64 periodPs)
+{
+    Uint64 prd = (Uint64)w->epwm->TBPRD + 1;
+    Uint64 syncPeriodPs = HostEpwmPeriodPs(&EPwm1Regs);
+    Uint64 zeroPs;
+
+    if ((w->epwm->TBCTL.bit.PHSEN == 0) || (EPwm1Regs.TBCTL.bit.SYNCOSEL != 1) || (hostWave[0].running == 0))
+    {
+        return startPs + periodPs;          // Free running
+    }
+    zeroPs = hostWave[0].nextPs + ((prd - w->epwm->TBPHS.bit.TBPHS % prd) % prd) * EpwmTbclkPs(w->epwm);
+    return zeroPs - ((zeroPs - startPs - 1) / syncPeriodPs) * syncPeriodPs;    // ePWM1 runs first, so zeroPs > startPs
+}
+
+// Replay the edges of a waveform up to the given time into the eCAPs, in time order; a trip holds
+// the pin low from its time until it is lifted, and the pin comes back at the next period
+static void PwmWaveRun(HOST_PWM_WAVE *w, Uint64 untilPs)
+{
+    Uint64 periodPs;
+    Uint64 highPs;
+
+    while (w->running == 1)
+    {
+        if ((w->tripPs != 0) && (w->tripPs <= untilPs) && (w->level == 1) && (w->tripPs < w->nextPs) &&
+            ((w->fallPs == 0) || (w->tripPs < w->fallPs)))
+        {
+            w->level = 0;
+            EcapEdge(w->gpio, 0, w->tripPs);
+            w->fallPs = 0;
+        }
+        else if ((w->fallPs != 0) && (w->fallPs <= untilPs) && (w->fallPs < w->nextPs))
+        {
+            w->level = 0;
+            EcapEdge(w->gpio, 0, w->fallPs);
+            w->fallPs = 0;
+        }
+        else if (w->nextPs <= untilPs)
+        {
+            PwmWavePeriod(w, w->nextPs, &periodPs, &highPs);
+            if ((w->tripPs != 0) && (w->tripPs <= w->nextPs))
+            {
+                highPs = 0;                 // Held low by the trip
+            }
+            if ((highPs != 0) != (w->level != 0))
+            {
+                w->level ^= 1;
+                EcapEdge(w->gpio, w->level, w->nextPs);     // Set on zero, or cleared at once by CMPA = 0
+            }
+            w->fallPs = ((highPs != 0) && (highPs < periodPs)) ? w->nextPs + highPs : 0;
+            w->nextPs = (w == hostWave) || (w->epwm == NULL) ? w->nextPs + periodPs : PwmWaveSynced(w, w->nextPs, periodPs);
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+// Bring the eCAPs up to the current time: the register writes made at the last call first,
+// then every edge since on the pins they watch
+static void EcapTrack(void)
+{
+    Uint16 i;
+
+    EcapControl(hostEcapPs);
+    if (hostEpwmRunning == 1)
+    {
+        for (i = 0; i < HOST_PWM_WAVES; i++)
+        {
+            PwmWaveRun(&hostWave[i], hostTimePs);
+        }
+    }
+    for (i = 0; i < HOST_ECAP_MODULES; i++)
+    {
+        if (hostEcap[i].running == 1)
+        {
+            ecapModule[i]->TSCTR = EcapCounter(&hostEcap[i], hostTimePs);
+        }
+    }
+    hostEcapPs = hostTimePs;
+}
+
+Uint64 HostEpwmPeriodPs(volatile struct EPWM_REGS *epwm)
+{
+    return ((Uint64)epwm->TBPRD + 1) * EpwmTbclkPs(epwm);
+}
+
+Uint32 HostEpwmCompareAt(volatile struct EPWM_REGS *epwm, Uint64 ps)
+{
+    HOST_PWM_WAVE *w;
+    Uint16 i;
+    Uint16 slot;
+
+    for (w = hostWave; w < hostWave + HOST_PWM_WAVES; w++)
+    {
+        if ((w->epwm != epwm) || (epwm == NULL))
+        {
+            continue;
+        }
+        for (i = 0; i < w->count; i++)
+        {
+            slot = (w->head + HOST_PWM_HISTORY - i) % HOST_PWM_HISTORY;
+            if (w->startPs[slot] <= ps)
+            {
+                return (i == 0) && (ps >= w->nextPs) ? HOST_COMPARE_NONE : w->compare[slot];
+            }
+        }
+    }
+    return HOST_COMPARE_NONE;
+}
+
+Uint64 HostEcapStampPs(volatile struct ECAP_REGS *cap, Uint32 stamp)
+{
+    Uint16 m;
+
+    for (m = 0; m < HOST_ECAP_MODULES; m++)
+    {
+        if (ecapModule[m] == cap)
+        {
+            return hostEcap[m].zeroPs + (Uint64)(Uint32)(stamp - hostEcap[m].base) * HOST_ECAP_CYCLE_PS;
+        }
+    }
+    return 0;
+}
+// CAPCLK ticks in an interval, saturated at 0xFFFF with COEF
+static Uint16 QepTicks(Uint64 ps)
+{
+    Uint64 ticks = ps / (HOST_ECAP_CYCLE_PS << EQep1Regs.QCAPCTL.bit.CCPS);
+
+    if (ticks > 0xFFFF)
+    {
+        hostQep.flags |= HOST_QEP_STS_COEF;
+        return 0xFFFF;
+    }
+    return (Uint16)ticks;
+}
+
+// Bring eQEP1 up to the current time: the flag clears the firmware wrote since the last call,
+// the edges the shaft made since, the capture unit, then the latches of the QPOSCNT read
+static void QepTrack(void)
+{
+    volatile struct EQEP_REGS *qep = &EQep1Regs;
+    HOST_QEP *q = &hostQep;
+    float64 shaft;
+    float64 index;
+    float64 unit;
+    float64 last;
+    float64 previous;
+    Uint64 span;
+    Uint64 lastPs;
+    Uint64 previousPs;
+    int64 revolution;
+    int64 crossed;
+    int16 dir;
+
+    if ((HostEncoder.position == NULL) || (qep->QEPCTL.bit.QPEN == 0))
+    {
+        q->running = 0;
+        return;
+    }
+    shaft = HostEncoder.position(HostTime());
+    if (q->running == 0)
+    {
+        q->running = 1;
+        q->shaft = shaft;
+        q->ps = hostTimePs;
+        q->eventPs = hostTimePs;
+        q->eventDir = 0;
+        q->up = 1;
+        q->flags = 0;
+        qep->QEPSTS.all = HOST_QEP_STS_MARK;
+    }
+
+    // Write-one-to-clear registers are plain memory here
+    if ((qep->QEPSTS.all & HOST_QEP_STS_MARK) == 0)
+    {
+        q->flags &= ~(qep->QEPSTS.all & HOST_QEP_STS_W1C);
+    }
+    qep->QFLG.all &= ~qep->QCLR.all;
+    qep->QCLR.all = 0;
+
+    // Counter: edges lost by the encoder line are lost before the ones of this interval
+    revolution = (int64)qep->QPOSMAX + 1;
+    crossed = (int64)qep->QPOSCNT - HostEncoder.missed;
+    HostEncoder.missed = 0;
+    if (shaft != q->shaft)
+    {
+        q->up = (shaft > q->shaft) ? 1 : 0;
+    }
+
+    // Index: the last marker passed in this interval latches the counter as it was there
+    if ((HostEncoder.countsPerRev != 0) && (shaft != q->shaft))
+    {
+        if (shaft > q->shaft)
+        {
+            index = HostEncoder.indexCounts + floor((shaft - HostEncoder.indexCounts) / HostEncoder.countsPerRev) *
+                    HostEncoder.countsPerRev;
+        }
+        else
+        {
+            index = HostEncoder.indexCounts + ceil((shaft - HostEncoder.indexCounts) / HostEncoder.countsPerRev) *
+                    HostEncoder.countsPerRev;
+        }
+        if ((shaft > q->shaft) ? (index > q->shaft) : (index < q->shaft))
+        {
+            qep->QPOSILAT = (Uint32)((((crossed + (int64)floor(index) - (int64)floor(q->shaft)) % revolution) +
+                                      revolution) % revolution);
+            qep->QFLG.bit.IEL = 1;
+        }
+    }
+    crossed += (int64)floor(shaft) - (int64)floor(q->shaft);
+    qep->QPOSCNT = (Uint32)(((crossed % revolution) + revolution) % revolution);
+
+    // Capture unit: unit position events where the shaft crosses a multiple of 2^UPPS counts
+    if (qep->QCAPCTL.bit.CEN == 1)
+    {
+        unit = (float64)(1U << qep->QCAPCTL.bit.UPPS);
+        span = hostTimePs - q->ps;
+        dir = 0;
+        if (shaft > q->shaft)
+        {
+            last = floor(shaft / unit) * unit;
+            dir = (last > q->shaft) ? 1 : 0;
+            previous = last - unit;
+        }
+        else if (shaft < q->shaft)
+        {
+            last = ceil(shaft / unit) * unit;
+            dir = (last < q->shaft) ? -1 : 0;
+            previous = last + unit;
+        }
+        if (dir != 0)
+        {
+            lastPs = q->ps + (Uint64)((float64)span * (last - q->shaft) / (shaft - q->shaft));
+            previousPs = ((dir > 0) ? (previous > q->shaft) : (previous < q->shaft)) ?
+                         q->ps + (Uint64)((float64)span * (previous - q->shaft) / (shaft - q->shaft)) : q->eventPs;
+            if ((q->eventDir != 0) && (dir != q->eventDir))
+            {
+                q->flags |= HOST_QEP_STS_CDEF;
+            }
+            qep->QCPRD = QepTicks(lastPs - previousPs);
+            q->flags |= HOST_QEP_STS_UPEVNT;
+            q->eventPs = lastPs;
+            q->eventDir = dir;
+        }
+        qep->QCTMR = QepTicks(hostTimePs - q->eventPs);
+    }
+    else
+    {
+        q->eventPs = hostTimePs;
+        q->eventDir = 0;
+    }
+    q->shaft = shaft;
+    q->ps = hostTimePs;
+
+    qep->QEPSTS.all = q->flags | ((q->up == 1) ? HOST_QEP_STS_QDF : 0) | HOST_QEP_STS_MARK;
+    if (qep->QEPCTL.bit.QCLM == 0)
+    {
+        qep->QCTMRLAT = qep->QCTMR;             // As read with QPOSCNT by the ISR
+        qep->QCPRDLAT = qep->QCPRD;
+    }
+}
+
+// One bit into a sinc filter of the given order; returns 1 and the output every osr bits
+static Uint16 SincStep(HOST_SINC *f, Uint16 order, Uint16 osr, Uint16 bit, Uint32 *out)
+{
+    Uint32 value;
+    Uint32 input;
+    Uint16 stage;
+
+    f->integrator[0] += bit;
+    for (stage = 1; stage < order; stage++)
+    {
+        f->integrator[stage] += f->integrator[stage - 1];
+    }
+    if (++f->phase < osr)
+    {
+        return 0;
+    }
+    f->phase = 0;
+    value = f->integrator[order - 1];
+    for (stage = 0; stage < order; stage++)
+    {
+        input = value;
+        value -= f->comb[stage];
+        f->comb[stage] = input;
+    }
+    *out = value;
+    return 1;
+}
+
+// Run the SD1 ISR if the PIE lets it through and check its handshake
+static void SdfmCallIsr(void)
+{
+    volatile struct SDFM_REGS *sd = &Sdfm1Regs;
+
+    if ((PieCtrlRegs.PIECTRL.bit.ENPIE == 0) || (PieCtrlRegs.PIEIER5.bit.INTx9 == 0) ||
+        ((IER & M_INT5) == 0) || (hostIntm == 1) || (PieVectTable.SD1_INT == NULL))
+    {
+        return;
+    }
+
+    // Write-one-to-clear registers are plain memory here: zero them and look for the 1
+    sd->SDIFLGCLR.all = 0;
+    PieCtrlRegs.PIEACK.all = 0;
+
+    hostIntm = 1;
+    PieVectTable.SD1_INT();
+    hostIntm = 0;
+    HostStats.sdfmIsrCalls++;
+    hostSdfm.pending = 0;
+
+    if ((sd->SDIFLGCLR.all & HOST_SDFM_FLG_MIF) == 0)
+    {
+        HostStats.sdfmMissedFlagClears++;
+    }
+    sd->SDIFLG.all &= ~sd->SDIFLGCLR.all;
+    sd->SDIFLGCLR.all = 0;
+    if ((PieCtrlRegs.PIEACK.all & PIEACK_GROUP5) == 0)
+    {
+        HostStats.sdfmMissedPieAcks++;
+    }
+}
+
+// Bring SDFM1 filter 1 up to the current time: the flag clears the firmware wrote since the last
+// call, every modulator bit since through both filters, then the interrupt if MIF rose
+static void SdfmTrack(void)
+{
+    volatile struct SDFM_REGS *sd = &Sdfm1Regs;
+    HOST_SDFM_STATE *s = &hostSdfm;
+    Uint64 bitPs;
+    Uint32 out;
+    Uint32 flags;
+    Uint32 span;
+    int32 data;
+    float64 x;
+    Uint16 bit;
+    Uint16 stage;
+    Uint16 comparatorOrder = sd->SDCPARM1.bit.CS1_CS0;
+    Uint16 comparatorOsr = sd->SDCPARM1.bit.COSR + 1;
+    Uint16 dataOrder = sd->SDDFPARM1.bit.SST;
+    Uint16 dataOsr = sd->SDDFPARM1.bit.DOSR + 1;
+
+    sd->SDIFLG.all &= ~sd->SDIFLGCLR.all;
+    sd->SDIFLGCLR.all = 0;
+
+    if ((HostSdfm.input == NULL) || (HostSdfm.clockHz == 0))
+    {
+        return;
+    }
+    bitPs = 1000000000000ULL / HostSdfm.clockHz;
+    if (sd->SDMFILEN.bit.MFE == 0)
+    {
+        s->comparatorRunning = 0;
+        s->dataRunning = 0;
+        HostSdfm.bits = hostTimePs / bitPs + 1; // Nobody listens to the modulator
+        return;
+    }
+    if (s->comparatorRunning == 0)
+    {
+        s->comparatorRunning = 1;
+        memset(&s->comparator, 0, sizeof(s->comparator));
+    }
+    if (sd->SDDFPARM1.bit.FEN == 0)
+    {
+        s->dataRunning = 0;
+    }
+    else if (s->dataRunning == 0)
+    {
+        s->dataRunning = 1;
+        memset(&s->data, 0, sizeof(s->data));
+        HostSdfm.dataStart = HostSdfm.bits;
+    }
+    span = 1;
+    for (stage = 0; stage < dataOrder; stage++)
+    {
+        span *= dataOsr;
+    }
+
+    while (HostSdfm.bits * bitPs <= hostTimePs)
+    {
+        // Modulator: two integrators with half-scale gains and a one-bit quantizer
+        x = HostSdfm.input((float64)(HostSdfm.bits * bitPs) * 1e-12);
+        x = (x > 1.0) ? 1.0 : (x < -1.0) ? -1.0 : x;
+        s->loop1 += 0.5 * (x - s->feedback);
+        s->loop2 += 0.5 * (s->loop1 - s->feedback);
+        bit = (s->loop2 >= 0.0) ? 1 : 0;
+        s->feedback = (bit == 1) ? 1.0 : -1.0;
+        s->history[HostSdfm.bits % HOST_SDFM_HISTORY] = bit;
+        HostSdfm.bits++;
+
+        if ((comparatorOrder != 0) && (SincStep(&s->comparator, comparatorOrder, comparatorOsr, bit, &out) == 1))
+        {
+            flags = 0;
+            if (out > sd->SDCMPH1.bit.HLT)
+            {
+                flags |= HOST_SDFM_FLG_IFH1;
+            }
+            if (out < sd->SDCMPL1.bit.LLT)
+            {
+                flags |= HOST_SDFM_FLG_IFL1;
+            }
+            if (((flags & ~sd->SDIFLG.all) != 0) && (HostSdfm.flagPs == 0))
+            {
+                HostSdfm.flagPs = (HostSdfm.bits - 1) * bitPs;
+            }
+            HostSdfm.flagRose |= (Uint16)(flags & ~sd->SDIFLG.all);
+            sd->SDIFLG.all |= flags;
+            if ((((flags & HOST_SDFM_FLG_IFH1) != 0) && (sd->SDCPARM1.bit.IEH == 1)) ||
+                (((flags & HOST_SDFM_FLG_IFL1) != 0) && (sd->SDCPARM1.bit.IEL == 1)))
+            {
+                if ((sd->SDIFLG.all & HOST_SDFM_FLG_MIF) == 0)
+                {
+                    s->pending = 1;
+                }
+                sd->SDIFLG.all |= HOST_SDFM_FLG_MIF;
+            }
+        }
+        if ((s->dataRunning == 1) && (dataOrder != 0) && (SincStep(&s->data, dataOrder, dataOsr, bit, &out) == 1))
+        {
+            data = (int32)out - (int32)(span / 2);
+            sd->SDDATA1.all = (sd->SDIPARM1.bit.DR == 0) ? (Uint32)(Uint16)(int16)(data >> sd->SDIPARM1.bit.SH) :
+                                                           (Uint32)data;
+            sd->SDIFLG.all |= HOST_SDFM_FLG_AF1;
+            HostSdfm.dataBits = HostSdfm.bits;
+        }
+    }
+
+    if ((s->pending == 1) && (sd->SDCTL.bit.MIE == 1))
+    {
+        SdfmCallIsr();
+    }
+}
+
+Uint16 HostSdfmBit(Uint64 n)
+{
+    return hostSdfm.history[n % HOST_SDFM_HISTORY];
+}
+
+// Comparator outputs for an input level [ADC code]: bit 0 high, bit 1 low, each after COMPxINV
+static Uint16 CmpssLevel(float64 x)
+{
+    volatile struct CMPSS_REGS *c = &Cmpss6Regs;
+    Uint16 high = (x > (float64)c->DACHVALA.bit.DACVAL) ? 1 : 0;
+    Uint16 low = (x > (float64)c->DACLVALA.bit.DACVAL) ? 1 : 0;
+
+    return (high ^ c->COMPCTL.bit.COMPHINV) | ((low ^ c->COMPCTL.bit.COMPLINV) << 1);
+}
+
+// Comparator outputs for the input at a given time [ps]
+static Uint16 CmpssLevelAt(Uint64 ps)
+{
+    float64 jump;
+
+    return CmpssLevel(HostCmpss.input((float64)ps * 1e-12, &jump));
+}
+
+// Set a one-shot trip of ePWM1 (0) or ePWM5 (1) held by TRIP4, as DCAEVT1 routes it
+static void CmpssTripEpwm(Uint16 i, Uint64 ps)
+{
+    volatile struct EPWM_REGS *epwm = tripEpwm[i];
+    Uint16 flags = HOST_TZ_DCAEVT1;
+    Uint16 rose;
+
+    if ((epwm->DCTRIPSEL.bit.DCAHCOMPSEL != 3) || (epwm->TZDCSEL.bit.DCAEVT1 != 2) ||
+        (epwm->DCACTL.bit.EVT1SRCSEL != 0))
+    {
+        return;                             // DCAEVT1 is not TRIPIN4 high, unfiltered
+    }
+    if (epwm->TZSEL.bit.DCAEVT1 == 1)
+    {
+        flags |= HOST_TZ_OST;
+        epwm->TZOSTFLG.all |= HOST_TZOST_DCAEVT1;
+    }
+    rose = flags & ~epwm->TZFLG.all;
+    epwm->TZFLG.all |= flags;
+    if ((rose & HOST_TZ_OST) != 0)
+    {
+        HostCmpss.tripPs[i] = ps;
+        if ((epwm->TZCTL.bit.TZA == 2) && (hostWave[i].tripPs == 0))
+        {
+            hostWave[i].tripPs = ps;        // PWMxA forced low
+        }
+    }
+    if (((((rose & HOST_TZ_OST) != 0) && (epwm->TZEINT.bit.OST == 1)) ||
+         (((rose & HOST_TZ_DCAEVT1) != 0) && (epwm->TZEINT.bit.DCAEVT1 == 1))) &&
+        (epwm->TZFLG.bit.INT == 0))
+    {
+        epwm->TZFLG.bit.INT = 1;
+        hostCmpss.pending[i] = 1;
+    }
+}
+
+// CTRIPH (0) or CTRIPL (1) as CTRIPxSEL picks it: the comparator (asynchronous, or synchronous to
+// SYSCLK, which is not modelled), the filter, or the filter latched
+static Uint16 CmpssCtrip(Uint16 select, Uint16 n)
+{
+    const HOST_CMPSS_FILTER *f = &hostCmpss.filter[n];
+    Uint16 latch = Cmpss6Regs.COMPSTS.all & ((n == 0) ? HOST_CMPSS_STS_HLATCH : HOST_CMPSS_STS_LLATCH);
+
+    return (select <= 1) ? f->input : (select == 2) ? f->output : (latch != 0);
+}
+
+// TRIP4 from CMPSS6 through mux 10 of the ePWM X-BAR, and the trips it holds
+static void CmpssRoute(Uint64 ps)
+{
+    volatile struct CMPSS_REGS *c = &Cmpss6Regs;
+    Uint16 high = CmpssCtrip(c->COMPCTL.bit.CTRIPHSEL, 0);
+    Uint16 low = CmpssCtrip(c->COMPCTL.bit.CTRIPLSEL, 1);
+    Uint16 trip4 = 0;
+    Uint16 i;
+
+    if (EPwmXbarRegs.TRIP4MUXENABLE.bit.MUX10 == 1)
+    {
+        trip4 = (EPwmXbarRegs.TRIP4MUX0TO15CFG.bit.MUX10 == 0) ? high :         // CMPSS6.CTRIPH
+                (EPwmXbarRegs.TRIP4MUX0TO15CFG.bit.MUX10 == 1) ? (high | low) : 0;    // CMPSS6.CTRIPH_OR_CTRIPL
+    }
+    trip4 ^= EPwmXbarRegs.TRIPOUTINV.bit.TRIP4;
+    hostCmpss.trip4 = trip4;
+    if (trip4 == 1)
+    {
+        for (i = 0; i < HOST_TRIP_EPWMS; i++)
+        {
+            CmpssTripEpwm(i, ps);
+        }
+    }
+}
+
+// Run the digital filters on their sample clocks up to the given time [ps]; a filter whose window
+// agrees with its input skips ahead, nothing changes there until the input does
+static void CmpssFilters(Uint64 untilPs)
+{
+    volatile struct CMPSS_REGS *c = &Cmpss6Regs;
+    HOST_CMPSS_FILTER *f;
+    Uint64 samplePs;
+    Uint32 mask;
+    Uint16 control;
+    Uint16 window;
+    Uint16 thresh;
+    Uint16 ones;
+    Uint16 n;
+
+    while (1)
+    {
+        n = (hostCmpss.filter[0].nextPs <= hostCmpss.filter[1].nextPs) ? 0 : 1;
+        f = &hostCmpss.filter[n];
+        if (f->nextPs > untilPs)
+        {
+            break;
+        }
+        control = (n == 0) ? c->CTRIPHFILCTL.all : c->CTRIPLFILCTL.all;
+        window = ((control >> 4) & 0x1F) + 1;               // SAMPWIN + 1
+        thresh = ((control >> 9) & 0x1F) + 1;               // THRESH + 1
+        samplePs = ((Uint64)((n == 0) ? c->CTRIPHFILCLKCTL.bit.CLKPRESCALE : c->CTRIPLFILCLKCTL.bit.CLKPRESCALE) + 1) *
+                   (1000000000000ULL / HOST_SYSCLK_HZ);
+        mask = (window >= 32) ? 0xFFFFFFFFUL : (1UL << window) - 1;
+        if ((f->window == ((f->input == 1) ? mask : 0)) && (f->output == f->input))
+        {
+            f->nextPs = (untilPs / samplePs + 1) * samplePs;
+            continue;
+        }
+        f->window = ((f->window << 1) | f->input) & mask;
+        ones = (Uint16)__builtin_popcount(f->window);
+        if ((f->output == 0) && (ones >= thresh))
+        {
+            f->output = 1;
+            c->COMPSTS.all |= (n == 0) ? HOST_CMPSS_STS_HLATCH : HOST_CMPSS_STS_LLATCH;
+            CmpssRoute(f->nextPs);
+        }
+        else if ((f->output == 1) && (window - ones >= thresh))
+        {
+            f->output = 0;
+            CmpssRoute(f->nextPs);
+        }
+        f->nextPs += samplePs;
+    }
+}
+
+// The comparator outputs changed on an input at the given time [ps]: the filters and the
+// unfiltered paths see it HOST_CMPSS_DELAY_PS later
+static void CmpssEdge(Uint16 level, Uint64 ps)
+{
+    Uint64 edgePs = ps + HOST_CMPSS_DELAY_PS;
+
+    if (level == hostCmpss.level)
+    {
+        return;
+    }
+    hostCmpss.level = level;
+    CmpssFilters(edgePs - 1);
+    hostCmpss.filter[0].input = level & 1;
+    hostCmpss.filter[1].input = (level >> 1) & 1;
+    CmpssRoute(edgePs);
+}
+
+// Look at CMPIN6P up to the given time [ps]: at every jump, and every HOST_CMPSS_STEP_PS in between
+// with the crossings found by bisection
+static void CmpssInput(Uint64 untilPs)
+{
+    HOST_CMPSS_STATE *s = &hostCmpss;
+    float64 jump;
+    Uint64 jumpPs;
+    Uint64 endPs;
+    Uint64 lastPs;
+    Uint64 lo;
+    Uint64 hi;
+    Uint64 mid;
+
+    while (s->inputPs < untilPs)
+    {
+        CmpssEdge(CmpssLevel(HostCmpss.input((float64)s->inputPs * 1e-12, &jump)), s->inputPs);
+        jumpPs = (Uint64)ceil(jump * 1e12);
+        jumpPs = (jumpPs > s->inputPs) ? jumpPs : s->inputPs + 1;
+        endPs = (jumpPs < untilPs) ? jumpPs : untilPs;
+        lastPs = (endPs == jumpPs) ? endPs - 1 : endPs;     // Smooth up to just before the jump
+        lo = s->inputPs;
+        while (lo < lastPs)
+        {
+            hi = (lastPs - lo > HOST_CMPSS_STEP_PS) ? lo + HOST_CMPSS_STEP_PS : lastPs;
+            if (CmpssLevelAt(hi) != s->level)
+            {
+                while (hi - lo > 1)
+                {
+                    mid = lo + (hi - lo) / 2;
+                    if (CmpssLevelAt(mid) != s->level)
+                    {
+                        hi = mid;
+                    }
+                    else
+                    {
+                        lo = mid;
+                    }
+                }
+                CmpssEdge(CmpssLevelAt(hi), hi);
+            }
+            lo = hi;
+        }
+        s->inputPs = endPs;
+    }
+}
+
+// Trip zone flag clears the firmware wrote to ePWM1 (0) or ePWM5 (1); a cleared one-shot trip
+// gives the pin back from the next period
+static void CmpssTzClear(Uint16 i)
+{
+    volatile struct EPWM_REGS *epwm = tripEpwm[i];
+
+    epwm->TZFLG.all &= ~(epwm->TZCLR.all & HOST_TZ_FLAGS);
+    epwm->TZCLR.all = 0;
+    epwm->TZOSTFLG.all &= ~epwm->TZOSTCLR.all;
+    epwm->TZOSTCLR.all = 0;
+    if (epwm->TZFLG.bit.OST == 0)
+    {
+        hostWave[i].tripPs = 0;
+    }
+}
+
+// Run the TZ ISR of ePWM1 (0) or ePWM5 (1) if the PIE lets it through and check its handshake
+static void CmpssCallIsr(Uint16 i)
+{
+    volatile struct EPWM_REGS *epwm = tripEpwm[i];
+    PINT isr = (i == 0) ? PieVectTable.EPWM1_TZ_INT : PieVectTable.EPWM5_TZ_INT;
+    Uint16 enabled = (i == 0) ? PieCtrlRegs.PIEIER2.bit.INTx1 : PieCtrlRegs.PIEIER2.bit.INTx5;
+
+    if ((PieCtrlRegs.PIECTRL.bit.ENPIE == 0) || (enabled == 0) || ((IER & M_INT2) == 0) ||
+        (hostIntm == 1) || (isr == NULL))
+    {
+        return;
+    }
+
+    // Write-one-to-clear registers are plain memory here: zero them and look for the 1
+    epwm->TZCLR.all = 0;
+    PieCtrlRegs.PIEACK.all = 0;
+
+    hostIntm = 1;
+    isr();
+    hostIntm = 0;
+    HostStats.tzIsrCalls++;
+    hostCmpss.pending[i] = 0;
+
+    if ((epwm->TZCLR.all & HOST_TZ_INT) == 0)
+    {
+        HostStats.tzMissedFlagClears++;
+    }
+    CmpssTzClear(i);
+    if ((PieCtrlRegs.PIEACK.all & PIEACK_GROUP2) == 0)
+    {
+        HostStats.tzMissedPieAcks++;
+    }
+}
+
+// Bring CMPSS6 and the trip zones up to the current time: the clears, DAC values and filter
+// initializations the firmware wrote since the last call, taken at that time (a trip still held
+// sets again at once), then the input since, and the TZ interrupts raised
+static void CmpssTrack(void)
+{
+    volatile struct CMPSS_REGS *c = &Cmpss6Regs;
+    HOST_CMPSS_STATE *s = &hostCmpss;
+    HOST_CMPSS_FILTER *f;
+    Uint64 untilPs = (hostTimePs > HOST_CMPSS_DELAY_PS) ? hostTimePs - HOST_CMPSS_DELAY_PS : 0;
+    Uint16 i;
+
+    c->COMPSTS.all &= ~(c->COMPSTSCLR.all & (HOST_CMPSS_STS_HLATCH | HOST_CMPSS_STS_LLATCH));
+    c->COMPSTSCLR.all &= ~(HOST_CMPSS_STS_HLATCH | HOST_CMPSS_STS_LLATCH);
+    c->DACHVALA.all = c->DACHVALS.all;
+    c->DACLVALA.all = c->DACLVALS.all;
+    for (i = 0; i < HOST_TRIP_EPWMS; i++)
+    {
+        CmpssTzClear(i);
+    }
+    for (i = 0; i < 2; i++)
+    {
+        f = &s->filter[i];
+        if (((i == 0) ? c->CTRIPHFILCTL.bit.FILINIT : c->CTRIPLFILCTL.bit.FILINIT) == 1)
+        {
+            f->window = (f->input == 1) ? 0xFFFFFFFFUL : 0;
+            f->output = f->input;
+            f->nextPs = 0;                  // Sampling again from the next clock
+        }
+    }
+    c->CTRIPHFILCTL.bit.FILINIT = 0;        // Reads 0
+    c->CTRIPLFILCTL.bit.FILINIT = 0;
+    CmpssRoute(hostCmpssPs);
+
+    if ((c->COMPCTL.bit.COMPDACE == 0) || (HostCmpss.input == NULL))
+    {
+        CmpssEdge(0, untilPs);              // Comparators off
+        s->inputPs = untilPs;
+    }
+    else
+    {
+        CmpssInput(untilPs);
+    }
+    CmpssFilters(hostTimePs);
+    c->COMPSTS.bit.COMPHSTS = s->level & 1;
+    c->COMPSTS.bit.COMPLSTS = (s->level >> 1) & 1;
+    hostCmpssPs = hostTimePs;
+
+    for (i = 0; i < HOST_TRIP_EPWMS; i++)
+    {
+        if (s->pending[i] == 1)
+        {
+            CmpssCallIsr(i);
+        }
+    }
+}
+
+// SCI-A is modelled at byte level: 16-level TX and RX FIFOs behind SCITXBUF/SCIRXBUF,
+// a transmit shifter that takes one character time at the programmed baud rate, the
+// TX/RX FIFO interrupts (PIE 9.2/9.1) and LOOPBKENA. Outside loopback the host acts as
+// the far end of the line: transmitted bytes go to HostSciTxHook, HostSciSend() feeds
+// the receiver.
+
+// SCI-A baud rate from LSPCLK and BRR
+static float64 SciBaud(void)
+{
+    float64 lspclk = (float64)HOST_SYSCLK_HZ;
+    Uint32 brr = ((Uint32)SciaRegs.SCIHBAUD.all << 8) | (SciaRegs.SCILBAUD.all & 0xFF);
+
+    if (ClkCfgRegs.LOSPCP.bit.LSPCLKDIV != 0)
+    {
+        lspclk /= 2.0 * ClkCfgRegs.LOSPCP.bit.LSPCLKDIV;
+    }
+    return (brr == 0) ? lspclk / 16.0 : lspclk / ((float64)(brr + 1) * 8.0);
+}
+
+// One SCI-A character on the line [ps]: start bit, data bits, parity, stop bits
+static Uint64 SciCharPs(void)
+{
+    Uint16 bits = 1 + (SciaRegs.SCICCR.bit.SCICHAR + 1) + SciaRegs.SCICCR.bit.PARITYENA +
+                  (SciaRegs.SCICCR.bit.STOPBITS + 1);
+
+    return (Uint64)((float64)bits * 1e12 / SciBaud());
+}
+
+// SCI-A is out of reset with both FIFOs released
+static Uint16 SciRunning(void)
+{
+    return (SciaRegs.SCICTL1.bit.SWRESET == 1) && (SciaRegs.SCIFFTX.bit.SCIRST == 1) &&
+           (SciaRegs.SCIFFTX.bit.TXFIFORESET == 1);
+}
+
+// Load the next byte from the TX FIFO into the shifter if it is idle
+static void SciStartShift(void)
+{
+    Uint16 i;
+
+    if ((sciShiftBusy == 1) || (SciaRegs.SCIFFTX.bit.TXFFST == 0) || (SciRunning() == 0) ||
+        (SciaRegs.SCICTL1.bit.TXENA == 0))
+    {
+        return;
+    }
+    sciShift = sciTxFifo[0];
+    for (i = 1; i < SciaRegs.SCIFFTX.bit.TXFFST; i++)
+    {
+        sciTxFifo[i - 1] = sciTxFifo[i];
+    }
+    SciaRegs.SCIFFTX.bit.TXFFST--;
+    sciShiftBusy = 1;
+    sciShiftDonePs = hostTimePs + SciCharPs();
+}
+
+// Put one byte into the SCI-A RX FIFO, flagging an overflow if it is full
+static Uint16 SciReceive(Uint16 data)
+{
+    if ((SciRunning() == 0) || (SciaRegs.SCICTL1.bit.RXENA == 0) || (SciaRegs.SCIFFRX.bit.RXFIFORESET == 0))
+    {
+        return 0;
+    }
+    if (SciaRegs.SCIFFRX.bit.RXFFST >= HOST_SCI_FIFO_DEPTH)
+    {
+        SciaRegs.SCIFFRX.bit.RXFFOVF = 1;
+        return 0;
+    }
+    sciRxFifo[SciaRegs.SCIFFRX.bit.RXFFST] = data & 0xFF;
+    SciaRegs.SCIFFRX.bit.RXFFST++;
+    return 1;
+}
+
+// SCITXBUF write
+void HostSciTxWrite(Uint16 data)
+{
+    if (SciaRegs.SCIFFTX.bit.TXFFST >= HOST_SCI_FIFO_DEPTH)
+    {
+        HostStats.sciTxFifoOverruns++;
+        return;
+    }
+    sciTxFifo[SciaRegs.SCIFFTX.bit.TXFFST] = data & 0xFF;
+    SciaRegs.SCIFFTX.bit.TXFFST++;
+    SciStartShift();
+}
+
+// SCIRXBUF read
+Uint16 HostSciRxRead(void)
+{
+    Uint16 data = sciRxFifo[0];
+    Uint16 i;
+
+    if (SciaRegs.SCIFFRX.bit.RXFFST == 0)
+    {
+        return data;                        // Reading an empty FIFO returns the last byte again
+    }
+    for (i = 1; i < SciaRegs.SCIFFRX.bit.RXFFST; i++)
+    {
+        sciRxFifo[i - 1] = sciRxFifo[i];
+    }
+    SciaRegs.SCIFFRX.bit.RXFFST--;
+    return data;
+}
+
+Uint16 HostSciSend(const Uint16 *data, Uint16 count)
+{
+    Uint16 i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (SciReceive(data[i]) == 0)
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+// Run one SCI FIFO ISR if the PIE lets it through and check its handshake
+static void SciCallIsr(PINT isr, Uint16 pieBit, volatile Uint16 *flagClear, Uint16 clearMask)
+{
+    if ((PieCtrlRegs.PIECTRL.bit.ENPIE == 0) || ((PieCtrlRegs.PIEIER9.all & pieBit) == 0) ||
+        ((IER & M_INT9) == 0) || (hostIntm == 1) || (isr == NULL))
+    {
+        return;
+    }
+
+    *flagClear &= ~clearMask;               // Write-one-to-clear bits read as 0
+    PieCtrlRegs.PIEACK.all = 0;
+
+    hostIntm = 1;
+    isr();
+    hostIntm = 0;
+    HostStats.sciIsrCalls++;
+
+    if ((*flagClear & clearMask) == 0)
+    {
+        HostStats.sciMissedFlagClears++;
+    }
+    *flagClear &= ~clearMask;
+    if ((PieCtrlRegs.PIEACK.all & PIEACK_GROUP9) == 0)
+    {
+        HostStats.sciMissedPieAcks++;
+    }
+}
+
+// Raise the SCI-A FIFO interrupts whose level condition holds (RX before TX, as in the PIE)
+static void SciInterrupts(void)
+{
+    Uint16 pass;
+    Uint16 rx;
+    Uint16 tx;
+
+    for (pass = 0; pass < HOST_SCI_ISR_PASSES; pass++)
+    {
+        rx = (SciaRegs.SCIFFRX.bit.RXFFIENA == 1) && (SciaRegs.SCIFFRX.bit.RXFFIL != 0) &&
+             (SciaRegs.SCIFFRX.bit.RXFFST >= SciaRegs.SCIFFRX.bit.RXFFIL);
+        tx = (SciaRegs.SCIFFTX.bit.TXFFIENA == 1) && (SciaRegs.SCIFFTX.bit.TXFFST <= SciaRegs.SCIFFTX.bit.TXFFIL);
+        if ((rx == 0) && (tx == 0))
+        {
+            return;
+        }
+        if (rx == 1)
+        {
+            SciCallIsr(PieVectTable.SCIA_RX_INT, 0x0001, &SciaRegs.SCIFFRX.all, 0x0040);    // RXFFINTCLR
+        }
+        if (tx == 1)
+        {
+            SciCallIsr(PieVectTable.SCIA_TX_INT, 0x0002, &SciaRegs.SCIFFTX.all, 0x0040);    // TXFFINTCLR
+        }
+        SciStartShift();
+    }
+}
+
+// The shifter has finished a byte: deliver it and start the next one
+static void SciShiftDone(void)
+{
+    sciShiftBusy = 0;
+    HostStats.sciTxBytes++;
+    HostStats.sciBaud = SciBaud();
+
+    if (SciaRegs.SCICCR.bit.LOOPBKENA == 1)
+    {
+        SciReceive(sciShift);
+    }
+    else if (HostSciTxHook != NULL)
+    {
+        HostSciTxHook(sciShift);
+    }
+    SciStartShift();
+    SciInterrupts();
+}
+
+// IPC: IPCCOUNTERL follows the virtual clock at SYSCLK. The IPC driver buffers are plain
+// memory; HostIpcRemote() gives the host CPU2's view of them and HostIpcInterrupt()
+// delivers IPC0 from CPU2 to the ISR mapped at PieVectTable.IPC0_INT (PIE 1.13).
+
+// IPC driver circular buffer indexes (F2837xD_Ipc_Driver.c)
+extern uint16_t g_usPutWriteIndexes[NUM_IPC_INTERRUPTS];
+extern uint16_t g_usPutReadIndexes[NUM_IPC_INTERRUPTS];
+extern uint16_t g_usGetWriteIndexes[NUM_IPC_INTERRUPTS];
+extern uint16_t g_usGetReadIndexes[NUM_IPC_INTERRUPTS];
+
+// CPU2's view of the CPU1 IPC driver buffers for one interrupt: the message RAM each core
+// writes is the other core's DSECT, so CPU2 gets from CPU1's put buffer and indexes
+void HostIpcRemote(volatile tIpcController *controller, Uint16 ipcInt)
+{
+    controller->psPutBuffer = &g_asIPCCPU2toCPU1Buffers[ipcInt - 1][0];
+    controller->pusPutWriteIndex = &g_usGetWriteIndexes[ipcInt - 1];
+    controller->pusGetReadIndex = &g_usPutReadIndexes[ipcInt - 1];
+    controller->ulPutFlag = (Uint32)1 << (ipcInt - 1);
+    controller->psGetBuffer = &g_asIPCCPU1toCPU2Buffers[ipcInt - 1][0];
+    controller->pusGetWriteIndex = &g_usPutWriteIndexes[ipcInt - 1];
+    controller->pusPutReadIndex = &g_usGetReadIndexes[ipcInt - 1];
+}
+
+// CPU2 raised IPC0 towards CPU1: run the ISR if the PIE lets it through and check its handshake
+void HostIpcInterrupt(void)
+{
+    if ((PieCtrlRegs.PIECTRL.bit.ENPIE == 0) || (PieCtrlRegs.PIEIER1.bit.INTx13 == 0) ||
+        ((IER & M_INT1) == 0) || (hostIntm == 1) || (PieVectTable.IPC0_INT == NULL))
+    {
+        return;
+    }
+
+    IpcRegs.IPCACK.all = 0;                 // Write-one-to-clear, look for the 1
+    PieCtrlRegs.PIEACK.all = 0;
+
+    hostIntm = 1;
+    PieVectTable.IPC0_INT();
+    hostIntm = 0;
+    HostStats.ipcIsrCalls++;
+
+    if ((IpcRegs.IPCACK.all & IPC_FLAG0) == 0)
+    {
+        HostStats.ipcMissedFlagAcks++;
+    }
+    if ((PieCtrlRegs.PIEACK.all & PIEACK_GROUP1) == 0)
+    {
+        HostStats.ipcMissedPieAcks++;
+    }
+}
+
+// Advance the virtual clock, replaying every SOCA, ePWM6 DMA trigger and SCI-A character in the interval in time order
+static void HostAdvance(Uint64 ps)
+{
+    Uint64 target = hostTimePs + ps;
+    Uint16 i;
+
+    if (hostStopPs < target)
+    {
+        target = hostStopPs;
+    }
+
+    if ((hostEpwmRunning == 0) && (CpuSysRegs.PCLKCR0.bit.TBCLKSYNC == 1) && (EPwm2Regs.TBCTL.bit.CTRMODE == 0))
+    {
+        hostEpwmRunning = 1;
+        hostEpwmStartPs = hostTimePs;
+        hostNextSocaPs = hostTimePs + SocaPeriodPs();
+        for (i = 0; i < HOST_PWM_WAVES; i++)
+        {
+            PwmWaveStart(&hostWave[i]);
+        }
+    }
+    CmpssTrack();                           // Trips before the edges they hold low
+    EcapTrack();                            // eCAP writes the firmware made at this instant
+    SdfmTrack();
+
+    // The firmware may have queued SCI data, enabled a FIFO interrupt or forced a DMA trigger since the last call
+    SciStartShift();
+    SciInterrupts();
+    HostDmaForced();
+
+    while (1)
+    {
+        Epwm6Track();                       // Started or stopped by the firmware since the last event
+        if ((hostEpwmRunning == 1) && (hostNextSocaPs <= target) &&
+            ((sciShiftBusy == 0) || (hostNextSocaPs <= sciShiftDonePs)) &&
+            ((hostEpwm6Running == 0) || (hostNextSocaPs <= hostNextEpwm6Ps)))
+        {
+            hostTimePs = hostNextSocaPs;
+            CmpssTrack();
+            EcapTrack();
+            if ((EPwm2Regs.TBCTL.bit.CTRMODE == 0) && (EPwm2Regs.ETSEL.bit.SOCAEN == 1) &&
+                (EPwm2Regs.ETSEL.bit.SOCASEL == 2))
+            {
+                HostSoca();
+            }
+            hostNextSocaPs += SocaPeriodPs();
+        }
+        else if ((hostEpwm6Running == 1) && (hostNextEpwm6Ps <= target) &&
+                 ((sciShiftBusy == 0) || (hostNextEpwm6Ps <= sciShiftDonePs)))
+        {
+            hostTimePs = hostNextEpwm6Ps;
+            HostEpwm6Zero();
+            hostNextEpwm6Ps += Epwm6PeriodPs();
+        }
+        else if ((sciShiftBusy == 1) && (sciShiftDonePs <= target))
+        {
+            hostTimePs = sciShiftDonePs;
+            SciShiftDone();
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    hostTimePs = target;
+    CmpssTrack();
+    EcapTrack();
+    SdfmTrack();
+    UpdateIpcCounter();
+    if (hostTimePs >= hostStopPs)
+    {
+        longjmp(hostStop, 1);
+    }
+}
+
+// DELAY_US(A) passes ((A * 1000 / CPU_RATE) - 9) / 5 loop counts; undo that to get the delay
+void F28x_usDelay(long LoopCount)
+{
+    float64 us = ((float64)LoopCount * 5.0 + 9.0) * (float64)CPU_RATE / 1000.0;
+
+    HostAdvance((Uint64)(us * 1e6));
+}
+
+// InitSysCtrl: watchdog off, clock tree at 200 MHz, all peripheral clocks on
+void InitSysCtrl(void)
+{
+    DisableDog();
+
+    EALLOW;
+    ClkCfgRegs.CLKSRCCTL1.bit.OSCCLKSRCSEL = XTAL_OSC;
+    ClkCfgRegs.SYSPLLMULT.bit.IMULT = IMULT_40;
+    ClkCfgRegs.SYSPLLMULT.bit.FMULT = FMULT_0;
+    ClkCfgRegs.SYSCLKDIVSEL.bit.PLLSYSCLKDIV = PLLCLK_BY_2;
+    ClkCfgRegs.SYSPLLSTS.bit.LOCKS = 1;
+    ClkCfgRegs.SYSPLLCTL1.bit.PLLEN = 1;
+    ClkCfgRegs.SYSPLLCTL1.bit.PLLCLKEN = 1;
+    ClkCfgRegs.PERCLKDIVSEL.bit.EPWMCLKDIV = 1;     // Reset value: EPWMCLK = SYSCLK/2
+    ClkCfgRegs.LOSPCP.bit.LSPCLKDIV = 2;            // Reset value: LSPCLK = SYSCLK/4
+    EDIS;
+
+    // Reset value of TBCTL: counter frozen, HSPCLKDIV = /2. The ePWMs do not run before the firmware starts them.
+    EPwm1Regs.TBCTL.all = 0x0083;
+    EPwm2Regs.TBCTL.all = 0x0083;
+    EPwm5Regs.TBCTL.all = 0x0083;
+    EPwm6Regs.TBCTL.all = 0x0083;
+
+    InitPeripheralClocks();
+}
+
+// InitGpio: every GPIO control and data register back to zero
+void InitGpio(void)
+{
+    EALLOW;
+    memset((void *)&GpioCtrlRegs, 0, sizeof(GpioCtrlRegs));
+    memset((void *)&GpioDataRegs, 0, sizeof(GpioDataRegs));
+    EDIS;
+}
+
+// InitPieVectTable: copy the default vectors, keeping the first three boot ROM entries
+void InitPieVectTable(void)
+{
+    const PINT *source = (const PINT *)&PieVectTableInit;
+    PINT *dest = (PINT *)&PieVectTable;
+    Uint16 count = sizeof(PieVectTable) / sizeof(PINT);
+    Uint16 i;
+
+    EALLOW;
+    for (i = 3; i < count; i++)
+    {
+        dest[i] = source[i];
+    }
+    EDIS;
+
+    PieCtrlRegs.PIECTRL.bit.ENPIE = 1;
+}
+
+// HRPWM: the ePWM1/ePWM5 registers are plain memory and GPIO0 follows the integer CMPA
+// only. SFO() stands in for the SFO V8 library: every HOST_SFO_STEPS calls it completes a
+// calibration with a fixed MEP scale factor and writes it to EPwm1Regs.HRMSTEP.
+
+// SFO: a calibration completes every HOST_SFO_STEPS calls and finds HOST_MEP_SCALE_FACTOR,
+// which is written to HRMSTEP for the auto-conversion as the library does
+int SFO(void)
+{
+    static Uint16 steps;
+
+    HostStats.sfoCalls++;
+    if (++steps < HOST_SFO_STEPS)
+    {
+        return SFO_INCOMPLETE;
+    }
+    steps = 0;
+    MEP_ScaleFactor = HOST_MEP_SCALE_FACTOR;
+    EALLOW;
+    EPwm1Regs.HRMSTEP.bit.HRMSTEP = MEP_ScaleFactor;
+    EDIS;
+    return SFO_COMPLETE;
+}
+
+void HostRun(void (*firmwareMain)(void), float64 seconds)
+{
+    hostStopPs = hostTimePs + (Uint64)(seconds * 1e12);
+    if (setjmp(hostStop) == 0)
+    {
+        firmwareMain();
+    }
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,186 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: host_device.h
+/*
+// File Description:
+// Emulation of the F2837xD peripherals used by the cpu01 acquisition path, for the
+// host-native build. Time is virtual: it only advances inside DELAY_US (F28x_usDelay),
+// which replays every ePWM2 SOCA that falls into the delayed interval. Each SOCA
+// loads synthetic ADC results, raises ADCINT1 and, if PIE group 1 / INT1 / INTM
+// allow it, calls the ISR mapped at PieVectTable.ADCA1_INT.
+//
+// Since time does not advance inside an ISR, profiled execution times read 0 cycles; the
+// SOC-to-entry latency reads HOST_ADC_LATENCY_TICKS TBCLK ticks. CPU Timer 1 follows the
+// virtual clock at SYSCLK, and the ADCINT1 pulse also runs HostClaTask1 to completion when
+// CLA1TASKSRCSEL1.TASK1 selects ADCAINT1 and MIER.INT1 is set.
+//
+// Also modelled, each described at its code in host_device.c:
+//   SCI-A   FIFOs, shifter at the baud rate, FIFO interrupts; HostSciTxHook/HostSciSend()
+//   IPC     IPCCOUNTERL and CPU2's side of the driver; HostIpcRemote()/HostIpcInterrupt()
+//   DMA     CH1-CH6 on ADCAINT1, ePWM6 SOCA and PERINTFRC; HostDmaHook
+//   EMIF1   SDRAM window of SDRAM_WORDS words; HostEmif1Address()
+//   HRPWM   SFO() stand-in with a fixed MEP scale factor
+//   eCAP    eCAP1-6 on PWM1A, PWM5A and HostExtPwm
+//   eQEP    eQEP1 on HostEncoder
+//   SDFM    SDFM1 filter 1 on a modulator of HostSdfm.input
+//   CMPSS   CMPSS6 on HostCmpss.input, tripping ePWM1/ePWM5
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef HOST_DEVICE_H
+#define HOST_DEVICE_H
+
+#include "c28x_host.h"
+#include "F2837xD_Ipc_drivers.h"
+
+// Definitions for the emulated clock tree
+#define HOST_SYSCLK_HZ          200000000UL     // SYSCLK after InitSysCtrl (LaunchPad PLL setting)
+#define HOST_ADC_LATENCY_TICKS  30              // ePWM2 TBCTR seen at ISR entry (conversion + PIE latency)
+#define HOST_ADC_CHANNELS       4               // ADC-A, ADC-B, ADC-C, ADC-D SOC0
+#define HOST_SFO_STEPS          4               // SFO() calls per completed calibration
+#define HOST_MEP_SCALE_FACTOR   55              // MEP steps per 10 ns TBCLK: 182 ps
+#define HOST_COMPARE_NONE       0xFFFFFFFFUL    // HostEpwmCompareAt(): period not replayed or no longer kept
+#define HOST_SDFM_HISTORY       1024            // Modulator bits HostSdfmBit() can look back on, more than a sinc3 at OSR 256 spans
+#define HOST_CMPSS_DELAY_PS     60000ULL        // CMPIN to comparator output (datasheet typical)
+#define HOST_CMPSS_STEP_PS      1000000ULL      // Looks at a smooth comparator input between its jumps
+#define HOST_TRIP_EPWMS         2               // ePWM1, ePWM5: the trip zones modelled
+#define HOST_DMA_CHANNELS       6               // DMA CH1..CH6
+
+// Synthetic input source: fill adc[] with the SOC0 results of ADC-A..D for one SOCA
+typedef void (*HOST_INPUT_HOOK)(Uint32 sample, float64 seconds, Uint16 adc[HOST_ADC_CHANNELS]);
+
+// Called after every ADCA1 ISR or CLA task 1 invocation with the inputs it was given
+typedef void (*HOST_SAMPLE_HOOK)(Uint32 sample, const Uint16 adc[HOST_ADC_CHANNELS]);
+
+// CLA task body, run on the host CPU when its trigger fires
+typedef void (*HOST_CLA_TASK)(void);
+
+// Called after every replayed DMA trigger (DMA_EPWM6A, DMA_ADCAINT1) once its bursts and interrupts are done
+typedef void (*HOST_DMA_HOOK)(Uint16 persel);
+
+// Far end of the SCI-A line: called with every byte that leaves the transmitter
+typedef void (*HOST_SCI_TX_HOOK)(Uint16 data);
+
+// External PWM on one pin, seen by the eCAPs: first rising edge delayPs after the ePWM time bases start
+typedef struct
+{
+    Uint16 gpio;                // Pin the signal is on
+    Uint64 periodPs;            // 0 = no signal
+    Uint64 highPs;
+    Uint64 delayPs;
+} HOST_EXT_PWM;
+
+// Quadrature encoder on EQEP1A/B/I, seen by eQEP1: shaft position [counts] at a given time [s]
+typedef float64 (*HOST_ENCODER_HOOK)(float64 seconds);
+
+typedef struct
+{
+    HOST_ENCODER_HOOK position; // NULL = no encoder
+    float64 indexCounts;        // Index marker, counts of shaft position into the revolution
+    Uint32 countsPerRev;        // Shaft counts between index markers
+    int32 missed;               // Edges the counter is to lose at the next SOCA, zeroed when taken
+} HOST_ENCODER;
+
+// Sigma-delta modulator on SD1_D1/SD1_C1, seen by SDFM1 filter 1: input as a fraction of full scale (-1..1) at a given time [s]
+typedef float64 (*HOST_SDFM_HOOK)(float64 seconds);
+
+typedef struct
+{
+    HOST_SDFM_HOOK input;       // NULL = no modulator
+    Uint32 clockHz;             // Bit clock; bit n is taken at n / clockHz s
+    Uint64 bits;                // Bits the filters have been brought up to
+    Uint64 dataStart;           // First bit of the data filter since it was last enabled
+    Uint64 dataBits;            // bits when SDDATA1 was last loaded, 0 = never
+    Uint64 flagPs;              // Time of the first comparator output on which IFH1 or IFL1 rose since the host zeroed it, 0 = none
+    Uint16 flagRose;            // SDIFLG bits that rose since the host zeroed it
+} HOST_SDFM;
+
+// Analog input on CMPIN6P, seen by CMPSS6: level as an ADC code (0..4095 of VDDA) at a given time [s].
+// Sets *jump to the time of the next step in the level after it; the level is smooth in between.
+typedef float64 (*HOST_ANALOG_HOOK)(float64 seconds, float64 *jump);
+
+typedef struct
+{
+    HOST_ANALOG_HOOK input;     // NULL = not driven
+    Uint64 tripPs[HOST_TRIP_EPWMS];     // Time the one-shot trip of ePWM1, ePWM5 was last set, 0 = never
+} HOST_CMPSS;
+
+// Counters kept by the emulation
+typedef struct
+{
+    Uint64 socaEvents;          // ePWM2 SOCA events replayed
+    Uint64 isrCalls;            // ADCA1 ISR invocations
+    Uint64 isrNsTotal;          // Host wall time spent inside the ISR
+    Uint64 isrNsMax;            // Longest single ISR invocation on the host
+    Uint64 missedFlagClears;    // ISR returned without writing ADCINTFLGCLR.ADCINT1
+    Uint64 missedPieAcks;       // ISR returned without writing PIEACK group 1
+    Uint64 adcOverflows;        // SOCA while ADCINT1 was still set in non-continuous mode
+    float64 samplePeriod;       // ePWM2 SOCA period [s] at the last event
+    Uint64 sciTxBytes;          // Bytes shifted out of SCI-A (including loopback)
+    Uint64 sciIsrCalls;         // SCI-A TX and RX FIFO ISR invocations
+    Uint64 sciMissedFlagClears; // SCI ISR returned without clearing its FIFO interrupt flag
+    Uint64 sciMissedPieAcks;    // SCI ISR returned without writing PIEACK group 9
+    Uint64 sciTxFifoOverruns;   // SCITXBUF written with the TX FIFO full
+    float64 sciBaud;            // SCI-A baud rate at the last transmitted byte
+    Uint64 ipcIsrCalls;         // IPC0 ISR invocations on CPU1
+    Uint64 ipcMissedFlagAcks;   // IPC0 ISR returned without writing IPCACK.IPC0
+    Uint64 ipcMissedPieAcks;    // IPC0 ISR returned without writing PIEACK group 1
+    Uint64 claTaskCalls;        // CLA task 1 invocations
+    Uint64 claNsTotal;          // Host wall time spent inside CLA task 1
+    Uint64 claNsMax;            // Longest single CLA task 1 invocation on the host
+    Uint64 epwm6SocaEvents;     // ePWM6 SOCA events replayed
+    Uint64 dmaBursts;           // DMA bursts moved, all channels
+    Uint64 dmaIsrCalls;         // DMA channel ISR invocations
+    Uint64 dmaChIsrCalls[HOST_DMA_CHANNELS];    // The same, per channel
+    Uint64 dmaMissedPieAcks;    // DMA ISR returned without writing PIEACK group 7
+    Uint64 dmaFrameRefusals;    // DMA words to or from peripheral frame 2 while SECMSEL.PF2SEL leaves it to the CLA
+    Uint64 sfoCalls;            // SFO() calls
+    Uint64 sdfmIsrCalls;        // SD1 ISR invocations
+    Uint64 sdfmMissedFlagClears;// SD1 ISR returned without writing SDIFLGCLR.MIF
+    Uint64 sdfmMissedPieAcks;   // SD1 ISR returned without writing PIEACK group 5
+    Uint64 tzIsrCalls;          // ePWM1/ePWM5 TZ ISR invocations
+    Uint64 tzMissedFlagClears;  // TZ ISR returned without writing TZCLR.INT
+    Uint64 tzMissedPieAcks;     // TZ ISR returned without writing PIEACK group 2
+} HOST_STATS;
+
+extern HOST_INPUT_HOOK HostInputHook;       // Synthetic ADC inputs, must be set before HostRun()
+extern HOST_SAMPLE_HOOK HostSampleHook;     // Optional per-sample check
+extern HOST_STATS HostStats;                // Emulation counters
+extern HOST_SCI_TX_HOOK HostSciTxHook;      // Optional far end of the SCI-A line
+extern HOST_CLA_TASK HostClaTask1;          // CLA task 1 (Cla1Task1), started by ADCAINT1 when CLA1TASKSRCSEL1 says so
+extern HOST_DMA_HOOK HostDmaHook;           // Optional per-trigger DMA check
+extern HOST_EXT_PWM HostExtPwm;             // Optional external PWM, must be set before HostRun()
+extern HOST_ENCODER HostEncoder;            // Optional encoder, must be set before HostRun()
+extern HOST_SDFM HostSdfm;                  // Optional modulator, must be set before HostRun()
+extern HOST_CMPSS HostCmpss;                // Optional comparator input, must be set before HostRun()
+
+// Far end of the SCI-A line: put bytes into the SCI-A RX FIFO, returns the number accepted
+Uint16 HostSciSend(const Uint16 *data, Uint16 count);
+
+// CPU2's view of the CPU1 IPC driver buffers of one IPC interrupt (IPC_INT0..IPC_INT3)
+void HostIpcRemote(volatile tIpcController *controller, Uint16 ipcInt);
+// CPU2 raises IPC0 towards CPU1
+void HostIpcInterrupt(void);
+// Period of an up-counting ePWM module [ps]
+Uint64 HostEpwmPeriodPs(volatile struct EPWM_REGS *epwm);
+// CMPA:CMPAHR that ePWM1 or ePWM5 loaded at the start of the period holding the given time, or HOST_COMPARE_NONE
+Uint32 HostEpwmCompareAt(volatile struct EPWM_REGS *epwm, Uint64 ps);
+// Start of the SYSCLK cycle in which an eCAP counter read the given time stamp [ps]
+Uint64 HostEcapStampPs(volatile struct ECAP_REGS *cap, Uint32 stamp);
+// Modulator bit n (0 or 1), one of the last HOST_SDFM_HISTORY before HostSdfm.bits
+Uint16 HostSdfmBit(Uint64 n);
+// Run firmwareMain() until the virtual clock reaches the given time, then return
+void HostRun(void (*firmwareMain)(void), float64 seconds);
+
+// Current virtual time [s]
+float64 HostTime(void);
+
+// Host wall clock [ns]
+Uint64 HostWallNs(void);
+
+#endif  // end of HOST_DEVICE_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
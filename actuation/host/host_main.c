@@ -0,0 +1,3012 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: host_main.c
+/*
+// File Description:
+// Host-native run of the cpu01 firmware. main() in actuation_cpu01.c is built as
+// firmware_main() and runs unmodified on the emulated register file (host_device.c)
+// for a given amount of simulated time. Synthetic inputs are fed on every ePWM2 SOCA.
+//
+// Checks performed on every adca1_isr invocation:
+//   - DAC-A/DAC-B hold this sample's ADC-D/ADC-B input (DAC_UPDATE_SAMPLE, DAC_SOURCE_ADC),
+//   - dacLatency equals the modelled SOCA-to-ISR latency (DAC_UPDATE_SAMPLE),
+//   - a newly captured mmSpeed/maCurrent entry matches a double-precision reference,
+//   - the ISR cleared ADCINT1 and acknowledged PIE group 1.
+// After the run the adca1_isr profile must have counted every call with the modelled
+// latency and no deadline overruns (profiles with no call print n/a), the number of ISR
+// calls is checked against the configured rate and the host ISR cost against the limits
+// given on the command line.
+//
+// Each optional feature is checked in its own section below, which opens with what it
+// tests under the feature name and build switch.
+//
+// Usage: actuation_host [-t seconds] [--max-isr-ns N] [--min-realtime X] [--capture file]
+// Exit status is non-zero if any check fails. A run shorter than the last scheduled event of
+// a configured scenario (TestRunSeconds()) is refused before it starts.
+// -----------------------------------------------------------------------------
+ */
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+#include "actuation_cpu01.h"    // Build configuration and shared acquisition state
+#include "isr_profiler.h"       // ISR execution time and latency statistics
+#include "trigger.h"            // Capture trigger engine
+#include "stream.h"             // Continuous sample streaming ring
+#include "sci_driver.h"         // Non-blocking SCI-A driver
+#include "telemetry.h"          // Telemetry frame encoder
+#include "ipc_link.h"           // Sample hand-off to CPU2
+#include "cpu2_process.h"       // CPU2 filters and statistics
+#include "cla_acquire.h"        // CLA acquisition path
+#include "dma_capture.h"        // DMA ping-pong ADC capture
+#include "filter_bank.h"        // Per-channel biquad/FIR input conditioning
+#include "motor_model.h"        // On-board DC motor model
+#include "dds.h"                // DDS stimulus generators
+#include "dac_playback.h"       // DMA DAC profile playback
+#include "sdram_store.h"        // Deep capture store in EMIF1 SDRAM
+#include "pwm_output.h"         // Closed-loop ePWM1/ePWM5 switching stage
+#include "ecap_measure.h"       // eCAP PWM period, duty and phase measurement
+#include "qep_encoder.h"        // eQEP1 encoder position and speed
+#include "sdfm_current.h"       // SDFM1 current input and over-current trip
+#include "cmpss_trip.h"         // CMPSS6 hardware over-current trip
+#include "host_device.h"
+#include "filter_reference.h"
+#include "telemetry_decoder.h"
+
+#define HOST_PI 3.14159265358979323846
+
+void firmware_main(void);                   // main() of actuation_cpu01.c
+extern Uint16 phaseOffset5;                 // PWM5 phase offset of actuation_cpu01.c, in ePWM5 TBCLK ticks
+
+static Uint64 dacMismatches;                // DAC value differs from the forwarded input
+static Uint64 latencyMismatches;            // dacLatency differs from HOST_ADC_LATENCY_TICKS
+static Uint64 captureMismatches;            // Captured value differs from the reference scaling
+static Uint64 captureCount;                 // Captured samples checked
+#if ADC_CAPTURE_MODE != ADC_CAPTURE_CLA
+static Uint16 lastResultsIndex;             // resultsIndex before the current ISR or block
+#endif
+#if ADC_CAPTURE_MODE == ADC_CAPTURE_DMA
+#if RESULTS_BUFFER_SIZE <= DMA_CAPTURE_HALF_SIZE
+#error "The DMA block replay needs RESULTS_BUFFER_SIZE above DMA_CAPTURE_HALF_SIZE to count the samples a block stored"
+#endif
+static Uint32 dmaBlocksChecked;             // dmaBlockCount at the last block replayed
+static Uint16 dmaStored;                    // Samples of the replayed block still to find in the capture buffers
+static Uint64 dmaBlockMismatches;           // Blocks replayed without the inputs of all their samples
+static Uint64 dmaContentErrors;             // Block words that are not the results of their sample
+#endif
+static Uint32 triggerSwitchSample;          // Sample at which the single-shot trigger is armed
+static Uint32 defaultCaptures;              // Captures completed with the default trigger
+
+#define TEST_HOLD_SAMPLES 200       // Samples a default capture is held at least, and until GPIO0 rises
+static int16 heldSpeed[RESULTS_BUFFER_SIZE];    // mmSpeed[] when the held capture was found
+static int16 heldCurrent[RESULTS_BUFFER_SIZE];  // maCurrent[] when the held capture was found
+static TRIGGER_STATUS heldStatus;           // TriggerStatus when the held capture was found
+static Uint32 heldSample;                   // Sample at which the held capture was found, 0 if none
+static Uint16 heldGpio0;                    // GPIO0 at the previous sample of the hold
+static Uint32 heldTriggers;                 // GPIO0 rising edges seen while a capture was held
+static Uint32 heldFirstTrigger;             // heldTriggers when the current hold began
+static Uint32 heldChecks;                   // Held captures compared before re-arming
+static Uint32 heldOverwrites;               // Held captures changed before they were re-armed
+
+static Uint64 streamRecords;                // Records received by the host sink
+static Uint64 streamGaps;                   // Records whose timestamp does not follow the previous one
+static Uint64 streamMismatches;             // Records whose ADC-B value is not this sample's input
+
+#define TEST_SCI_BYTES  8           // Bytes the host sends to the firmware during the run
+static Uint16 sciSent;                      // Bytes accepted by the SCI-A RX FIFO
+
+static uint8_t *sciLine;                    // Every byte transmitted by SCI-A outside loopback
+static size_t sciLineLength;
+static size_t sciLineSize;
+
+#define TEST_PRETRIGGER (RESULTS_BUFFER_SIZE / 4)   // History requested by the single-shot trigger
+#define TEST_ADCA_HZ    5.0                         // ADC-A sine the single-shot trigger waits for
+#define TEST_RUN_MARGIN 0.01                        // Run left after the last event of a scenario [s]
+
+#define FILTER_TEST_SAMPLES 50000         // Samples per channel in the bit-exact comparison
+#define FILTER_TEST_SETS    4             // Coefficient sets it cycles through
+
+// Sets loaded by the checks
+static const FILTER_COEFFS filterTestSets[FILTER_TEST_SETS] =
+{
+    // 4th-order Butterworth low-pass at fs/10 followed by an 8-tap smoothing FIR
+    {2, 8, {{6.188519529e-02f, 1.237703906e-01f, 6.188519529e-02f, -1.048599576e+00f, 2.961403574e-01f},
+            {7.795634090e-02f, 1.559126818e-01f, 7.795634090e-02f, -1.320913437e+00f, 6.327388009e-01f}},
+     {0.05f, 0.1f, 0.15f, 0.2f, 0.2f, 0.15f, 0.1f, 0.05f}},
+    // 4-tap moving average only
+    {0, 4, {{0.0f, 0.0f, 0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 0.0f, 0.0f}}, {0.25f, 0.25f, 0.25f, 0.25f}},
+    // Pass-through
+    {0, 0, {{0.0f, 0.0f, 0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 0.0f, 0.0f}}, {0.0f}},
+    // Resonant biquad with gain, drives the output into both limits, and a 1-tap gain
+    {1, 1, {{0.5f, 0.0f, -0.5f, -1.6f, 0.95f}, {0.0f, 0.0f, 0.0f, 0.0f, 0.0f}}, {1.5f}},
+};
+
+#if FILTER_MODE == FILTER_ON
+static FILTER_REFERENCE filterRef[FILTER_CHANNELS];    // Reference of the live filter bank
+static Uint32 filterLoadSample;             // Sample at which filterTestSets[0] is loaded
+static Uint64 filterLoadFailures;           // FilterLoad() refused the set
+#endif
+
+#if ADC_CAPTURE_MODE == ADC_CAPTURE_CLA
+#define CLA_FILTER_TOLERANCE 0.1    // Engineering units between the float32 filter and the reference
+static Uint64 claRingMismatches;            // Newest ring record differs from the inputs or the reference scaling
+static Uint64 claFilterErrors;              // Filter outputs further than CLA_FILTER_TOLERANCE from the reference
+static Uint64 claRecords;                   // Ring records checked
+static float64 claFilter[SCALE_NUM_CHANNELS];   // Double-precision low-pass reference
+#endif
+
+// Motor model
+#define MOTOR_TEST_STEPS    75000               // 1.5 s at 50 kHz, twelve mechanical time constants
+#define MOTOR_TEST_DUTY     3000                // ADC-B count, 73 % duty
+#define MOTOR_TEST_TORQUE   2548                // ADC-D count, 49 mNm load
+#define MOTOR_REF_SUBSTEPS  16                  // Reference steps per model step in the self-test
+#define MOTOR_DAC_TOLERANCE 2                   // Counts between the live DACs and the reference
+
+// Double-precision reference of the motor model state
+typedef struct
+{
+    float64 i;                                  // Armature current [A]
+    float64 w;                                  // Speed [rad/s]
+} MOTOR_REFERENCE;
+
+#if DAC_SOURCE == DAC_SOURCE_MODEL
+static MOTOR_REFERENCE motorRef;                // Reference of the live model
+static Uint16 motorDacErrorMax;                 // Largest DAC difference from the reference
+#endif
+
+// DDS
+#define DDS_TEST_SAMPLES    60000               // 1.2 s at 50 kHz
+#define DDS_TEST_HZ         50000.0f            // Sample rate of the self-test
+#define DDS_LIVE_SAMPLE     100                 // Sample at which the live tones are loaded
+
+#if DAC_SOURCE == DAC_SOURCE_DDS
+// Live tones, one per DAC: dac, sweep, end, amplitude, start, stop, seconds
+static const DDS_TONE_CONFIG ddsLiveTones[DDS_DACS] =
+{
+    {DDS_DAC_A, DDS_SWEEP_OFF, DDS_END_HOLD, 2000.0f, 1000.0f, 0.0f, 0.0f},
+    {DDS_DAC_B, DDS_SWEEP_OFF, DDS_END_HOLD, 1500.0f, 3333.3f, 0.0f, 0.0f},
+    {DDS_DAC_C, DDS_SWEEP_OFF, DDS_END_HOLD, 1000.0f, 12345.6f, 0.0f, 0.0f},
+};
+static Uint32 ddsLiveSteps[DDS_DACS];           // Phase steps the generators took
+static Uint64 ddsLoadFailures;                  // DdsLoad() refused a live tone
+#endif
+
+// Playback
+#define PLAYBACK_LOOP_SAMPLE    100             // Sample at which the looped table is started
+#define PLAYBACK_LOOP_FRAMES    1000            // Frames of the looped table
+#define PLAYBACK_LOOP_HZ        40000.0f
+#define PLAYBACK_ONCE_FRAMES    200             // Frames of the table played once from the midpoint
+#define PLAYBACK_ONCE_HZ        1000.0f
+#define PLAYBACK_STREAM_HZ      20000.0f        // Frame rate of the stream over the last quarter
+#define PLAYBACK_DMA_CH         5               // HostStats.dmaChIsrCalls of dmach6_isr; CH4 is the DMA capture
+
+#if DAC_SOURCE == DAC_SOURCE_PLAYBACK
+static Uint32 playbackOnceSample;               // Sample at which the once table is started
+static Uint32 playbackStreamSample;             // Sample at which the stream is started
+static Uint16 playbackMode;                     // Profile the host started last, PLAYBACK_*
+static Uint32 playbackTriggers;                 // ePWM6 DMA triggers since it was started
+static Uint32 playbackProduced;                 // Frames handed out by the host source
+static Uint64 playbackTriggerCount[PLAYBACK_STREAM + 1];    // Triggers seen in each mode
+static Uint64 playbackStartFailures;            // PlaybackStart() refused a profile
+static Uint64 playbackMismatches;               // DAC-A/DAC-B differ from the frame due
+static Uint64 playbackTimingErrors;             // Trigger not one programmed period after the previous one
+static Uint64 playbackLoopIsrCalls;             // DMA CH6 ISR calls while the looped table played
+static Uint64 playbackOnceIsrCalls;             // DMA CH6 ISR calls up to the stream, the once pass end only
+static Uint16 playbackOnceEnded;                // At the stream start: the once pass had stopped, counted and held its last frame
+static float64 playbackLastTime;                // Time of the previous trigger
+#endif
+
+#if (CPU2_MODE == CPU2_ON) || (SDRAM_MODE == SDRAM_ON) || (ADC_CAPTURE_MODE == ADC_CAPTURE_DMA)
+static Uint16 (*sampleInputs)[HOST_ADC_CHANNELS];   // Every sample's inputs, for the CPU2 window, SDRAM and DMA block references
+static Uint32 sampleInputCount;
+static Uint32 sampleInputSize;                      // Entries allocated
+#endif
+
+// SDRAM store
+#define SDRAM_RING_SAMPLE   1000                // Sample at which the ring capture is started
+#define SDRAM_RING_DEPTH    8000UL              // Rounded up to 63 blocks, wrapped several times before the stop
+#define SDRAM_FILL_DEPTH    40000UL             // Rounded up to 313 blocks
+#define SDRAM_READ_FRAMES   1000                // Frames per readback
+
+#if SDRAM_MODE == SDRAM_ON
+#define SDRAM_PHASE_IDLE    0                   // Waiting for SDRAM_RING_SAMPLE
+#define SDRAM_PHASE_RING    1                   // Ring recording until sdramStopSample
+#define SDRAM_PHASE_FILL    2                   // Fill recording until the store stops by itself
+#define SDRAM_PHASE_READ    3                   // Reading back what the last capture stored
+#define SDRAM_PHASE_DONE    4
+
+static Uint32 sdramStopSample;                  // Sample at which the ring capture is stopped
+static Uint16 sdramPhase;
+static Uint16 sdramCaptures;                    // Captures read back completely
+static Uint16 sdramFrames[SDRAM_READ_FRAMES][SDRAM_STORE_CHANNELS];  // Readback target
+static Uint32 sdramReadSample;                  // Stored sample the pending readback started at
+static Uint16 sdramReadCount;                   // Frames of the pending readback, 0 = none
+static Uint64 sdramFramesRead;                  // Frames read back and compared
+static Uint64 sdramMismatches;                  // Frames that differ from the inputs of their sample
+static Uint64 sdramDepthErrors;                 // Captures that did not keep their rounded depth
+static Uint64 sdramRefusals;                    // Requests refused, or readbacks accepted while recording
+#endif
+
+// Switching stage
+#if PWM_OUTPUT_MODE != PWM_OUTPUT_FIXED
+#define PWM_TBCLK_PS    (1e12 / (float64)PWM_TBCLK_HZ)     // 10 ns
+
+static Uint64 pwmChecks;                        // Samples at which the compare registers were checked
+static Uint64 pwmMismatches;                    // Registers or command differ from what the firmware should have written
+static Uint64 pwmEdgeErrors;                    // Edges further from the ideal one than the resolution allows
+static float64 pwmMepErrorMax;                  // Largest edge error where the MEP places the edge [ps]
+static float64 pwmTbclkErrorMax;                // Largest edge error on whole TBCLK edges [ps]
+#endif
+
+// PWM measurement
+#if PWM_OUTPUT_MODE == PWM_OUTPUT_FIXED
+#define ECAP_PWM1_TICKS     50001ULL            // PWM1_PERIOD + 1 of actuation_cpu01.c
+#define ECAP_TBCLK_PS       20000ULL            // HSPCLKDIV = /2
+#else
+#define ECAP_PWM1_TICKS     ((Uint64)PWM_PERIOD_TICKS)
+#define ECAP_TBCLK_PS       10000ULL
+#endif
+#define ECAP_PWM1_PERIOD_PS (ECAP_PWM1_TICKS * ECAP_TBCLK_PS)
+#define ECAP_CYCLE_PS       (1000000000000ULL / ECAP_SYSCLK_HZ)    // One time stamp count: 5 ns
+#define ECAP_EXT_PERIODS    3                   // External PWM period in PWM1A periods, so its phase is fixed
+#define ECAP_EXT_DELAY_PS   1234567ULL          // External rising edge after a PWM1A one
+#define ECAP_WALK_PERIODS   16                  // PWM periods searched for the edges of one cycle
+#define ECAP_MIN_CYCLES     100                 // Cycles each channel must have measured
+// PWM1A, and so every channel, slower than two background loop passes: no cycle may be missed
+#define ECAP_EVERY_CYCLE    (ECAP_PWM1_PERIOD_PS > 2ULL * MAIN_LOOP_PERIOD_US * 1000000ULL)
+
+#if ECAP_MODE == ECAP_ON
+static volatile struct ECAP_REGS *const ecapRegs[ECAP_CHANNELS] = {&ECap1Regs, &ECap2Regs, &ECap3Regs};
+static Uint32 ecapSeen[ECAP_CHANNELS];          // EcapStatus.channel[].cycles already checked
+static Uint32 ecapNextRise[ECAP_CHANNELS];      // Rising edge that ends the last cycle checked
+static Uint64 ecapGaps;                         // Cycles published that do not start where the last one ended
+static Uint64 ecapChecks;                       // Published cycles checked
+static Uint64 ecapUnchecked;                    // Cycles whose periods the emulation no longer holds, or phases
+                                                // taken from a PWM1A cycle stretched by a 0 % or 100 % period
+static Uint64 ecapErrors;                       // Period, high time, duty or phase further than one count off
+static float64 ecapPhaseErrorMax;               // Largest phase error [ps]
+#endif
+
+// Encoder
+#define QEP_TEST_START      1234.3              // Shaft position at reset [counts]
+#define QEP_TEST_INDEX      100.5               // Index marker [counts into the revolution]
+#define QEP_TEST_MISSED     3                   // Edges the counter loses at QEP_TEST_MISS_SECONDS
+#define QEP_TEST_MISS_SECONDS 0.5
+#define QEP_TEST_KNOTS      11
+
+#if SPEED_INPUT == SPEED_INPUT_QEP
+// Shaft speed [s, rad/s], linear between knots and held after the last
+static const float64 qepKnots[QEP_TEST_KNOTS][2] =
+{
+    {0.00, 0.0}, {0.05, 0.0}, {0.35, 500.0}, {0.60, 500.0}, {0.90, -60.0},
+    {1.10, -60.0}, {1.20, 2.0}, {1.60, 2.0}, {1.70, 0.5}, {1.85, 0.5}, {1.86, 0.0}
+};
+static float64 qepKnotPosition[QEP_TEST_KNOTS];    // Shaft position at each knot [counts]
+static int64 qepCounted[QEP_WINDOW];            // Edges counted at the last QEP_WINDOW samples, by QepStatus.samples
+static Uint32 qepSamples;                       // QepStatus.samples at the last check
+static float64 qepLastShaft;                    // Shaft position at the last check [counts]
+static int64 qepHome;                           // Count of the first index marker passed
+static int32 qepMissed;                         // Edges the counter has lost
+static Uint16 qepMissState;                     // 0 = to come, 1 = handed to the emulation, 2 = lost, 3 = corrected
+static Uint64 qepChecks;                        // Samples checked
+static Uint64 qepPositionErrors;                // Position, turns, angle or homing wrong
+static Uint64 qepUnitErrors;                    // Unit-time speed not the count over its window
+static Uint64 qepCaptureChecks;                 // Samples at a constant speed
+static Uint64 qepCaptureErrors;                 // Capture-timer speed more than one CAPCLK off, or not 0 at rest
+static Uint64 qepMethodErrors;                  // Method not the one for a constant speed
+static Uint64 qepPublishErrors;                 // speed/speedScaled not the estimate in use, or a sample skipped
+static Uint64 qepMethodSamples[2];              // Samples with each method in use
+static float64 qepCaptureErrorMax;              // Largest capture-timer error relative to the speed
+#endif
+
+// Current input
+#define SDFM_TEST_AMPLITUDE 0.5                 // Sine on the current [fraction of full scale]
+#define SDFM_TEST_HZ        37.0
+#define SDFM_TEST_PULSES    3
+#define SDFM_TEST_PULSE_SECONDS  500e-6         // Over-current pulse length
+#define SDFM_TEST_SETTLE_SECONDS 20e-6          // Modulator recovery after a pulse, not tracked
+#define SDFM_TEST_CLEAR_SECONDS  0.9            // SdfmFaultClear() from the host
+#define SDFM_TRIP_BITS      (4 * SDFM_COMPARATOR_OSR)   // Flag rise after a pulse start, at most [modulator bits]
+
+#if SDFM_MODE == SDFM_ON
+// Over-current pulse on the sine
+typedef struct
+{
+    float64 start;                              // [s]
+    float64 level;                              // Current during the pulse [fraction of full scale]
+    Uint16 fault;                               // SdfmStatus.fault bit it latches, 0 = a trip is already latched
+} SDFM_TEST_PULSE;
+
+static const SDFM_TEST_PULSE sdfmTestPulses[SDFM_TEST_PULSES] =
+{
+    {0.6, 0.8, SDFM_FAULT_HIGH},
+    {0.7, 0.8, 0},
+    {1.3, -0.8, SDFM_FAULT_LOW},
+};
+static Uint32 sdfmWeight[3 * SDFM_OSR - 2];     // Impulse response of the sinc3 data filter
+static Uint16 sdfmShift;                        // SDIPARM1.SH for SDFM_OSR
+static float64 sdfmGain;                        // [mA] per data filter count
+static float64 sdfmFullScale;                   // Data filter counts at full scale
+static float64 sdfmTrackTolerance;              // Counts from the delayed current: rounding and the modulator noise left
+static float64 sdfmBitSin;                      // Rotation of the test sine over one modulator bit
+static float64 sdfmBitCos;
+static Uint64 sdfmTripPs[SDFM_TEST_PULSES];     // First flag rise in each pulse, 0 = none
+static Uint16 sdfmFault;                        // SdfmStatus.fault the firmware must hold
+static Uint16 sdfmCleared;                      // SdfmFaultClear() has been called
+static Uint64 sdfmChecks;                       // Samples checked
+static Uint64 sdfmTrackChecks;                  // Samples away from the pulses
+static Uint64 sdfmDataErrors;                   // SDDATA1 not the sinc3 of the bits, or not the newest output
+static Uint64 sdfmFlagErrors;                   // Flag rise outside a pulse that can trip, or in the wrong direction
+static Uint64 sdfmLatchErrors;                  // SdfmStatus not following the flags, or not re-armed
+static float64 sdfmTrackErrorMax;               // Largest data error from the delayed current [counts]
+static Uint64 sdfmTripPsMax;                    // Largest flag rise after a pulse start [ps]
+
+// ADC-C code of a data filter result
+static Uint16 SdfmTestCode(Uint16 data)
+{
+    int32 code = 2048 + (int32)(int16)data;
+
+    return (Uint16)((code < 0) ? 0 : (code > 4095) ? 4095 : code);
+}
+#define TEST_CURRENT_GAIN   sdfmGain            // [mA] per count of maCurrent[]
+#else
+#define TEST_CURRENT_GAIN   1.22
+#endif
+
+// Over-current trip
+#define CMPSS_TEST_PULSES   5
+#define CMPSS_TEST_CLEARS   3
+#define CMPSS_TEST_STEP     0                   // Pulse shape: the level for the length of the pulse
+#define CMPSS_TEST_BUMP     1                   // Pulse shape: a half sine of the level on top of the sine
+#define CMPSS_TEST_SCAN_PS  1000ULL             // Step of the search for the crossing of a pulse
+#define CMPSS_TEST_RESUME_PS 100000000ULL       // Outputs back after a clear, at most [ps]
+#define CMPSS_TRIP_PS       1000000ULL          // One-shot trip after the input crosses the limit, at most [ps]
+
+#if CMPSS_MODE == CMPSS_ON
+// Excursion of the current
+typedef struct
+{
+    float64 start;                              // [s]
+    float64 length;                             // [s]
+    float64 level;                              // [ADC code] Level of a step, height of a bump
+    Uint16 shape;                               // CMPSS_TEST_STEP or CMPSS_TEST_BUMP
+    Uint16 fault;                               // CmpssStatus.fault bit it latches, 0 = it must not trip
+} CMPSS_TEST_PULSE;
+
+static const CMPSS_TEST_PULSE cmpssTestPulses[CMPSS_TEST_PULSES] =
+{
+    {0.6, 50e-6, 4000.0, CMPSS_TEST_STEP, CMPSS_FAULT_HIGH},
+    {0.64, 50e-6, 4000.0, CMPSS_TEST_STEP, 0},         // The first trip is still held
+    {0.68, 8e-9, 4000.0, CMPSS_TEST_STEP, 0},          // Glitch, shorter than the filter
+    {0.7, 50e-6, 50.0, CMPSS_TEST_STEP, CMPSS_FAULT_LOW},
+    {1.2, 200e-6, 3500.0, CMPSS_TEST_BUMP, CMPSS_FAULT_HIGH},
+};
+static const float64 cmpssTestClears[CMPSS_TEST_CLEARS] = {0.66, 0.76, 1.3};   // CmpssFaultClear() from the host [s]
+static Uint64 cmpssCrossPs[CMPSS_TEST_PULSES];  // Time each pulse first takes the input past a limit
+static Uint64 cmpssTripPs[CMPSS_TEST_PULSES][HOST_TRIP_EPWMS];  // One-shot trip of ePWM1/ePWM5 in each pulse, 0 = none
+static Uint64 cmpssSeenPs[HOST_TRIP_EPWMS];     // HostCmpss.tripPs at the last check
+static Uint16 cmpssHighCode;                    // DAC codes of +-CMPSS_TRIP_MA
+static Uint16 cmpssLowCode;
+static Uint16 cmpssFault;                       // CmpssStatus.fault the firmware must hold
+static Uint16 cmpssHeld;                        // A trip is set and the host has not cleared it
+static Uint16 cmpssClears;                      // CmpssFaultClear() calls made
+static Uint64 cmpssChecks;                      // Samples checked
+static Uint64 cmpssHeldSamples;                 // Samples with the outputs tripped
+static Uint64 cmpssTripErrors;                  // Trip outside a pulse that can trip, late, or missing
+static Uint64 cmpssLatchErrors;                 // CmpssStatus not following the trips, or not cleared
+static Uint64 cmpssOutputErrors;                // Outputs not held low from a trip to its clear, or not back after it
+static Uint64 cmpssTripPsMax;                   // Largest trip after the crossing [ps]
+
+// HostCmpss input hook: the ADC-C sine, a step where one is on, a bump added where one is on
+static float64 CmpssTestInput(float64 seconds, float64 *jump)
+{
+    const CMPSS_TEST_PULSE *p;
+    float64 x = 2048.0 + 1500.0 * sin(2.0 * HOST_PI * 37.0 * seconds);
+    float64 end;
+    Uint16 k;
+
+    *jump = 1e6;                                // No step to come
+    for (k = 0; k < CMPSS_TEST_PULSES; k++)
+    {
+        p = &cmpssTestPulses[k];
+        end = p->start + p->length;
+        if ((seconds >= p->start) && (seconds < end))
+        {
+            x = (p->shape == CMPSS_TEST_STEP) ? p->level : x + p->level * sin(HOST_PI * (seconds - p->start) / p->length);
+        }
+        if ((p->shape == CMPSS_TEST_STEP) && (p->start > seconds) && (p->start < *jump))
+        {
+            *jump = p->start;
+        }
+        if ((p->shape == CMPSS_TEST_STEP) && (end > seconds) && (end < *jump))
+        {
+            *jump = end;
+        }
+    }
+    return x;
+}
+
+// ADC-C code of the current input
+static Uint16 CmpssTestCode(float64 seconds)
+{
+    float64 jump;
+    float64 x = CmpssTestInput(seconds, &jump);
+
+    return (Uint16)((x < 0.0) ? 0.0 : (x > 4095.0) ? 4095.0 : x);
+}
+
+#if ECAP_MODE == ECAP_ON
+// A trip holds the outputs during first..last [ps], or gives them back in it
+static Uint16 CmpssTestHeld(Uint64 firstPs, Uint64 lastPs)
+{
+    Uint64 clearPs;
+    Uint16 k;
+    Uint16 c;
+
+    for (k = 0; k < CMPSS_TEST_PULSES; k++)
+    {
+        if (cmpssTripPs[k][0] == 0)
+        {
+            continue;
+        }
+        for (c = 0; (c + 1 < CMPSS_TEST_CLEARS) && (cmpssTestClears[c] * 1e12 < (float64)cmpssTripPs[k][0]); c++)
+        {
+        }
+        clearPs = (Uint64)(cmpssTestClears[c] * 1e12) + CMPSS_TEST_RESUME_PS;
+        if ((lastPs >= cmpssTripPs[k][0]) && (firstPs <= clearPs))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+#endif
+#endif
+
+// CPU2 (CPU2_ON): host_main plays CPU2. It reports ready before the firmware starts,
+// then after every sample takes the blocks CPU1 posted with IpcBatchService(), checks
+// their slot, continuity and ADC-B content, runs them through cpu2_process.c and
+// releases them; each take raises IPC0 back to CPU1, whose completion ISR must
+// account every block with a post-to-take latency under two sample periods. Every
+// closed window must match min/max/mean computed from the inputs, the filter outputs
+// must stay within two counts of a double-precision low-pass, and no block may be lost or refused. With CPU2_LINK_GSRAM every page must
+// belong to CPU2 (GSxMSEL) when it is taken. SCI-A and telemetry belong to CPU2
+// in this mode and are not checked.
+#if CPU2_MODE == CPU2_ON
+// With ADC_CAPTURE_DMA the stream takes DMA_CAPTURE_HALF_SIZE records at once, more than the put
+// buffer holds, so the link may hold blocks back once per DMA block; otherwise never
+#if ADC_CAPTURE_MODE == ADC_CAPTURE_DMA
+#define CPU2_LINK_STALLS    dmaBlockCount
+#else
+#define CPU2_LINK_STALLS    0
+#endif
+
+static IPC_BATCH cpu2Batch;                  // CPU2 side of IPC_LINK_INT
+static Uint64 cpu2Blocks;                   // Blocks taken from the IPC put buffer
+static Uint64 cpu2Records;                  // Records in those blocks
+static Uint64 cpu2BadBlocks;                // Wrong command, slot, block number or length
+static Uint64 cpu2Gaps;                     // Records whose timestamp does not follow the previous one
+static Uint64 cpu2Mismatches;               // Records whose ADC-B value is not this sample's input
+static Uint64 cpu2WindowErrors;             // Closed windows that differ from the reference
+static Uint64 cpu2FilterErrors;             // Filter outputs more than two counts from the reference
+static Uint64 cpu2OwnerErrors;              // GS RAM pages taken while CPU1 still owned them (CPU2_LINK_GSRAM)
+static float64 cpu2Filter[STREAM_CHANNELS]; // Double-precision low-pass reference
+static Uint16 cpu2Windows;                  // Cpu2Status.windows already checked
+
+// Compare the last closed window with the statistics of the recorded inputs
+static void Cpu2CheckWindow(void)
+{
+    CPU2_WINDOW window;
+    Uint32 first;
+    Uint32 n;
+    Uint16 ch;
+    Uint16 lo;
+    Uint16 hi;
+    Uint32 sum;
+
+    if ((Cpu2WindowSnapshot(&window) == 0) || (window.firstTimestamp + CPU2_STATS_WINDOW > sampleInputCount))
+    {
+        cpu2WindowErrors++;
+        return;
+    }
+    first = window.firstTimestamp;
+    for (ch = 0; ch < STREAM_CHANNELS; ch++)
+    {
+        lo = 0xFFFF;
+        hi = 0;
+        sum = 0;
+        for (n = first; n < first + CPU2_STATS_WINDOW; n++)
+        {
+            lo = (sampleInputs[n][ch] < lo) ? sampleInputs[n][ch] : lo;
+            hi = (sampleInputs[n][ch] > hi) ? sampleInputs[n][ch] : hi;
+            sum += sampleInputs[n][ch];
+        }
+        if ((window.min[ch] != lo) || (window.max[ch] != hi) ||
+            (window.mean[ch] != (Uint16)((sum + CPU2_STATS_WINDOW / 2) / CPU2_STATS_WINDOW)))
+        {
+            cpu2WindowErrors++;
+        }
+    }
+}
+
+// IpcBatchService() callback on the CPU2 side: process and release every block at once
+static void HostCpu2Blocks(const tIpcMessage *messages, Uint16 count)
+{
+    const STREAM_RECORD *records;
+    Uint16 m;
+    Uint16 n;
+    Uint16 i;
+    Uint16 ch;
+
+    for (m = 0; m < count; m++)
+    {
+        if ((messages[m].ulcommand != IPC_CMD_SAMPLE_BLOCK) || (messages[m].uladdress != cpu2Blocks % IPC_BLOCK_SLOTS) ||
+            (messages[m].uldataw1 != IPC_BLOCK_RECORDS) || (messages[m].uldataw2 != (Uint32)cpu2Blocks))
+        {
+            cpu2BadBlocks++;
+        }
+        if ((messages[m].uladdress >= IPC_BLOCK_SLOTS) || (messages[m].uldataw1 > IPC_BLOCK_RECORDS))
+        {
+            continue;
+        }
+
+#if CPU2_LINK == CPU2_LINK_GSRAM
+        if ((MemCfgRegs.GSxMSEL.all & (1UL << (IPC_PAGE_FIRST_GS + messages[m].uladdress))) == 0)
+        {
+            cpu2OwnerErrors++;                  // On the target CPU2 would read zeros
+        }
+#endif
+        records = IpcBlocks[messages[m].uladdress].record;
+        n = (Uint16)messages[m].uldataw1;
+        for (i = 0; i < n; i++)
+        {
+            if (records[i].timestamp != (Uint32)cpu2Records)
+            {
+                cpu2Gaps++;
+            }
+            if (records[i].adc[1] != ((records[i].timestamp * 7U) & 0x0FFF))
+            {
+                cpu2Mismatches++;
+            }
+            for (ch = 0; ch < STREAM_CHANNELS; ch++)
+            {
+                cpu2Filter[ch] += ((float64)records[i].adc[ch] - cpu2Filter[ch]) / (1 << CPU2_FILTER_SHIFT);
+            }
+            cpu2Records++;
+        }
+
+        Cpu2ProcessBlock(records, n);
+        for (ch = 0; ch < STREAM_CHANNELS; ch++)
+        {
+            if (fabs((float64)Cpu2Status.filtered[ch] - cpu2Filter[ch]) > 2.0)
+            {
+                cpu2FilterErrors++;
+            }
+        }
+        if (Cpu2Status.windows != cpu2Windows)
+        {
+            cpu2Windows = Cpu2Status.windows;
+            Cpu2CheckWindow();
+        }
+        cpu2Blocks++;
+        Cpu2Status.blocksDone++;                // Release the slot (GS RAM page)
+    }
+}
+
+// Far end of the IPC link, run after every sample: take what CPU1 posted and interrupt CPU1 back
+static void HostCpu2(void)
+{
+    Uint32 gets = cpu2Batch.stats.gets;
+
+    IpcBatchService(&cpu2Batch);
+    IpcRegs.IPCSET.all &= ~IPC_FLAG0;
+    if (cpu2Batch.stats.gets != gets)
+    {
+        HostIpcInterrupt();                     // IpcGetBatch() raised IPC0 towards CPU1
+    }
+}
+#endif
+
+// Synthetic inputs: two sines for the bipolar channels, a ramp and a triangle for the others.
+// With SDFM_ON the current is the SDFM result, already brought up to this SOCA; with CMPSS_ON it
+// has the over-current pulses on it.
+static void SyntheticInputs(Uint32 sample, float64 seconds, Uint16 adc[HOST_ADC_CHANNELS])
+{
+    adc[0] = (Uint16)(2048.0 + 1800.0 * sin(2.0 * HOST_PI * TEST_ADCA_HZ * seconds));  // ADC-A mmSpeed
+    adc[1] = (Uint16)((sample * 7U) & 0x0FFF);                                   // ADC-B DutyCycle
+#if SDFM_MODE == SDFM_ON
+    adc[2] = SdfmTestCode((Uint16)Sdfm1Regs.SDDATA1.bit.DATA16);                 // SDFM maCurrent
+#elif CMPSS_MODE == CMPSS_ON
+    adc[2] = CmpssTestCode(seconds);                                             // ADC-C maCurrent, CMPSS6 input
+#else
+    adc[2] = (Uint16)(2048.0 + 1500.0 * sin(2.0 * HOST_PI * 37.0 * seconds));    // ADC-C maCurrent
+#endif
+    adc[3] = (Uint16)((sample & 0x1000) ? (0x0FFF - (sample & 0x0FFF)) : (sample & 0x0FFF)); // ADC-D LoadTorque
+}
+
+#if (CPU2_MODE == CPU2_ON) || (SDRAM_MODE == SDRAM_ON) || (ADC_CAPTURE_MODE == ADC_CAPTURE_DMA)
+// Input hook: the synthetic inputs, kept for the references that look back at past samples
+static void RecordInputs(Uint32 sample, float64 seconds, Uint16 adc[HOST_ADC_CHANNELS])
+{
+    SyntheticInputs(sample, seconds, adc);
+    if ((sample == sampleInputCount) && (sampleInputCount < sampleInputSize))
+    {
+        memcpy(sampleInputs[sampleInputCount++], adc, sizeof(sampleInputs[0]));
+    }
+}
+#endif
+
+// Independent reference for a captured value, allowing one count of rounding difference
+static Uint16 CaptureMatches(int16 captured, Uint16 raw, float64 gain)
+{
+    float64 expected = gain * ((float64)raw - 2048.0);
+
+    return fabs((float64)captured - expected) <= 1.0;
+}
+
+// CLA (ADC_CAPTURE_CLA): Cla1Task1 runs on the host in place of adca1_isr. After every
+// task run the DACs and ClaStatus.dacLatency are checked as above, the newest ClaRing[]
+// record must hold this sample's inputs and scaled values that match the reference, and
+// ClaStatus.filtered[] must stay within CLA_FILTER_TOLERANCE of a double-precision
+// low-pass of ClaStatus.scaled[]. After the run every SOCA must have started the task
+// once and the ring must never have overflowed.
+#if ADC_CAPTURE_MODE == ADC_CAPTURE_CLA
+// Check what Cla1Task1 left for this sample
+static void CheckClaSample(const Uint16 adc[HOST_ADC_CHANNELS], const Uint16 expected[HOST_ADC_CHANNELS])
+{
+    static Uint16 lastHead;
+    const CLA_SAMPLE *record;
+    Uint16 ch;
+
+    if (ClaStatus.head != lastHead)
+    {
+        record = &ClaRing[(Uint16)(ClaStatus.head - 1) & CLA_RING_MASK];
+        claRecords++;
+        if ((memcmp(record->adc, adc, sizeof(record->adc)) != 0) ||
+            !CaptureMatches(record->speed, expected[0], 2.93) || !CaptureMatches(record->current, expected[2], 1.22))
+        {
+            claRingMismatches++;
+        }
+        lastHead = ClaStatus.head;
+    }
+
+    for (ch = 0; ch < SCALE_NUM_CHANNELS; ch++)
+    {
+        claFilter[ch] += CLA_FILTER_ALPHA * ((float64)ClaStatus.scaled[ch] - claFilter[ch]);
+        if (fabs((float64)ClaStatus.filtered[ch] - claFilter[ch]) > CLA_FILTER_TOLERANCE)
+        {
+            claFilterErrors++;
+        }
+    }
+}
+#endif
+
+// Motor model: before the run every integrator is stepped from rest with constant inputs
+// against a double-precision RK4 reference at 1/16 of the step and must reach the analytic
+// steady state; the error and ns per step are reported. With DAC_SOURCE_MODEL the reference
+// also runs on the live duty cycle and load torque, and DAC-A/DAC-B must stay within
+// MOTOR_DAC_TOLERANCE counts of its speed and current.
+//
+// Right-hand side of the motor equations in motor_model.h, in double precision
+static void MotorReferenceDerivative(float64 v, float64 tl, float64 i, float64 w, float64 *di, float64 *dw)
+{
+    float64 friction = w / (float64)MOTOR_STICTION_SPEED;
+
+    friction = (friction > 1.0) ? 1.0 : (friction < -1.0) ? -1.0 : friction;
+    *di = (v - (float64)MotorParams.r * i - (float64)MotorParams.ke * w) / (float64)MotorParams.l;
+    *dw = ((float64)MotorParams.kt * i - (float64)MotorParams.b * w - (float64)MotorParams.tc * friction - tl) /
+          (float64)MotorParams.j;
+}
+
+// Advance the reference by dt in n classical RK4 steps with the inputs taken from raw ADC counts
+static void MotorReferenceStep(MOTOR_REFERENCE *ref, Uint16 dutyRaw, Uint16 torqueRaw, float64 dt, Uint16 n)
+{
+    float64 duty = 2.442e-4 * dutyRaw;
+    float64 v = ((duty > 1.0) ? 1.0 : duty) * (float64)MotorParams.vdc;
+    float64 tl = 0.977e-4 * ((float64)torqueRaw - 2048.0);
+    float64 h = dt / n;
+    float64 di1, dw1, di2, dw2, di3, dw3, di4, dw4;
+
+    while (n-- != 0)
+    {
+        MotorReferenceDerivative(v, tl, ref->i, ref->w, &di1, &dw1);
+        MotorReferenceDerivative(v, tl, ref->i + 0.5 * h * di1, ref->w + 0.5 * h * dw1, &di2, &dw2);
+        MotorReferenceDerivative(v, tl, ref->i + 0.5 * h * di2, ref->w + 0.5 * h * dw2, &di3, &dw3);
+        MotorReferenceDerivative(v, tl, ref->i + h * di3, ref->w + h * dw3, &di4, &dw4);
+        ref->i += h / 6.0 * (di1 + 2.0 * (di2 + di3) + di4);
+        ref->w += h / 6.0 * (dw1 + 2.0 * (dw2 + dw3) + dw4);
+    }
+}
+
+#if DAC_SOURCE == DAC_SOURCE_MODEL
+// DAC code of a reference value, as MotorOutputs() converts it
+static Uint16 MotorReferenceDac(float64 value, float64 gain)
+{
+    float64 code = 2048.0 + value / gain + 0.5;
+
+    return (Uint16)((code < 0.0) ? 0.0 : (code > 4095.0) ? 4095.0 : code);
+}
+
+// Step the reference on this sample's model inputs and compare the DACs with it
+static void CheckMotorSample(const Uint16 expected[HOST_ADC_CHANNELS])
+{
+    Uint16 speedDac;
+    Uint16 currentDac;
+    Uint16 error;
+
+    MotorReferenceStep(&motorRef, expected[1], expected[3], (float64)MotorConfig.dt, 1);
+    speedDac = MotorReferenceDac(motorRef.w, 0.293);           // [0.1 rad/s] per count
+    currentDac = MotorReferenceDac(motorRef.i, 1.22e-3);        // [mA] per count
+    error = (Uint16)abs((int)DacaRegs.DACVALS.all - (int)speedDac);
+    if (abs((int)DacbRegs.DACVALS.all - (int)currentDac) > error)
+    {
+        error = (Uint16)abs((int)DacbRegs.DACVALS.all - (int)currentDac);
+    }
+    if (error > motorDacErrorMax)
+    {
+        motorDacErrorMax = error;
+    }
+    if (error > MOTOR_DAC_TOLERANCE)
+    {
+        dacMismatches++;
+    }
+}
+#endif
+
+// DDS: before the run fixed tones, sums of tones and linear/log chirps are generated with
+// DdsRun() and compared with a double-precision sine of the ideal phase; chirps must follow
+// the discrete sweep law and end, hold or repeat as configured. With DAC_SOURCE_DDS three
+// tones are loaded early in the run and DAC-A/B/C must follow their reference on every sample.
+//
+// Ideal DAC code of a tone at a phase given in turns
+static float64 DdsReference(float64 amplitude, float64 turns)
+{
+    return amplitude * sin(2.0 * HOST_PI * turns);
+}
+
+#if DAC_SOURCE == DAC_SOURCE_DDS
+// Load the live tones, then compare every DAC with the sine of its ideal phase
+static void CheckDdsSample(Uint32 sample)
+{
+    const volatile union DACVALS_REG *dac[DDS_DACS] = {&DacaRegs.DACVALS, &DacbRegs.DACVALS, &DaccRegs.DACVALS};
+    float64 expected;
+    Uint32 k;
+    Uint16 t;
+
+    if (sample == DDS_LIVE_SAMPLE)
+    {
+        for (t = 0; t < DDS_DACS; t++)
+        {
+            DdsConfig[t] = ddsLiveTones[t];
+            ddsLoadFailures += (DdsLoad(t) == 0);
+        }
+    }
+    for (t = 0; t < DDS_DACS; t++)
+    {
+        expected = DDS_DAC_MID;
+        if (sample > DDS_LIVE_SAMPLE)
+        {
+            k = sample - DDS_LIVE_SAMPLE - 1;       // Generated samples since the tones were taken
+            ddsLiveSteps[t] = Dds.tone[t].step;
+            expected += DdsReference(ddsLiveTones[t].amplitude, (float64)(Uint32)(k * ddsLiveSteps[t]) / 4294967296.0);
+        }
+        if (fabs((float64)dac[t]->all - expected) > 1.0)
+        {
+            dacMismatches++;
+        }
+    }
+}
+#endif
+
+// Playback (DAC_SOURCE_PLAYBACK): the host drives the firmware through three profiles: a
+// 1000-frame table looped at 40 kHz from early in the run, a 200-frame table played once at
+// 1 kHz (ePWM6 CLKDIV above /1) from the midpoint, and a stream at 20 kHz from a host source
+// over the last quarter. After every ePWM6 DMA trigger DAC-A/DAC-B must hold the frame due,
+// and the trigger must come one programmed period after the previous one. The loop must
+// not interrupt the CPU. The once table must interrupt once, at its last frame, and by the
+// stream start ePWM6 must have stopped triggering, PlaybackStatus must be back to
+// PLAYBACK_OFF with one completed pass, and the DACs must hold the last frame. The stream
+// must interrupt once per half-buffer with every refill complete and on time. No DAC write
+// may be refused for want of SECMSEL.PF2SEL.
+#if DAC_SOURCE == DAC_SOURCE_PLAYBACK
+// DAC code of frame n of every test profile
+static Uint16 PlaybackPattern(Uint32 n, Uint16 dac)
+{
+    return (dac == PLAYBACK_DAC_A) ? (Uint16)((n * 7U + 100U) & 0x0FFF) : (Uint16)(0x0FFF - ((n * 13U) & 0x0FFF));
+}
+
+// Stream source: the pattern continues from frame to frame across refills
+static Uint16 HostPlaybackSource(Uint16 (*frames)[PLAYBACK_DACS], Uint16 count)
+{
+    Uint16 i;
+
+    for (i = 0; i < count; i++)
+    {
+        frames[i][PLAYBACK_DAC_A] = PlaybackPattern(playbackProduced, PLAYBACK_DAC_A);
+        frames[i][PLAYBACK_DAC_B] = PlaybackPattern(playbackProduced, PLAYBACK_DAC_B);
+        playbackProduced++;
+    }
+    return count;
+}
+
+// Fill the table and start a profile
+static void PlaybackTestStart(Uint16 mode, Uint16 frames, float32 hz)
+{
+    Uint16 i;
+
+    for (i = 0; i < frames; i++)
+    {
+        PlaybackBuffer[i][PLAYBACK_DAC_A] = PlaybackPattern(i, PLAYBACK_DAC_A);
+        PlaybackBuffer[i][PLAYBACK_DAC_B] = PlaybackPattern(i, PLAYBACK_DAC_B);
+    }
+    playbackMode = mode;
+    playbackTriggers = 0;
+    playbackProduced = 0;
+    PlaybackSource = HostPlaybackSource;
+    playbackStartFailures += (PlaybackStart(mode, frames, hz) == 0);
+}
+
+// After every ePWM6 trigger: the DACs hold the frame due and the trigger came on time
+static void CheckPlaybackTrigger(Uint16 persel)
+{
+    Uint32 frame;
+    float64 period;
+
+    if ((persel != DMA_EPWM6A) || (playbackMode == PLAYBACK_OFF))
+    {
+        return;
+    }
+    if (playbackMode == PLAYBACK_LOOP)
+    {
+        frame = playbackTriggers % PLAYBACK_LOOP_FRAMES;
+    }
+    else if (playbackMode == PLAYBACK_ONCE)
+    {
+        frame = (playbackTriggers < PLAYBACK_ONCE_FRAMES) ? playbackTriggers : PLAYBACK_ONCE_FRAMES - 1;
+    }
+    else
+    {
+        frame = playbackTriggers;
+    }
+    if ((DacaRegs.DACVALS.all != PlaybackPattern(frame, PLAYBACK_DAC_A)) ||
+        (DacbRegs.DACVALS.all != PlaybackPattern(frame, PLAYBACK_DAC_B)))
+    {
+        playbackMismatches++;
+    }
+
+    // The first trigger after a restart may still follow the previous profile's period
+    period = (float64)((Uint32)PlaybackStatus.period << PlaybackStatus.clkdiv) / (float64)PLAYBACK_TBCLK_HZ;
+    if ((playbackTriggers != 0) && (fabs(HostTime() - playbackLastTime - period) > 1e-9))
+    {
+        playbackTimingErrors++;
+    }
+    playbackLastTime = HostTime();
+    if (playbackMode == PLAYBACK_LOOP)
+    {
+        playbackLoopIsrCalls = HostStats.dmaChIsrCalls[PLAYBACK_DMA_CH];
+    }
+    playbackTriggerCount[playbackMode]++;
+    playbackTriggers++;
+}
+#endif
+
+// Switching stage (PWM_OUTPUT_DUTY, PWM_OUTPUT_HRPWM): after every sample (every ADCAINT1
+// DMA trigger with ADC_CAPTURE_DMA) ePWM1 and ePWM5 must hold the compare value the firmware
+// last wrote, in adca1_isr for this sample's ADC-B input. The falling edge it places, with
+// CMPAHR converted through HRMSTEP, must be within half a MEP step (half a TBCLK where the MEP
+// is not used) plus the 1/256 TBCLK rounding of the ideal edge. After the run the carrier,
+// shadow loading and HRPWM setup are checked, and with PWM_OUTPUT_HRPWM the SFO stand-in
+// must have been run to completion before the first edge and again from the background loop.
+#if PWM_OUTPUT_MODE != PWM_OUTPUT_FIXED
+// ePWM1/ePWM5 hold the last command (and, if given, the expected one) with its edge where it belongs
+static void CheckPwmOutput(const Uint16 *expected)
+{
+    Uint32 compare = PwmStatus.compare;
+    Uint16 fraction = (compare >> 8) & 0xFF;    // CMPAHR, 1/256 TBCLK
+    Uint16 mep = EPwm1Regs.HRMSTEP.bit.HRMSTEP;
+    float64 ideal = (float64)PwmStatus.command * PWM_PERIOD_TICKS * PWM_TBCLK_PS / PWM_DUTY_FULL_SCALE;
+    float64 placed = (float64)(compare >> 16) * PWM_TBCLK_PS;
+    float64 error;
+    Uint16 mepEdge = 0;                         // The MEP places this edge
+
+    pwmChecks++;
+    if ((EPwm1Regs.CMPA.all != compare) || (EPwm5Regs.CMPA.all != compare) || ((compare & 0xFF) != 0) ||
+        ((expected != NULL) && (PwmStatus.command != *expected)))
+    {
+        pwmMismatches++;
+    }
+#if PWM_OUTPUT_MODE == PWM_OUTPUT_HRPWM
+    mepEdge = (ideal >= PWM_HR_EDGE_TICKS * PWM_TBCLK_PS) &&
+              (ideal <= (PWM_PERIOD_TICKS - PWM_HR_EDGE_TICKS) * PWM_TBCLK_PS - PWM_TBCLK_PS / 256.0);
+    if (mep != 0)
+    {
+        placed += (float64)((fraction * mep + 0x80) >> 8) * PWM_TBCLK_PS / mep;    // Auto-conversion
+    }
+#endif
+    error = fabs(placed - ideal);
+    if (mepEdge)
+    {
+        pwmMepErrorMax = (error > pwmMepErrorMax) ? error : pwmMepErrorMax;
+        if (error > PWM_TBCLK_PS / (2.0 * mep) + PWM_TBCLK_PS / 256.0)
+        {
+            pwmEdgeErrors++;
+        }
+    }
+    else
+    {
+        pwmTbclkErrorMax = (error > pwmTbclkErrorMax) ? error : pwmTbclkErrorMax;
+        if ((fraction != 0) || (error > PWM_TBCLK_PS / 2.0 + PWM_TBCLK_PS / 256.0))
+        {
+            pwmEdgeErrors++;
+        }
+    }
+}
+
+// Carrier, shadow loading and HRPWM setup of one module; returns 1 if anything differs
+static Uint16 PwmModuleWrong(volatile struct EPWM_REGS *epwm)
+{
+    Uint16 hrcnfg = 0;
+
+#if PWM_OUTPUT_MODE == PWM_OUTPUT_HRPWM
+    hrcnfg = 2 | (1 << 6);                      // EDGMODE falling, CTLMODE CMPAHR, HRLOAD CTR = 0, AUTOCONV
+#endif
+    return (epwm->TBPRD != PWM_PERIOD_TICKS - 1) || (epwm->TBCTL.bit.CTRMODE != 0) ||
+           (epwm->TBCTL.bit.HSPCLKDIV != 0) || (epwm->TBCTL.bit.CLKDIV != 0) ||
+           (epwm->CMPCTL.bit.SHDWAMODE != 0) || (epwm->CMPCTL.bit.LOADAMODE != 0) ||
+           (epwm->AQCTLA.bit.ZRO != 2) || (epwm->AQCTLA.bit.CAU != 1) || (epwm->HRCNFG.all != hrcnfg);
+}
+#endif
+
+// PWM measurement (ECAP_ON): ePWM5 is given a quarter-period phase offset and the host puts an
+// external PWM of ECAP_EXT_PERIODS PWM1A periods on ECAP_EXT_GPIO. Every cycle the firmware
+// publishes in EcapStatus is checked against the edges the emulation replayed: the PWM1A/PWM5A
+// period and high time follow the compare values loaded in the periods the eCAP saw (so 0 %
+// and 100 % periods are accounted for), the phase after PWM1A comes from TBPHS or the external
+// delay, all within one 5 ns count. Each cycle must start where the one published before it
+// ended while the PWM period is longer than two background loop passes (ECAP_EVERY_CYCLE).
+// After the run every channel must have measured at least ECAP_MIN_CYCLES cycles with no eCAP
+// interrupt enabled.
+#if ECAP_MODE == ECAP_ON
+// Period and high time [ps] of the ePWMxA cycle whose rising edge is in the time stamp count
+// starting at risePs, from the compare values the emulation loaded; 0 if they are not all kept.
+// A period set on zero is cleared on CMPA, not at all with CMPA beyond TBPRD, at once with CMPA = 0.
+static Uint16 EcapPwmCycle(volatile struct EPWM_REGS *epwm, Uint64 risePs, float64 *period, float64 *high)
+{
+    Uint64 periodPs = HostEpwmPeriodPs(epwm);
+    Uint32 prd = (Uint32)epwm->TBPRD + 1;
+    float64 tbclk = (float64)periodPs / prd;
+    Uint16 mep = (epwm->HRCNFG.bit.EDGMODE == 2) ? epwm->HRMSTEP.bit.HRMSTEP : 0;
+    Uint64 probe = risePs + ECAP_CYCLE_PS - 1;  // Inside the period the edge started
+    Uint32 compare;
+    Uint16 level = 1;
+    Uint16 k;
+
+    for (k = 0; k < ECAP_WALK_PERIODS; k++)
+    {
+        compare = HostEpwmCompareAt(epwm, probe + k * periodPs);
+        if (compare == HOST_COMPARE_NONE)
+        {
+            return 0;
+        }
+        if ((compare >> 16) == 0)
+        {
+            if (level == 1)
+            {
+                *high = (float64)k * periodPs;
+            }
+            level = 0;
+        }
+        else if (level == 0)
+        {
+            *period = (float64)k * periodPs;    // Set on zero after a low end: the next rising edge
+            return 1;
+        }
+        else if ((compare >> 16) < prd)
+        {
+            *high = (float64)k * periodPs + (float64)(compare >> 16) * tbclk;
+            if (mep != 0)
+            {
+                *high += (float64)(((((compare >> 8) & 0xFF) * mep) + 0x80) >> 8) * tbclk / mep;
+            }
+            level = 0;
+        }
+    }
+    return 0;
+}
+
+// Every cycle published since the last call against the replayed edges
+static void CheckEcap(void)
+{
+    const volatile ECAP_CHANNEL *status;
+    const volatile ECAP_CHANNEL *reference = &EcapStatus.channel[ECAP_CH_PWM1];
+    Uint64 risePs;
+    Uint32 prd;
+    float64 period;
+    float64 high;
+    float64 phase;
+    float64 error;
+    Uint16 ch;
+
+    for (ch = 0; ch < ECAP_CHANNELS; ch++)
+    {
+        status = &EcapStatus.channel[ch];
+        if (status->cycles == ecapSeen[ch])
+        {
+            continue;
+        }
+        if ((ecapSeen[ch] != 0) && ((status->cycles != ecapSeen[ch] + 1) || (status->rise != ecapNextRise[ch])))
+        {
+            ecapGaps++;                         // Cycles completed between two passes were not measured
+        }
+        ecapSeen[ch] = status->cycles;
+        ecapNextRise[ch] = status->rise + status->period;
+        risePs = HostEcapStampPs(ecapRegs[ch], status->rise);
+
+        // Expected cycle and phase after PWM1A
+        if (ch == ECAP_CH_EXT)
+        {
+            period = (float64)HostExtPwm.periodPs;
+            high = (float64)HostExtPwm.highPs;
+            phase = (float64)(ECAP_EXT_DELAY_PS % ECAP_PWM1_PERIOD_PS);
+        }
+#if CMPSS_MODE == CMPSS_ON
+        else if (CmpssTestHeld(risePs, risePs + (Uint64)status->period * ECAP_CYCLE_PS + ECAP_CYCLE_PS))
+        {
+            ecapUnchecked++;                    // Cut short or held low by an over-current trip
+            continue;
+        }
+#endif
+        else if (EcapPwmCycle((ch == ECAP_CH_PWM1) ? &EPwm1Regs : &EPwm5Regs, risePs, &period, &high) == 0)
+        {
+            ecapUnchecked++;
+            continue;
+        }
+        else if (ch == ECAP_CH_PWM5)
+        {
+            prd = (Uint32)EPwm5Regs.TBPRD + 1;
+            phase = (float64)((prd - EPwm5Regs.TBPHS.bit.TBPHS % prd) % prd) * HostEpwmPeriodPs(&EPwm5Regs) / prd;
+        }
+        else
+        {
+            phase = 0.0;
+        }
+
+        ecapChecks++;
+        if ((fabs((float64)status->period * ECAP_CYCLE_PS - period) > ECAP_CYCLE_PS) ||
+            (fabs((float64)status->high * ECAP_CYCLE_PS - high) > ECAP_CYCLE_PS) ||
+            (fabs(status->duty - (float64)status->high / status->period) > 1e-6) || (status->age != 0))
+        {
+            ecapErrors++;
+        }
+        if ((Uint64)reference->period * ECAP_CYCLE_PS != ECAP_PWM1_PERIOD_PS)
+        {
+            ecapUnchecked++;                    // Phase taken modulo a stretched PWM1A cycle
+            continue;
+        }
+        error = fmod(fabs((float64)status->phase * ECAP_CYCLE_PS - phase), (float64)ECAP_PWM1_PERIOD_PS);
+        error = (error > ECAP_PWM1_PERIOD_PS / 2) ? ECAP_PWM1_PERIOD_PS - error : error;     // Either side of the wrap
+        error = ((Uint64)status->phase * ECAP_CYCLE_PS >= ECAP_PWM1_PERIOD_PS) ? ECAP_PWM1_PERIOD_PS : error;  // Never a period or more
+        ecapPhaseErrorMax = (error > ecapPhaseErrorMax) ? error : ecapPhaseErrorMax;
+        if (error > ECAP_CYCLE_PS)
+        {
+            ecapErrors++;
+        }
+    }
+}
+#endif
+
+// Encoder (SPEED_INPUT_QEP): the host turns an encoder shaft through a speed profile: standstill,
+// a ramp through both method thresholds to 500 rad/s, a reversal to -60 rad/s, two crawls and
+// a stop, starting off an index marker. At QEP_TEST_MISS_SECONDS the counter is made to lose
+// QEP_TEST_MISSED edges. After every sample the position must be exact (off by the lost edges
+// until the next index, which must correct it), the unit-time speed must equal the count over
+// its window, and where the speed has been constant for a few unit periods the capture-timer
+// speed must be within one CAPCLK of it and the method in use must be the one for that speed.
+// At rest the capture-timer speed may not exceed one unit over the time stopped, and must be 0
+// once the capture timer has overflowed.
+// The captured mmSpeed[] entry must be QepStatus.speedScaled.
+#if SPEED_INPUT == SPEED_INPUT_QEP
+// Speed [rad/s] and position [counts] of the test shaft; steady is the time the speed has been constant
+static float64 QepTestProfile(float64 seconds, float64 *position, float64 *steady)
+{
+    const float64 scale = QEP_COUNTS_PER_REV / (2.0 * HOST_PI);
+    float64 accel = 0.0;
+    float64 dt;
+    Uint16 k = 0;
+
+    while ((k + 1 < QEP_TEST_KNOTS) && (qepKnots[k + 1][0] <= seconds))
+    {
+        k++;
+    }
+    if (k + 1 < QEP_TEST_KNOTS)
+    {
+        accel = (qepKnots[k + 1][1] - qepKnots[k][1]) / (qepKnots[k + 1][0] - qepKnots[k][0]);
+    }
+    dt = seconds - qepKnots[k][0];
+    *position = qepKnotPosition[k] + (qepKnots[k][1] * dt + 0.5 * accel * dt * dt) * scale;
+    *steady = (accel == 0.0) ? dt : 0.0;
+    return qepKnots[k][1] + accel * dt;
+}
+
+// HostEncoder position hook
+static float64 QepTestShaft(float64 seconds)
+{
+    float64 position;
+    float64 steady;
+
+    QepTestProfile(seconds, &position, &steady);
+    return position;
+}
+
+// Knot positions of the profile, from QEP_TEST_START
+static void QepTestInit(void)
+{
+    Uint16 k;
+
+    qepKnotPosition[0] = QEP_TEST_START;
+    for (k = 1; k < QEP_TEST_KNOTS; k++)
+    {
+        qepKnotPosition[k] = qepKnotPosition[k - 1] + 0.5 * (qepKnots[k - 1][1] + qepKnots[k][1]) *
+                             (qepKnots[k][0] - qepKnots[k - 1][0]) * QEP_COUNTS_PER_REV / (2.0 * HOST_PI);
+    }
+    HostEncoder.position = QepTestShaft;
+    HostEncoder.indexCounts = QEP_TEST_INDEX;
+    HostEncoder.countsPerRev = QEP_COUNTS_PER_REV;
+}
+
+// QepStatus of this sample against the shaft. The shaft stands still until the counter has
+// started, so the edges counted are those since QEP_TEST_START.
+static void CheckQep(void)
+{
+    const float64 unitScale = 2.0 * HOST_PI / (QEP_COUNTS_PER_REV * (float64)QEP_WINDOW * HostStats.samplePeriod);
+    const float64 capclkSeconds = 1.0 / QEP_CAPCLK_HZ;
+    float64 shaft;
+    float64 steady;
+    float64 speed = QepTestProfile(HostTime(), &shaft, &steady);
+    float64 unitSeconds;                        // Time of QEP_UNIT_COUNTS counts at this speed
+    float64 error;
+    float64 stopTicks;                          // CAPCLK since the shaft stopped
+    float32 published;
+    int64 counted;
+    int64 expected;
+    int64 turns;
+    Uint16 slot;
+
+    qepChecks++;
+    if ((QepStatus.samples != qepSamples + 1) || (QepStatus.method > QEP_METHOD_UNIT))
+    {
+        qepPublishErrors++;
+    }
+    qepSamples = QepStatus.samples;
+    qepMethodSamples[QepStatus.method & 1]++;
+
+    // Lost edges: taken by the emulation at this SOCA, corrected at the next index
+    if ((qepMissState == 1) && (HostEncoder.missed == 0))
+    {
+        qepMissed += QEP_TEST_MISSED;
+        qepMissState = 2;
+    }
+    if ((qepMissState == 2) && (QepStatus.indexErrors == 1))
+    {
+        qepMissState = 3;
+    }
+
+    // Position: edges counted until the first index, then from the first index marker passed
+    counted = (int64)floor(shaft) - (int64)floor(QEP_TEST_START) - qepMissed;
+    if ((QepStatus.homed == 1) && (qepHome == INT64_MIN))
+    {
+        qepHome = (int64)floor(QEP_TEST_INDEX + floor((shaft - QEP_TEST_INDEX) / QEP_COUNTS_PER_REV) * QEP_COUNTS_PER_REV);
+        if (((shaft > qepLastShaft) && ((float64)qepHome + 0.5 <= qepLastShaft)) || (shaft <= qepLastShaft))
+        {
+            qepPositionErrors++;                // Homed on a marker passed before this sample
+        }
+    }
+    if (qepHome == INT64_MIN)
+    {
+        expected = counted;
+    }
+    else
+    {
+        expected = (int64)floor(shaft) - qepHome - ((qepMissState == 2) ? QEP_TEST_MISSED : 0);
+    }
+    turns = (expected >= 0) ? expected / (int64)QEP_COUNTS_PER_REV : -((-expected - 1) / (int64)QEP_COUNTS_PER_REV) - 1;
+    if ((QepStatus.position != expected) || (QepStatus.turns != turns) ||
+        (QepStatus.angle != (Uint32)(expected - turns * (int64)QEP_COUNTS_PER_REV)))
+    {
+        qepPositionErrors++;
+    }
+    qepLastShaft = shaft;
+
+    // Unit time: the count over the last QEP_WINDOW samples
+    slot = QepStatus.samples % QEP_WINDOW;
+    error = fabs(QepStatus.speedUnit - (float64)(counted - qepCounted[slot]) * unitScale);
+    if (error > 1e-5 * fabs(QepStatus.speedUnit) + 1e-4)
+    {
+        qepUnitErrors++;
+    }
+    qepCounted[slot] = counted;
+
+    // Capture timer: one CAPCLK on the unit period once the speed has been constant over a few of them
+    if (speed == 0.0)
+    {
+        stopTicks = floor(steady / capclkSeconds);     // The last unit event came no later than the stop
+        if (((stopTicks > 0xFFFF) && (QepStatus.speedCapture != 0.0f)) ||
+            ((stopTicks >= 1.0) && (fabs(QepStatus.speedCapture) * stopTicks * capclkSeconds >
+                                    (1.0 + 1e-5) * QEP_UNIT_COUNTS * 2.0 * HOST_PI / QEP_COUNTS_PER_REV)) ||
+            ((steady > QEP_WINDOW * HostStats.samplePeriod) && (QepStatus.speedUnit != 0.0f)))
+        {
+            qepCaptureErrors++;
+        }
+    }
+    else
+    {
+        unitSeconds = QEP_UNIT_COUNTS * 2.0 * HOST_PI / (fabs(speed) * QEP_COUNTS_PER_REV);
+        if (steady > 3.0 * unitSeconds + 2.0 * HostStats.samplePeriod)
+        {
+            qepCaptureChecks++;
+            error = fabs(QepStatus.speedCapture - speed) / fabs(speed);
+            qepCaptureErrorMax = (error > qepCaptureErrorMax) ? error : qepCaptureErrorMax;
+            if (error > capclkSeconds / (unitSeconds - capclkSeconds) + 1e-5)
+            {
+                qepCaptureErrors++;
+            }
+        }
+        if (steady > 2.0 * QEP_WINDOW * HostStats.samplePeriod)
+        {
+            if (((fabs(speed) > 1.1 * QEP_SPEED_FAST) && (QepStatus.method != QEP_METHOD_UNIT)) ||
+                ((fabs(speed) < 0.9 * QEP_SPEED_SLOW) && (QepStatus.method != QEP_METHOD_CAPTURE)))
+            {
+                qepMethodErrors++;
+            }
+        }
+    }
+
+    // Published estimate
+    published = (QepStatus.method == QEP_METHOD_UNIT) ? QepStatus.speedUnit : QepStatus.speedCapture;
+    if ((QepStatus.speed != published) ||
+        (QepStatus.speedScaled != ((published * 10.0f >= 32767.0f) ? 32767 :
+                                   (published * 10.0f <= -32767.0f) ? -32767 : (int16)(published * 10.0f))))
+    {
+        qepPublishErrors++;
+    }
+
+    if ((qepMissState == 0) && (HostTime() >= QEP_TEST_MISS_SECONDS))
+    {
+        HostEncoder.missed = QEP_TEST_MISSED;
+        qepMissState = 1;
+    }
+}
+#endif
+
+// Current input (SDFM_ON): the host modulator carries a 37 Hz sine at half full scale with three
+// 500 us over-current pulses: positive at 0.6 s, positive again at 0.7 s while the first trip is
+// still latched, and negative at 1.3 s, after the host has called SdfmFaultClear() at 0.9 s. The
+// ADC-C input of every sample is the SDFM result mapped to a 12-bit code. After every sample
+// SDDATA1 must be the sinc3 of the modulator bits before its newest output, computed by direct
+// convolution, and away from the pulses within a few counts of the current at the delay of the
+// filter. Every comparator flag must rise inside a pulse that can trip, in its
+// direction, at most 4 x SDFM_COMPARATOR_OSR bits after the pulse starts, and SdfmStatus must
+// have latched it by the same sample; the second pulse must not interrupt. The captured
+// maCurrent[] entry is checked against the gain of the data filter.
+#if SDFM_MODE == SDFM_ON
+// HostSdfm input hook: the sine, or a pulse where one is on. The modulator asks for every bit in
+// turn, so the sine is rotated on by one bit and only computed afresh when asked out of turn.
+static float64 SdfmTestCurrent(float64 seconds)
+{
+    static float64 last = -1.0;                 // Time of the last sine
+    static float64 sine;
+    static float64 cosine;
+    const float64 bitSeconds = 1.0 / (float64)SDFM_CLOCK_HZ;
+    float64 rotated;
+    Uint16 k;
+
+    for (k = 0; k < SDFM_TEST_PULSES; k++)
+    {
+        if ((seconds >= sdfmTestPulses[k].start) && (seconds < sdfmTestPulses[k].start + SDFM_TEST_PULSE_SECONDS))
+        {
+            return sdfmTestPulses[k].level;
+        }
+    }
+    if (fabs(seconds - last - bitSeconds) < 1e-3 * bitSeconds)
+    {
+        rotated = sine * sdfmBitCos + cosine * sdfmBitSin;
+        cosine = cosine * sdfmBitCos - sine * sdfmBitSin;
+        sine = rotated;
+    }
+    else
+    {
+        sine = sin(2.0 * HOST_PI * SDFM_TEST_HZ * seconds);
+        cosine = cos(2.0 * HOST_PI * SDFM_TEST_HZ * seconds);
+    }
+    last = seconds;
+    return SDFM_TEST_AMPLITUDE * sine;
+}
+
+// Pulse overlapping first..last [s] once extended by after [s], SDFM_TEST_PULSES = none
+static Uint16 SdfmTestPulse(float64 first, float64 last, float64 after)
+{
+    Uint16 k;
+
+    for (k = 0; k < SDFM_TEST_PULSES; k++)
+    {
+        if ((last >= sdfmTestPulses[k].start) &&
+            (first < sdfmTestPulses[k].start + SDFM_TEST_PULSE_SECONDS + after))
+        {
+            break;
+        }
+    }
+    return k;
+}
+
+// Sinc3 impulse response (a box of SDFM_OSR convolved with itself twice), the data shift and
+// gain the firmware must choose, and the modulator
+static void SdfmTestInit(void)
+{
+    static Uint32 box2[2 * SDFM_OSR - 1];
+    Uint32 span = (Uint32)SDFM_OSR * SDFM_OSR * SDFM_OSR;
+    Uint16 i;
+    Uint16 j;
+
+    for (i = 0; i < 2 * SDFM_OSR - 1; i++)
+    {
+        box2[i] = (i < SDFM_OSR) ? i + 1 : 2 * SDFM_OSR - 1 - i;
+    }
+    for (i = 0; i < 3 * SDFM_OSR - 2; i++)
+    {
+        sdfmWeight[i] = 0;
+        for (j = 0; j < SDFM_OSR; j++)
+        {
+            sdfmWeight[i] += ((i >= j) && (i - j < 2 * SDFM_OSR - 1)) ? box2[i - j] : 0;
+        }
+    }
+    for (sdfmShift = 0; (span >> sdfmShift) > 4096; sdfmShift++)
+    {
+    }
+    sdfmFullScale = 0.5 * (float64)span / (float64)(1UL << sdfmShift);
+    sdfmGain = (float64)SDFM_FULL_SCALE_MA / sdfmFullScale;
+    sdfmTrackTolerance = 3.0 + sdfmFullScale * 16.0 / ((float64)SDFM_OSR * SDFM_OSR);   // Noise falls faster than OSR^2
+
+    sdfmBitSin = sin(2.0 * HOST_PI * SDFM_TEST_HZ / (float64)SDFM_CLOCK_HZ);
+    sdfmBitCos = cos(2.0 * HOST_PI * SDFM_TEST_HZ / (float64)SDFM_CLOCK_HZ);
+    HostSdfm.input = SdfmTestCurrent;
+    HostSdfm.clockHz = SDFM_CLOCK_HZ;
+}
+
+// Data filter result for the output after modulator bit end - 1, from the bits since the filter started
+static int16 SdfmReference(Uint64 end)
+{
+    int64 sum = -(int64)((Uint64)SDFM_OSR * SDFM_OSR * SDFM_OSR / 2);
+    Uint16 j;
+
+    for (j = 0; (j < 3 * SDFM_OSR - 2) && (end >= HostSdfm.dataStart + j + 1); j++)
+    {
+        sum += (int64)sdfmWeight[j] * HostSdfmBit(end - 1 - j);
+    }
+    return (int16)(sum >> sdfmShift);
+}
+
+// SDDATA1 and the comparator trips of this sample against the modulator bits and the pulses;
+// the fault latch is cleared once from here
+static void CheckSdfm(void)
+{
+    const float64 bitSeconds = 1.0 / (float64)SDFM_CLOCK_HZ;
+    Uint64 end = HostSdfm.dataBits;
+    int16 data = (int16)Sdfm1Regs.SDDATA1.bit.DATA16;
+    float64 error;
+    Uint64 latency;
+    Uint32 tripped = 0;
+    Uint16 k;
+
+    sdfmChecks++;
+
+    // Data: the newest output, a decimation period old at most, and the sinc3 of the bits before it
+    if ((end == 0) || (HostSdfm.bits - end > SDFM_OSR) || (data != SdfmReference(end)))
+    {
+        sdfmDataErrors++;
+    }
+
+    // Away from the pulses it follows the current, delayed by half the filter length
+    if ((end >= HostSdfm.dataStart + 3 * SDFM_OSR - 2) &&
+        (SdfmTestPulse((float64)(end - (3 * SDFM_OSR - 2)) * bitSeconds, (float64)end * bitSeconds,
+                       SDFM_TEST_SETTLE_SECONDS) == SDFM_TEST_PULSES))
+    {
+        error = fabs((float64)data -
+                     sdfmFullScale * SdfmTestCurrent(((float64)end - 1.0 - 1.5 * (SDFM_OSR - 1)) * bitSeconds));
+        sdfmTrackErrorMax = (error > sdfmTrackErrorMax) ? error : sdfmTrackErrorMax;
+        sdfmTrackChecks++;
+    }
+
+    // Comparator: once its first outputs are past, a flag may only rise in a pulse that can trip,
+    // in its direction
+    if ((HostSdfm.flagPs != 0) &&
+        ((float64)HostSdfm.flagPs * 1e-12 >= (float64)(HostSdfm.dataStart + 3 * SDFM_COMPARATOR_OSR) * bitSeconds))
+    {
+        k = SdfmTestPulse((float64)HostSdfm.flagPs * 1e-12, (float64)HostSdfm.flagPs * 1e-12, SDFM_TRIP_BITS * bitSeconds);
+        if ((k == SDFM_TEST_PULSES) || (sdfmTestPulses[k].fault == 0) || (HostSdfm.flagRose != sdfmTestPulses[k].fault))
+        {
+            sdfmFlagErrors++;
+        }
+        else if (sdfmTripPs[k] == 0)
+        {
+            sdfmTripPs[k] = HostSdfm.flagPs;
+            latency = HostSdfm.flagPs - (Uint64)(sdfmTestPulses[k].start * 1e12 + 0.5);
+            sdfmTripPsMax = (latency > sdfmTripPsMax) ? latency : sdfmTripPsMax;
+            sdfmFault = sdfmTestPulses[k].fault;
+        }
+    }
+    HostSdfm.flagPs = 0;
+    HostSdfm.flagRose = 0;
+
+    // Firmware: one interrupt per pulse that trips, latched by the time the host sees the flag
+    for (k = 0; k < SDFM_TEST_PULSES; k++)
+    {
+        tripped += (sdfmTripPs[k] != 0);
+    }
+    if ((SdfmStatus.trips != tripped) || (HostStats.sdfmIsrCalls != tripped) || (SdfmStatus.fault != sdfmFault))
+    {
+        sdfmLatchErrors++;
+    }
+
+    if ((sdfmCleared == 0) && (HostTime() >= SDFM_TEST_CLEAR_SECONDS))
+    {
+        SdfmFaultClear();
+        sdfmCleared = 1;
+        sdfmFault = 0;
+        if ((SdfmStatus.fault != 0) || (Sdfm1Regs.SDCPARM1.bit.IEH != 1) || (Sdfm1Regs.SDCPARM1.bit.IEL != 1))
+        {
+            sdfmLatchErrors++;
+        }
+    }
+}
+#endif
+
+// Over-current trip (CMPSS_ON): the comparator input and ADC-C carry the 37 Hz sine, inside the
+// limits, with five pulses on it: a 50 us step to code 4000 at 0.6 s, a second step at 0.64 s
+// while the first trip is still held, an 8 ns glitch to the same level at 0.68 s that the
+// comparator filter must reject, a 50 us step to code 50 at 0.7 s and a 200 us half-sine bump
+// through the high limit at 1.2 s. The host calls CmpssFaultClear() at 0.66, 0.76 and
+// 1.3 s. Every one-shot trip of ePWM1 and ePWM5 must come from a pulse that can trip, at most CMPSS_TRIP_PS after the
+// input first crosses the limit; from then until the clear both must stay tripped with PWM1A
+// low, and after it neither may be. CmpssStatus must latch the direction of every trip with one
+// epwm1_tz_isr call each, and the DAC codes must be those of CMPSS_TRIP_MA. With ECAP_ON the
+// eCAP cycles that a trip cuts short are not checked.
+#if CMPSS_MODE == CMPSS_ON
+// Limits the firmware must set, the time each pulse takes the input past one, and the comparator input
+static void CmpssTestInit(void)
+{
+    const CMPSS_TEST_PULSE *p;
+    float64 jump;
+    float64 x;
+    Uint64 ps;
+    Uint16 k;
+
+    cmpssHighCode = (Uint16)(2048.0 + CMPSS_TRIP_MA / 1.22 + 0.5);
+    cmpssLowCode = (Uint16)(2048.0 - CMPSS_TRIP_MA / 1.22 + 0.5);
+    for (k = 0; k < CMPSS_TEST_PULSES; k++)
+    {
+        p = &cmpssTestPulses[k];
+        for (ps = (Uint64)(p->start * 1e12 + 0.5); ps < (Uint64)((p->start + p->length) * 1e12); ps += CMPSS_TEST_SCAN_PS)
+        {
+            x = CmpssTestInput((float64)ps * 1e-12, &jump);
+            if ((x > (float64)cmpssHighCode) || (x < (float64)cmpssLowCode))
+            {
+                break;
+            }
+        }
+        cmpssCrossPs[k] = ps;
+    }
+    HostCmpss.input = CmpssTestInput;
+}
+
+// Pulse whose crossing is at most CMPSS_TRIP_PS before the given time [ps], CMPSS_TEST_PULSES = none
+static Uint16 CmpssTestPulse(Uint64 ps)
+{
+    Uint16 k;
+
+    for (k = 0; k < CMPSS_TEST_PULSES; k++)
+    {
+        if ((ps >= cmpssCrossPs[k]) && (ps - cmpssCrossPs[k] <= CMPSS_TRIP_PS))
+        {
+            break;
+        }
+    }
+    return k;
+}
+
+// The one-shot trips of this sample against the pulses, the outputs and CmpssStatus; the trips are
+// cleared from here at cmpssTestClears
+static void CheckCmpss(void)
+{
+    Uint64 latency;
+    Uint32 tripped = 0;
+    Uint16 i;
+    Uint16 k;
+
+    cmpssChecks++;
+
+    // Hardware: a trip may only set in a pulse that can trip, on each ePWM once, soon after the crossing
+    for (i = 0; i < HOST_TRIP_EPWMS; i++)
+    {
+        if (HostCmpss.tripPs[i] == cmpssSeenPs[i])
+        {
+            continue;
+        }
+        cmpssSeenPs[i] = HostCmpss.tripPs[i];
+        k = CmpssTestPulse(HostCmpss.tripPs[i]);
+        if ((k == CMPSS_TEST_PULSES) || (cmpssTestPulses[k].fault == 0) || (cmpssTripPs[k][i] != 0))
+        {
+            cmpssTripErrors++;
+            continue;
+        }
+        cmpssTripPs[k][i] = HostCmpss.tripPs[i];
+        latency = HostCmpss.tripPs[i] - cmpssCrossPs[k];
+        cmpssTripPsMax = (latency > cmpssTripPsMax) ? latency : cmpssTripPsMax;
+        cmpssFault |= cmpssTestPulses[k].fault;
+        cmpssHeld = 1;
+    }
+
+    // Outputs: both one-shot trips set and PWM1A low until the clear, neither after it
+    if (cmpssHeld == 1)
+    {
+        cmpssHeldSamples++;
+        if ((EPwm1Regs.TZFLG.bit.OST != 1) || (EPwm5Regs.TZFLG.bit.OST != 1) || (GpioDataRegs.GPADAT.bit.GPIO0 != 0))
+        {
+            cmpssOutputErrors++;
+        }
+    }
+    else if ((EPwm1Regs.TZFLG.bit.OST != 0) || (EPwm5Regs.TZFLG.bit.OST != 0))
+    {
+        cmpssOutputErrors++;
+    }
+
+    // Firmware: one interrupt per trip, the direction latched and both ePWMs seen tripped
+    for (k = 0; k < CMPSS_TEST_PULSES; k++)
+    {
+        tripped += (cmpssTripPs[k][0] != 0);
+    }
+    if ((CmpssStatus.trips != tripped) || (HostStats.tzIsrCalls != tripped) || (CmpssStatus.fault != cmpssFault) ||
+        (CmpssStatus.tripped != ((cmpssHeld == 1) ? (CMPSS_TRIPPED_EPWM1 | CMPSS_TRIPPED_EPWM5) : 0)))
+    {
+        cmpssLatchErrors++;
+    }
+
+    if ((cmpssClears < CMPSS_TEST_CLEARS) && (HostTime() >= cmpssTestClears[cmpssClears]))
+    {
+        CmpssFaultClear();
+        cmpssClears++;
+        cmpssFault = 0;
+        cmpssHeld = 0;
+        if ((CmpssStatus.fault != 0) || (CmpssStatus.tripped != 0))
+        {
+            cmpssLatchErrors++;
+        }
+    }
+}
+#endif
+
+// SDRAM store (SDRAM_ON, ADC_CAPTURE_DMA): the inputs of every sample are kept, and after
+// every ADCAINT1 DMA trigger the host drives the store: a ring capture of 8000 samples from
+// early in the run, stopped at a quarter after wrapping several times, then a 40000-sample
+// fill capture. Recording must refuse readbacks; once stopped, each capture is read back
+// through DMA CH6 in pieces and every frame must hold the inputs of its sample. Every
+// completed DMA block must reach the store and no move may be late.
+#if SDRAM_MODE == SDRAM_ON
+// Start a capture from the host with the given settings
+static void SdramTestStart(Uint16 mode, Uint32 depth)
+{
+    SdramConfig.mode = mode;
+    SdramConfig.depth = depth;
+    sdramRefusals += (SdramStoreStart() == 0);
+}
+
+// Compare the frames of the finished readback with the inputs of their samples
+static void SdramCheckFrames(void)
+{
+    Uint32 sample = SdramStatus.firstSample + sdramReadSample;
+    Uint16 i;
+
+    for (i = 0; i < sdramReadCount; i++)
+    {
+#if SDFM_MODE == SDFM_ON
+        sdramFrames[i][2] = SdfmTestCode(sdramFrames[i][2]);   // The store keeps the raw SDFM result
+#endif
+        if ((sample + i >= sampleInputCount) ||
+            (memcmp(sdramFrames[i], sampleInputs[sample + i], sizeof(sdramFrames[0])) != 0))
+        {
+            sdramMismatches++;
+        }
+    }
+    sdramFramesRead += sdramReadCount;
+    sdramReadSample += sdramReadCount;
+    sdramReadCount = 0;
+}
+
+// After every ADCAINT1 DMA trigger: run a ring capture, read it back, then a fill capture and
+// read it back, one readback of up to SDRAM_READ_FRAMES per sample
+static void SdramCheckTrigger(Uint16 persel)
+{
+    Uint32 sample = (Uint32)(HostStats.socaEvents - 1);
+    Uint32 rounded;
+
+    if (persel != DMA_ADCAINT1)
+    {
+        return;
+    }
+    switch (sdramPhase)
+    {
+    case SDRAM_PHASE_IDLE:
+        if (sample == SDRAM_RING_SAMPLE)
+        {
+            SdramTestStart(SDRAM_STORE_RING, SDRAM_RING_DEPTH);
+            sdramPhase = SDRAM_PHASE_RING;
+        }
+        break;
+
+    case SDRAM_PHASE_RING:
+        sdramRefusals += (SdramStoreRead(0, SDRAM_READ_FRAMES, sdramFrames) != 0);   // Must wait for the stop
+        if (sample == sdramStopSample)
+        {
+            SdramStoreStop();
+            sdramPhase = SDRAM_PHASE_READ;
+        }
+        break;
+
+    case SDRAM_PHASE_FILL:
+        if ((SdramStatus.mode == SDRAM_STORE_OFF) && (SdramStatus.startRequest == 0))
+        {
+            sdramPhase = SDRAM_PHASE_READ;
+        }
+        break;
+
+    case SDRAM_PHASE_READ:
+        if ((SdramStatus.mode != SDRAM_STORE_OFF) || (SdramStatus.stopRequest != 0) || (SdramStoreReadBusy() != 0))
+        {
+            break;
+        }
+        if (sdramReadCount != 0)
+        {
+            SdramCheckFrames();
+        }
+        if (sdramReadSample < SdramStatus.stored)
+        {
+            sdramReadCount = SdramStoreRead(sdramReadSample, SDRAM_READ_FRAMES, sdramFrames);
+            sdramRefusals += (sdramReadCount == 0);
+            break;
+        }
+
+        // The whole capture is back: it must have kept its depth rounded up to whole blocks
+        rounded = (sdramCaptures == 0) ? SDRAM_RING_DEPTH : SDRAM_FILL_DEPTH;
+        rounded = (rounded + DMA_CAPTURE_HALF_SIZE - 1) / DMA_CAPTURE_HALF_SIZE * DMA_CAPTURE_HALF_SIZE;
+        sdramDepthErrors += (SdramStatus.depth != rounded) || (SdramStatus.stored != rounded) ||
+                            (sdramReadSample != rounded) || (SdramStatus.firstSample % DMA_CAPTURE_HALF_SIZE != 0);
+        sdramReadSample = 0;
+        if (++sdramCaptures == 1)
+        {
+            SdramTestStart(SDRAM_STORE_FILL, SDRAM_FILL_DEPTH);
+            sdramPhase = SDRAM_PHASE_FILL;
+        }
+        else
+        {
+            sdramPhase = SDRAM_PHASE_DONE;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+#endif
+
+static void CheckSample(Uint32 sample, const Uint16 adc[HOST_ADC_CHANNELS]);
+
+// DMA capture (ADC_CAPTURE_DMA): the inputs of every sample are kept, and when dmach4_isr has
+// handed a block to ProcessCaptureBlock() the same checks run on each of its samples in order.
+// The DACs must hold the newest sample of the block, converted one ePWM2 period before the
+// trigger, and the captured entries must be the first ones of the block the trigger engine
+// stored. Before that, the half handed over must hold the results of exactly those samples,
+// from the first block on. The checks on the peripherals (PWM, eCAP, SDFM, CMPSS, CPU2)
+// run after every ADCAINT1 DMA trigger instead. Every block must be handed over, with no overrun, and with
+// SDFM_ON no SDDATA1 read may be refused for want of SECMSEL.PF2SEL. The dmach4_isr profile
+// must count every call but the first, at the modelled latency, with no deadline overruns.
+#if ADC_CAPTURE_MODE == ADC_CAPTURE_DMA
+// dmach4_isr has just handed a block to ProcessCaptureBlock(): the samples of the half completed
+// before this trigger. Replay CheckSample() over them in order.
+static void CheckDmaBlock(void)
+{
+    Uint32 first = (Uint32)(HostStats.socaEvents - 1) - DMA_CAPTURE_HALF_SIZE;
+    Uint16 offset = (Uint16)((first / DMA_CAPTURE_HALF_SIZE) & 1) * DMA_CAPTURE_HALF_SIZE;  // Transfers alternate from half 0
+    Uint16 word;
+    Uint16 i;
+    Uint16 ch;
+
+    dmaBlocksChecked = dmaBlockCount;
+    dmaStored = (resultsIndex + RESULTS_BUFFER_SIZE - lastResultsIndex) % RESULTS_BUFFER_SIZE;
+    if (first + DMA_CAPTURE_HALF_SIZE > sampleInputCount)
+    {
+        dmaBlockMismatches++;
+        return;
+    }
+    for (i = 0; i < DMA_CAPTURE_HALF_SIZE; i++)
+    {
+        // The half just handed over must still hold this block, the first one included
+        for (ch = 0; ch < DMA_CAPTURE_CHANNELS; ch++)
+        {
+            word = DmaCaptureBuffer[ch][offset + i];
+#if SDFM_MODE == SDFM_ON
+            word = (ch == DMA_CAPTURE_ADCC) ? SdfmCurrentCode((int16)word) : word;     // CH3 moves the data filter result
+#endif
+            dmaContentErrors += (word != sampleInputs[first + i][ch]);
+        }
+        CheckSample(first + i, sampleInputs[first + i]);
+    }
+    if (dmaStored != 0)
+    {
+        captureMismatches++;                    // The block stored more than it had
+    }
+    lastResultsIndex = resultsIndex;
+}
+#endif
+
+// After every DMA trigger: the checks that run without adca1_isr
+static void CheckDmaTrigger(Uint16 persel)
+{
+#if ADC_CAPTURE_MODE == ADC_CAPTURE_DMA
+    if ((persel == DMA_ADCAINT1) && (dmaBlockCount != dmaBlocksChecked))
+    {
+        CheckDmaBlock();
+    }
+#endif
+#if DAC_SOURCE == DAC_SOURCE_PLAYBACK
+    CheckPlaybackTrigger(persel);
+#endif
+#if SDRAM_MODE == SDRAM_ON
+    SdramCheckTrigger(persel);
+#endif
+#if (CPU2_MODE == CPU2_ON) && (ADC_CAPTURE_MODE == ADC_CAPTURE_DMA)
+    if (persel == DMA_ADCAINT1)
+    {
+        HostCpu2();                             // CPU2 keeps polling on every sample
+    }
+#endif
+#if (PWM_OUTPUT_MODE != PWM_OUTPUT_FIXED) && (ADC_CAPTURE_MODE == ADC_CAPTURE_DMA)
+    if (persel == DMA_ADCAINT1)
+    {
+        CheckPwmOutput(NULL);                   // The command changes once per block
+    }
+#endif
+#if (ECAP_MODE == ECAP_ON) && (ADC_CAPTURE_MODE == ADC_CAPTURE_DMA)
+    if (persel == DMA_ADCAINT1)
+    {
+        CheckEcap();
+    }
+#endif
+#if (SDFM_MODE == SDFM_ON) && (ADC_CAPTURE_MODE == ADC_CAPTURE_DMA)
+    if (persel == DMA_ADCAINT1)
+    {
+        CheckSdfm();
+    }
+#endif
+#if (CMPSS_MODE == CMPSS_ON) && (ADC_CAPTURE_MODE == ADC_CAPTURE_DMA)
+    if (persel == DMA_ADCAINT1)
+    {
+        CheckCmpss();
+    }
+#endif
+    (void)persel;
+}
+
+static void CheckSample(Uint32 sample, const Uint16 adc[HOST_ADC_CHANNELS])
+{
+#if ADC_CAPTURE_MODE != ADC_CAPTURE_CLA
+    Uint16 index;
+#endif
+    Uint16 expected[HOST_ADC_CHANNELS];     // What the DACs and the capture must have seen
+    Uint16 ch;
+
+    for (ch = 0; ch < HOST_ADC_CHANNELS; ch++)
+    {
+#if FILTER_MODE == FILTER_ON
+        expected[ch] = FilterReferenceRun(&filterRef[ch], adc[ch]);
+#else
+        expected[ch] = adc[ch];
+#endif
+    }
+
+#if DAC_UPDATE_MODE == DAC_UPDATE_SAMPLE
+#if DAC_SOURCE == DAC_SOURCE_MODEL
+    CheckMotorSample(expected);
+#elif DAC_SOURCE == DAC_SOURCE_DDS
+    CheckDdsSample(sample);
+#elif DAC_SOURCE == DAC_SOURCE_ADC
+    if (((ADC_CAPTURE_MODE != ADC_CAPTURE_DMA) || (sample % DMA_CAPTURE_HALF_SIZE == DMA_CAPTURE_HALF_SIZE - 1)) &&
+        ((DacaRegs.DACVALS.all != expected[3]) || (DacbRegs.DACVALS.all != expected[1])))
+    {
+        dacMismatches++;                    // With ADC_CAPTURE_DMA the DACs hold the newest sample of the block
+    }
+#endif
+#if ADC_CAPTURE_MODE == ADC_CAPTURE_CLA
+    if (ClaStatus.dacLatency != HOST_ADC_LATENCY_TICKS)
+#elif DAC_SOURCE == DAC_SOURCE_PLAYBACK
+    if (dacLatency != 0)                    // The ISR does not write the DACs
+#elif ADC_CAPTURE_MODE == ADC_CAPTURE_DMA
+    if (dacLatency != HOST_ADC_LATENCY_TICKS + ADC_SAMPLE_PERIOD + 1)  // Converted one ePWM2 period before the trigger
+#else
+    if (dacLatency != HOST_ADC_LATENCY_TICKS)
+#endif
+    {
+        latencyMismatches++;
+    }
+#endif
+#if DAC_SOURCE == DAC_SOURCE_PLAYBACK
+    if (sample == PLAYBACK_LOOP_SAMPLE)
+    {
+        PlaybackTestStart(PLAYBACK_LOOP, PLAYBACK_LOOP_FRAMES, PLAYBACK_LOOP_HZ);
+    }
+    else if (sample == playbackOnceSample)
+    {
+        PlaybackTestStart(PLAYBACK_ONCE, PLAYBACK_ONCE_FRAMES, PLAYBACK_ONCE_HZ);
+    }
+    else if (sample == playbackStreamSample)
+    {
+        playbackOnceIsrCalls = HostStats.dmaChIsrCalls[PLAYBACK_DMA_CH];
+        playbackOnceEnded = (PlaybackStatus.mode == PLAYBACK_OFF) && (PlaybackStatus.completed == 1) &&
+                            (EPwm6Regs.ETSEL.bit.SOCAEN == 0) &&
+                            (DacaRegs.DACVALS.all == PlaybackPattern(PLAYBACK_ONCE_FRAMES - 1, PLAYBACK_DAC_A)) &&
+                            (DacbRegs.DACVALS.all == PlaybackPattern(PLAYBACK_ONCE_FRAMES - 1, PLAYBACK_DAC_B));
+        PlaybackTestStart(PLAYBACK_STREAM, 0, PLAYBACK_STREAM_HZ);
+    }
+#endif
+
+    // The hardware state belongs to the present; with ADC_CAPTURE_DMA CheckDmaTrigger() checks it
+#if (PWM_OUTPUT_MODE != PWM_OUTPUT_FIXED) && (ADC_CAPTURE_MODE == ADC_CAPTURE_ISR)
+    CheckPwmOutput(&expected[1]);
+#elif (PWM_OUTPUT_MODE != PWM_OUTPUT_FIXED) && (ADC_CAPTURE_MODE == ADC_CAPTURE_CLA)
+    CheckPwmOutput(NULL);                       // The command changes once per drain
+#endif
+#if (ECAP_MODE == ECAP_ON) && (ADC_CAPTURE_MODE != ADC_CAPTURE_DMA)
+    CheckEcap();
+#endif
+#if SPEED_INPUT == SPEED_INPUT_QEP
+    CheckQep();
+#endif
+#if (SDFM_MODE == SDFM_ON) && (ADC_CAPTURE_MODE != ADC_CAPTURE_DMA)
+    CheckSdfm();
+#endif
+#if (CMPSS_MODE == CMPSS_ON) && (ADC_CAPTURE_MODE != ADC_CAPTURE_DMA)
+    CheckCmpss();
+#endif
+#if ADC_CAPTURE_MODE == ADC_CAPTURE_CLA
+    CheckClaSample(adc, expected);
+#else
+
+#if ADC_CAPTURE_MODE == ADC_CAPTURE_DMA
+    // The block stored its first dmaStored samples, from where the previous block left resultsIndex
+    if (dmaStored != 0)
+    {
+        dmaStored--;
+        index = lastResultsIndex;
+        lastResultsIndex = (index + 1 == RESULTS_BUFFER_SIZE) ? 0 : index + 1;
+#else
+    // A sample was captured if resultsIndex moved forward or wrapped at the end of the buffer
+    if ((resultsIndex != lastResultsIndex) && ((resultsIndex == lastResultsIndex + 1) || (resultsIndex == 0)))
+    {
+        index = lastResultsIndex;
+#endif
+        captureCount++;
+#if SPEED_INPUT == SPEED_INPUT_QEP
+        if ((mmSpeed[index] != QepStatus.speedScaled) || !CaptureMatches(maCurrent[index], expected[2], TEST_CURRENT_GAIN))
+#else
+        if (!CaptureMatches(mmSpeed[index], expected[0], 2.93) || !CaptureMatches(maCurrent[index], expected[2], TEST_CURRENT_GAIN))
+#endif
+        {
+            captureMismatches++;
+        }
+    }
+#if ADC_CAPTURE_MODE != ADC_CAPTURE_DMA
+    lastResultsIndex = resultsIndex;
+#endif
+#endif
+
+#if (CPU2_MODE == CPU2_ON) && (ADC_CAPTURE_MODE != ADC_CAPTURE_DMA)
+    HostCpu2();
+#endif
+
+#if FILTER_MODE == FILTER_ON
+    if (sample == filterLoadSample)
+    {
+        for (ch = 0; ch < FILTER_CHANNELS; ch++)
+        {
+            FilterConfig[ch] = filterTestSets[0];
+            if (FilterLoad(ch) == 0)
+            {
+                filterLoadFailures++;
+            }
+            FilterReferenceLoad(&filterRef[ch], &filterTestSets[0]);    // Taken at the next sample, as by the firmware
+        }
+    }
+#endif
+
+    if (sample == 1000)
+    {
+        static const Uint16 command[TEST_SCI_BYTES] = {0x00, 0x01, 0x7F, 0x80, 0xA5, 0x5A, 0xFE, 0xFF};
+
+        sciSent = HostSciSend(command, TEST_SCI_BYTES);
+    }
+
+    // Act as the reader of the default captures: take each held one, let GPIO0 fire on, then re-arm
+    if ((sample < triggerSwitchSample) && (heldSample == 0) && (TriggerStatus.state == TRIG_STATE_HELD) &&
+        (TriggerStatus.armRequest == 0))
+    {
+        memcpy(heldSpeed, mmSpeed, sizeof(heldSpeed));
+        memcpy(heldCurrent, maCurrent, sizeof(heldCurrent));
+        heldStatus = TriggerStatus;
+        heldSample = sample;
+        heldGpio0 = GpioDataRegs.GPADAT.bit.GPIO0;
+        heldFirstTrigger = heldTriggers;
+    }
+    else if (heldSample != 0)
+    {
+        heldTriggers += (heldGpio0 == 0) && (GpioDataRegs.GPADAT.bit.GPIO0 != 0);
+        heldGpio0 = GpioDataRegs.GPADAT.bit.GPIO0;
+        if (((sample - heldSample >= TEST_HOLD_SAMPLES) && (heldTriggers != heldFirstTrigger)) ||
+            (sample == triggerSwitchSample))
+        {
+            heldChecks++;
+            if ((memcmp(heldSpeed, mmSpeed, sizeof(heldSpeed)) != 0) ||
+                (memcmp(heldCurrent, maCurrent, sizeof(heldCurrent)) != 0) ||
+                (TriggerStatus.state != TRIG_STATE_HELD) || (TriggerStatus.captures != heldStatus.captures) ||
+                (TriggerStatus.startIndex != heldStatus.startIndex) || (TriggerStatus.triggerIndex != heldStatus.triggerIndex))
+            {
+                heldOverwrites++;
+            }
+            heldSample = 0;
+            TriggerArm();
+        }
+    }
+
+    if (sample == triggerSwitchSample)
+    {
+        defaultCaptures = TriggerStatus.captures;
+        TriggerConfig.source = TRIG_SRC_ADCA;
+        TriggerConfig.type = TRIG_TYPE_RISING;
+        TriggerConfig.mode = TRIG_MODE_SINGLE;
+        TriggerConfig.level = 2048;
+        TriggerConfig.hysteresis = 0;
+        TriggerConfig.preTrigger = TEST_PRETRIGGER;
+        TriggerArm();
+    }
+}
+
+// Trigger engine: the default GPIO0 trigger must complete captures during the first half
+// of the run. The host reads each one as it is held: once TEST_HOLD_SAMPLES have passed and
+// GPIO0 has risen again, the buffers and TriggerStatus must be unchanged before the host
+// re-arms. At the midpoint the trigger is switched to a single-shot rising edge of
+// ADC-A through mid-scale with a pre-trigger history; the final capture must stop with
+// the crossing at triggerIndex and startIndex preTrigger samples before it.
+//
+// The single-shot capture must have stopped around a rising mid-scale crossing of ADC-A
+static Uint16 SingleCaptureValid(void)
+{
+    Uint16 trig = TriggerStatus.triggerIndex;
+    Uint16 before = (trig == 0) ? RESULTS_BUFFER_SIZE - 1 : trig - 1;
+    Uint16 start = (trig >= TEST_PRETRIGGER) ? trig - TEST_PRETRIGGER : trig + RESULTS_BUFFER_SIZE - TEST_PRETRIGGER;
+
+#if (FILTER_MODE == FILTER_ON) || (SPEED_INPUT == SPEED_INPUT_QEP)
+    (void)before;                           // The captured values lag the raw crossing by the filter delay,
+                                            // or are the encoder speed and not ADC-A
+    return (TriggerStatus.state == TRIG_STATE_DONE) && (TriggerStatus.startIndex == start);
+#else
+    return (TriggerStatus.state == TRIG_STATE_DONE) && (TriggerStatus.startIndex == start) &&
+           (mmSpeed[trig] >= 0) && (mmSpeed[before] < 0);
+#endif
+}
+
+// Filter bank: before the run the firmware FilterBankRun() and the plain reference in
+// filter_reference.c filter the same noisy inputs, switching between several coefficient
+// sets on the way; every output must be bit-exact, and both report ns per sample.
+// With FILTER_ON the reference also runs on the live inputs: the DACs and the captured
+// values must match it, and at a quarter of the run a 4th-order + 8-tap FIR set is
+// loaded with FilterLoad() on every channel.
+//
+// Run FilterBankRun() and the reference on the same noisy inputs, loading a new set on every
+// channel every FILTER_TEST_SAMPLES / FILTER_TEST_SETS samples. Returns the number of failures.
+static int FilterBitExact(void)
+{
+    static Uint16 input[FILTER_TEST_SAMPLES][FILTER_CHANNELS];
+    static Uint16 output[FILTER_TEST_SAMPLES][FILTER_CHANNELS];
+    static float32 value[FILTER_TEST_SAMPLES][FILTER_CHANNELS];
+    FILTER_REFERENCE ref[FILTER_CHANNELS];
+    Uint32 noise = 12345;
+    Uint64 mismatches = 0;
+    Uint64 refused = 0;
+    Uint64 start;
+    float64 firmwareNs;
+    float64 referenceNs;
+    Uint32 n;
+    Uint16 ch;
+    Uint16 out;
+    Uint16 set;
+    float64 v;
+
+    // Sines on a 2048 offset with uniform noise, plus steps to full scale on ADC-D
+    for (n = 0; n < FILTER_TEST_SAMPLES; n++)
+    {
+        for (ch = 0; ch < FILTER_CHANNELS; ch++)
+        {
+            noise = noise * 1664525UL + 1013904223UL;
+            v = 2048.0 + 1500.0 * sin(2.0 * HOST_PI * (ch + 1) * 50.0 * n / 50000.0) + (float64)(noise >> 24) - 128.0;
+            if ((ch == 3) && ((n / 997) & 1))
+            {
+                v = ((n / 1994) & 1) ? 4095.0 : 0.0;
+            }
+            input[n][ch] = (Uint16)((v < 0.0) ? 0.0 : (v > 4095.0) ? 4095.0 : v);
+        }
+    }
+
+    FilterInit();
+    start = HostWallNs();
+    for (n = 0; n < FILTER_TEST_SAMPLES; n++)
+    {
+        if ((n % (FILTER_TEST_SAMPLES / FILTER_TEST_SETS)) == FILTER_TEST_SAMPLES / FILTER_TEST_SETS / 2)
+        {
+            set = (Uint16)(n / (FILTER_TEST_SAMPLES / FILTER_TEST_SETS));
+            for (ch = 0; ch < FILTER_CHANNELS; ch++)
+            {
+                FilterConfig[ch] = filterTestSets[set];
+                refused += (FilterLoad(ch) == 0);
+            }
+        }
+        FilterBankRun(input[n], output[n]);
+        for (ch = 0; ch < FILTER_CHANNELS; ch++)
+        {
+            value[n][ch] = FilterBank.channel[ch].output;
+        }
+    }
+    firmwareNs = (float64)(HostWallNs() - start) / FILTER_TEST_SAMPLES;
+
+    FilterInit();                           // Only for its default coefficients
+    for (ch = 0; ch < FILTER_CHANNELS; ch++)
+    {
+        FilterReferenceInit(&ref[ch], &FilterBank.channel[ch].coeffs);
+    }
+    start = HostWallNs();
+    for (n = 0; n < FILTER_TEST_SAMPLES; n++)
+    {
+        if ((n % (FILTER_TEST_SAMPLES / FILTER_TEST_SETS)) == FILTER_TEST_SAMPLES / FILTER_TEST_SETS / 2)
+        {
+            set = (Uint16)(n / (FILTER_TEST_SAMPLES / FILTER_TEST_SETS));
+            for (ch = 0; ch < FILTER_CHANNELS; ch++)
+            {
+                FilterReferenceLoad(&ref[ch], &filterTestSets[set]);
+            }
+        }
+        for (ch = 0; ch < FILTER_CHANNELS; ch++)
+        {
+            out = FilterReferenceRun(&ref[ch], input[n][ch]);
+            if ((out != output[n][ch]) || (memcmp(&ref[ch].output, &value[n][ch], sizeof(float32)) != 0))
+            {
+                mismatches++;
+            }
+        }
+    }
+    referenceNs = (float64)(HostWallNs() - start) / FILTER_TEST_SAMPLES;
+
+    printf("filter bank           : %u samples x %u channels, %u coefficient sets, %llu not bit-exact, %llu loads refused, "
+           "%.1f ns/sample (reference %.1f ns/sample)\n",
+           FILTER_TEST_SAMPLES, FILTER_CHANNELS, FILTER_TEST_SETS, (unsigned long long)mismatches,
+           (unsigned long long)refused, firmwareNs, referenceNs);
+    FilterInit();
+    if ((mismatches != 0) || (refused != 0) || (FilterBank.loads != 0))
+    {
+        printf("FAIL: filter bank differs from the reference\n");
+        return 1;
+    }
+    return 0;
+}
+
+// Step each integrator from rest with constant inputs against MotorReferenceStep() at
+// 1/MOTOR_REF_SUBSTEPS of the step. Returns the number of failures.
+static int MotorSelfTest(void)
+{
+    static const char *const name[3] = {"Euler", "RK2", "RK4"};
+    static const float64 speedLimit[3] = {5.0e-2, 1.0e-3, 2.0e-4};       // [rad/s]
+    static const float64 currentLimit[3] = {1.0e-1, 2.0e-3, 1.0e-5};     // [A]
+    static float32 speed[MOTOR_TEST_STEPS];
+    static float32 current[MOTOR_TEST_STEPS];
+    float32 dt = (float32)(ADC_SAMPLE_PERIOD + 1) * 1.0e-8f;
+    MOTOR_REFERENCE ref;
+    float64 speedError[3];
+    float64 currentError[3];
+    float64 stepNs[3];
+    float64 v, tl, wSteady, iSteady;
+    Uint64 start;
+    Uint32 n;
+    Uint16 k;
+    int failures = 0;
+
+    for (k = MOTOR_EULER; k <= MOTOR_RK4; k++)
+    {
+        MotorInit(dt);
+        MotorConfig.integrator = k;
+        start = HostWallNs();
+        for (n = 0; n < MOTOR_TEST_STEPS; n++)
+        {
+            MotorStep(MOTOR_TEST_DUTY, MOTOR_TEST_TORQUE);
+            speed[n] = MotorState.speed;
+            current[n] = MotorState.current;
+        }
+        stepNs[k] = (float64)(HostWallNs() - start) / MOTOR_TEST_STEPS;
+
+        ref.i = 0.0;
+        ref.w = 0.0;
+        speedError[k] = 0.0;
+        currentError[k] = 0.0;
+        for (n = 0; n < MOTOR_TEST_STEPS; n++)
+        {
+            MotorReferenceStep(&ref, MOTOR_TEST_DUTY, MOTOR_TEST_TORQUE, (float64)dt, MOTOR_REF_SUBSTEPS);
+            speedError[k] = fmax(speedError[k], fabs((float64)speed[n] - ref.w));
+            currentError[k] = fmax(currentError[k], fabs((float64)current[n] - ref.i));
+        }
+
+        // Forward motion, so Coulomb friction adds Tc to the load
+        v = 2.442e-4 * MOTOR_TEST_DUTY * (float64)MotorParams.vdc;
+        tl = 0.977e-4 * (MOTOR_TEST_TORQUE - 2048) + (float64)MotorParams.tc;
+        wSteady = ((float64)MotorParams.kt * v - (float64)MotorParams.r * tl) /
+                  ((float64)MotorParams.kt * (float64)MotorParams.ke + (float64)MotorParams.r * (float64)MotorParams.b);
+        iSteady = (v - (float64)MotorParams.ke * wSteady) / (float64)MotorParams.r;
+
+        printf("motor model %-5s     : %u steps, max error %.2e rad/s %.2e A, steady %.2f rad/s %.4f A "
+               "(analytic %.2f rad/s %.4f A), %.1f ns/step\n",
+               name[k], MOTOR_TEST_STEPS, speedError[k], currentError[k], MotorState.speed, MotorState.current,
+               wSteady, iSteady, stepNs[k]);
+        if ((speedError[k] > speedLimit[k]) || (currentError[k] > currentLimit[k]) ||
+            (fabs((float64)MotorState.speed - wSteady) > 1.0e-3 * wSteady) ||
+            (fabs((float64)MotorState.current - iSteady) > 1.0e-3 * iSteady + 1.0e-4))
+        {
+            printf("FAIL: motor model %s integrator differs from the reference\n", name[k]);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+// Generate tones and chirps with DdsRun() and compare them with double-precision references.
+// Returns the number of failures.
+static int DdsSelfTest(void)
+{
+    // Fixed tones: one on DAC-A, two summed on DAC-B, DAC-C off
+    static const DDS_TONE_CONFIG tones[3] =
+    {
+        {DDS_DAC_A, DDS_SWEEP_OFF, DDS_END_HOLD, 2000.0f, 1000.0f, 0.0f, 0.0f},
+        {DDS_DAC_B, DDS_SWEEP_OFF, DDS_END_HOLD, 1000.0f, 1234.5f, 0.0f, 0.0f},
+        {DDS_DAC_B, DDS_SWEEP_OFF, DDS_END_HOLD, 900.0f, 7000.0f, 0.0f, 0.0f},
+    };
+    // Chirps: log 10 Hz..20 kHz in 1 s on DAC-A, held; linear 20 kHz..100 Hz in 0.35 s on DAC-B, repeated
+    static const DDS_TONE_CONFIG chirps[2] =
+    {
+        {DDS_DAC_A, DDS_SWEEP_LOG, DDS_END_HOLD, 1500.0f, 10.0f, 20000.0f, 1.0f},
+        {DDS_DAC_B, DDS_SWEEP_LINEAR, DDS_END_REPEAT, 1500.0f, 20000.0f, 100.0f, 0.35f},
+    };
+    static Uint16 out[DDS_TEST_SAMPLES][DDS_DACS];
+    static Uint32 step[DDS_TEST_SAMPLES + 1][2];    // Phase step each chirp used in each sample
+    float64 expected[DDS_DACS];
+    float64 toneError = 0.0;
+    float64 chirpError = 0.0;
+    float64 sweepError = 0.0;
+    float64 f[2];
+    float64 last[2];
+    float64 rate[2];
+    float64 tonesNs;
+    float64 chirpsNs;
+    Uint32 phase[2] = {0, 0};
+    Uint32 n;
+    Uint64 start;
+    Uint16 refused = 0;
+    Uint16 t;
+    int failures = 0;
+
+    // Fixed tones against the exact phase n * step
+    DdsInit(DDS_TEST_HZ);
+    for (t = 0; t < 3; t++)
+    {
+        DdsConfig[t] = tones[t];
+        refused += (DdsLoad(t) == 0);
+    }
+    refused += (DdsLoad(0) != 0);                   // Not taken yet: must be refused
+    start = HostWallNs();
+    for (n = 0; n < DDS_TEST_SAMPLES; n++)
+    {
+        DdsRun(out[n]);
+    }
+    tonesNs = (float64)(HostWallNs() - start) / DDS_TEST_SAMPLES;
+    for (n = 0; n < DDS_TEST_SAMPLES; n++)
+    {
+        expected[DDS_DAC_A] = DDS_DAC_MID;
+        expected[DDS_DAC_B] = DDS_DAC_MID;
+        expected[DDS_DAC_C] = DDS_DAC_MID;
+        for (t = 0; t < 3; t++)
+        {
+            expected[tones[t].dac] += DdsReference(tones[t].amplitude, (float64)(Uint32)(n * Dds.tone[t].step) / 4294967296.0);
+        }
+        for (t = 0; t < DDS_DACS; t++)
+        {
+            toneError = fmax(toneError, fabs((float64)out[n][t] - expected[t]));
+        }
+    }
+
+    // Chirps: the waveform against the steps the generators took, the steps against the sweep law
+    DdsInit(DDS_TEST_HZ);
+    DdsConfig[2] = tones[0];
+    DdsConfig[2].amplitude = (float32)(DDS_AMPLITUDE_MAX + 1);
+    refused += (DdsLoad(2) != 0);                   // Amplitude out of range: must be refused
+    for (t = 0; t < 2; t++)
+    {
+        DdsConfig[t] = chirps[t];
+        refused += (DdsLoad(t) == 0);
+        step[0][t] = Dds.next[t].step;
+        f[t] = (float64)Dds.next[t].first;
+        last[t] = (float64)Dds.next[t].last;
+    }
+    rate[0] = exp(log(last[0] / f[0]) / (chirps[0].seconds * DDS_TEST_HZ)) - 1.0;
+    rate[1] = (last[1] - f[1]) / (chirps[1].seconds * DDS_TEST_HZ);
+    start = HostWallNs();
+    for (n = 0; n < DDS_TEST_SAMPLES; n++)
+    {
+        DdsRun(out[n]);
+        step[n + 1][0] = Dds.tone[0].step;
+        step[n + 1][1] = Dds.tone[1].step;
+    }
+    chirpsNs = (float64)(HostWallNs() - start) / DDS_TEST_SAMPLES;
+
+    for (n = 0; n < DDS_TEST_SAMPLES; n++)
+    {
+        for (t = 0; t < 2; t++)
+        {
+            chirpError = fmax(chirpError, fabs((float64)out[n][chirps[t].dac] - DDS_DAC_MID -
+                                               DdsReference(chirps[t].amplitude, (float64)phase[t] / 4294967296.0)));
+            phase[t] += step[n][t];
+        }
+
+        // f(n + 1) = f(n) (1 + rate) up to the held stop frequency, f(n + 1) = f(n) + rate over the first sweep
+        f[0] = fmin(f[0] * (1.0 + rate[0]), last[0]);
+        sweepError = fmax(sweepError, fabs((float64)step[n + 1][0] / 4294967296.0 - f[0]) / f[0]);
+        f[1] += rate[1];
+        if (f[1] > last[1] - rate[1])
+        {
+            sweepError = fmax(sweepError, fabs((float64)step[n + 1][1] / 4294967296.0 - f[1]) / f[1]);
+        }
+    }
+
+    printf("DDS generators        : %u samples, tones %.2f counts max error, %.1f ns/sample; chirps %.2f counts, "
+           "sweep law %.1e, %lu sweeps, %.1f ns/sample\n",
+           DDS_TEST_SAMPLES, toneError, tonesNs, chirpError, sweepError, (unsigned long)Dds.sweeps, chirpsNs);
+    // Each generator rounds to a count on its own, so the two tones on DAC-B may be off by 1.5
+    if ((toneError > 1.5) || (chirpError > 1.0) || (sweepError > 1.0e-5) || (refused != 0) ||
+        (Dds.sweeps != 4) || (Dds.clips != 0) || (Dds.tone[0].sweep != DDS_SWEEP_OFF) ||
+        (Dds.tone[0].step != (Uint32)(Dds.tone[0].last * 4294967296.0f)))
+    {
+        printf("FAIL: DDS output differs from the reference\n");
+        failures++;
+    }
+    return failures;
+}
+
+// SCI-A (SCI_ON): the startup loopback self-test must pass over the modelled FIFOs and
+// interrupts, bytes sent by the host must reach the firmware RX queue, and the SCI
+// interrupt handshake must be clean.
+//
+// Far end of SCI-A: keep the line for the decoder
+static void HostSciLine(Uint16 data)
+{
+    if (sciLineLength == sciLineSize)
+    {
+        sciLineSize = sciLineSize ? 2 * sciLineSize : 65536;
+        sciLine = realloc(sciLine, sciLineSize);
+        assert(sciLine != NULL);
+    }
+    sciLine[sciLineLength++] = (uint8_t)data;
+}
+
+// Telemetry (STREAM_ON and SCI_ON): the firmware sends the stream as telemetry frames.
+// Every byte leaving SCI-A is kept (and written to the --capture file, for replay with
+// telemetry_dump); after the run it is decoded with telemetry_decoder.c, which must
+// report no CRC, framing or sequence errors, consecutive timestamps from 0 and this
+// sample's ADC-B/ADC-D inputs. The decoder must also run faster than the sample rate.
+#if (STREAM_MODE == STREAM_ON) && (SCI_MODE == SCI_ON) && (CPU2_MODE == CPU2_OFF)
+static Uint64 tlmSamples;                   // Samples decoded from the telemetry frames
+static Uint64 tlmGaps;                      // Decoded samples whose timestamp does not follow the previous one
+static Uint64 tlmMismatches;                // Decoded samples whose ADC-B/ADC-D values are not this sample's inputs
+
+// Decoder callback: check continuity and content like HostStreamSink
+static void CheckTelemetry(void *context, const TLM_SAMPLE *samples, unsigned count)
+{
+    Uint32 ts;
+    unsigned i;
+
+    (void)context;
+    for (i = 0; i < count; i++)
+    {
+        ts = samples[i].timestamp;
+        if (ts != (Uint32)tlmSamples)
+        {
+            tlmGaps++;
+        }
+        if ((samples[i].adc[1] != ((ts * 7U) & 0x0FFF)) ||
+            (samples[i].adc[3] != ((ts & 0x1000) ? (0x0FFF - (ts & 0x0FFF)) : (ts & 0x0FFF))))
+        {
+            tlmMismatches++;
+        }
+        tlmSamples++;
+    }
+}
+#endif
+
+// Streaming (STREAM_ON): a host sink replaces the default one and checks that the
+// drained records carry consecutive timestamps and this sample's ADC-B input, and
+// that the ring never overflowed. With SCI_ON the firmware installs its telemetry sink
+// instead and the records are checked after decoding (see Telemetry).
+//
+// Stream sink: take everything, check continuity and content
+static Uint16 HostStreamSink(const STREAM_RECORD *records, Uint16 count)
+{
+    Uint16 i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (records[i].timestamp != (Uint32)streamRecords)
+        {
+            streamGaps++;
+        }
+        if (records[i].adc[1] != ((records[i].timestamp * 7U) & 0x0FFF))
+        {
+            streamMismatches++;
+        }
+        streamRecords++;
+    }
+    return count;
+}
+
+// Keep the scenario that needs the longest run
+static void TestRunNeeds(float64 last, const char *name, float64 *needed, const char **scenario)
+{
+    if (last + TEST_RUN_MARGIN > *needed)
+    {
+        *needed = last + TEST_RUN_MARGIN;
+        *scenario = name;
+    }
+}
+
+// Shortest run [s] that reaches the last event of every scenario configured, and the scenario
+// that sets it; schedules in seconds or samples do not shrink with -t
+static float64 TestRunSeconds(const char **scenario)
+{
+    const float64 sampleSeconds = (float64)ADC_SAMPLE_PERIOD * 1e-8;
+    float64 needed = 0.0;
+#if SPEED_INPUT == SPEED_INPUT_QEP
+    float64 position;
+    float64 steady;
+#endif
+#if (SDFM_MODE == SDFM_ON) || (CMPSS_MODE == CMPSS_ON)
+    Uint16 k;
+#endif
+
+    // The second half holds a rising ADC-A crossing and the rest of the buffer after it
+    TestRunNeeds(2.0 * (1.0 / TEST_ADCA_HZ + RESULTS_BUFFER_SIZE * sampleSeconds), "capture trigger", &needed, scenario);
+#if DAC_SOURCE == DAC_SOURCE_PLAYBACK
+    // The once table ends in the third quarter, before the stream
+    TestRunNeeds(4.0 * PLAYBACK_ONCE_FRAMES / PLAYBACK_ONCE_HZ, "DAC playback", &needed, scenario);
+#endif
+#if SDRAM_MODE == SDRAM_ON
+    // The ring stops at a quarter; the fill, rounded up to a block, and both readbacks take the rest
+    TestRunNeeds(4.0 / 3.0 * (SDRAM_FILL_DEPTH + DMA_CAPTURE_HALF_SIZE + (SDRAM_RING_DEPTH + SDRAM_FILL_DEPTH) / SDRAM_READ_FRAMES) *
+                 sampleSeconds, "SDRAM store", &needed, scenario);
+#endif
+#if ECAP_MODE == ECAP_ON
+    // One external cycle is published at the first pass after it ends
+    TestRunNeeds(ECAP_MIN_CYCLES * (ECAP_EXT_PERIODS * ECAP_PWM1_PERIOD_PS * 1e-12 + 2.0 * MAIN_LOOP_PERIOD_US * 1e-6),
+                 "eCAP PWM measurement", &needed, scenario);
+#endif
+#if SPEED_INPUT == SPEED_INPUT_QEP
+    // The lost edges, then the next index that corrects them
+    TestRunNeeds(QEP_TEST_MISS_SECONDS + 2.0 * HOST_PI / fabs(QepTestProfile(QEP_TEST_MISS_SECONDS, &position, &steady)),
+                 "eQEP encoder", &needed, scenario);
+#endif
+#if SDFM_MODE == SDFM_ON
+    for (k = 0; k < SDFM_TEST_PULSES; k++)
+    {
+        TestRunNeeds(sdfmTestPulses[k].start + SDFM_TEST_PULSE_SECONDS + SDFM_TEST_SETTLE_SECONDS, "SDFM current", &needed, scenario);
+    }
+    TestRunNeeds(SDFM_TEST_CLEAR_SECONDS, "SDFM current", &needed, scenario);
+#endif
+#if CMPSS_MODE == CMPSS_ON
+    for (k = 0; k < CMPSS_TEST_PULSES; k++)
+    {
+        TestRunNeeds(cmpssTestPulses[k].start + cmpssTestPulses[k].length, "CMPSS over-current trip", &needed, scenario);
+    }
+    for (k = 0; k < CMPSS_TEST_CLEARS; k++)
+    {
+        TestRunNeeds(cmpssTestClears[k] + CMPSS_TEST_RESUME_PS * 1e-12, "CMPSS over-current trip", &needed, scenario);
+    }
+#endif
+    return ceil(needed * 1000.0) / 1000.0;      // Whole ms, as printed
+}
+
+// Print one ISR profile, "n/a" where it has recorded no call; returns the calls in its latency histogram
+static Uint64 PrintProfile(const char *label, const ISR_PROFILE *profile)
+{
+    Uint64 histCount = 0;
+    int i;
+
+    for (i = 0; i < PROFILE_HIST_BINS; i++)
+    {
+        histCount += profile->latencyHist[i];
+    }
+    if (profile->count == 0)
+    {
+        printf("%-22s: 0 calls, latency n/a, exec n/a, %lu overruns of %lu\n", label,
+               (unsigned long)profile->overruns, (unsigned long)profile->deadline);
+    }
+    else
+    {
+        printf("%-22s: %lu calls, latency %lu..%lu cycles, exec %lu..%lu cycles, %lu overruns of %lu\n", label,
+               (unsigned long)profile->count, (unsigned long)profile->latencyMin, (unsigned long)profile->latencyMax,
+               (unsigned long)profile->execMin, (unsigned long)profile->execMax,
+               (unsigned long)profile->overruns, (unsigned long)profile->deadline);
+    }
+    return histCount;
+}
+
+int main(int argc, char **argv)
+{
+    float64 seconds = 2.0;          // Simulated time
+    float64 maxIsrNs = 0.0;         // Limit on the mean host ISR cost, 0 = no limit
+    float64 minRealtime = 0.0;      // Limit on simulated seconds per wall second, 0 = no limit
+    const char *capturePath = NULL; // File receiving the SCI-A line
+    const char *scenario;           // Scenario that needs the longest run
+    float64 neededSeconds;
+    TLM_DECODER decoder;
+    float64 decodeSeconds;
+    FILE *capture;
+    float64 wallSeconds;
+    float64 meanIsrNs;
+    float64 realtime;
+    Uint64 expectedCalls;
+    Uint64 start;
+    ISR_PROFILE profile;
+    Uint64 histCount;
+    int failures = 0;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-t") == 0) && (i + 1 < argc))
+        {
+            seconds = atof(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--max-isr-ns") == 0) && (i + 1 < argc))
+        {
+            maxIsrNs = atof(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--min-realtime") == 0) && (i + 1 < argc))
+        {
+            minRealtime = atof(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--capture") == 0) && (i + 1 < argc))
+        {
+            capturePath = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-t seconds] [--max-isr-ns N] [--min-realtime X] [--capture file]\n", argv[0]);
+            return 2;
+        }
+    }
+    neededSeconds = TestRunSeconds(&scenario);
+    if (seconds < neededSeconds)
+    {
+        fprintf(stderr, "%s: run too short for scenario %s: -t %.3f or more\n", argv[0], scenario, neededSeconds);
+        return 2;
+    }
+
+    triggerSwitchSample = (Uint32)(seconds * 25000.0);     // Midpoint of the run at 50 kHz
+    failures += FilterBitExact();
+    failures += MotorSelfTest();
+    failures += DdsSelfTest();
+#if FILTER_MODE == FILTER_ON
+    filterLoadSample = triggerSwitchSample / 2;
+#if ADC_CAPTURE_MODE == ADC_CAPTURE_DMA
+    filterLoadSample |= DMA_CAPTURE_HALF_SIZE - 1;  // Loaded after the block, taken from the next one, as the reference
+#endif
+    for (i = 0; i < FILTER_CHANNELS; i++)
+    {
+        FilterReferenceInit(&filterRef[i], &FilterBank.channel[i].coeffs);     // The defaults FilterInit() loads
+    }
+#endif
+    HostInputHook = SyntheticInputs;
+    HostSampleHook = CheckSample;
+    HostDmaHook = CheckDmaTrigger;
+#if ECAP_MODE == ECAP_ON
+    phaseOffset5 = (Uint16)(ECAP_PWM1_TICKS / 4);  // PWM5A a quarter period ahead of PWM1A
+    HostExtPwm.gpio = ECAP_EXT_GPIO;
+    HostExtPwm.periodPs = ECAP_EXT_PERIODS * ECAP_PWM1_PERIOD_PS;
+    HostExtPwm.highPs = HostExtPwm.periodPs * 2 / 5;   // 40 %
+    HostExtPwm.delayPs = ECAP_EXT_DELAY_PS;
+#endif
+#if SPEED_INPUT == SPEED_INPUT_QEP
+    qepHome = INT64_MIN;
+    QepTestInit();
+#endif
+#if SDFM_MODE == SDFM_ON
+    SdfmTestInit();
+#endif
+#if CMPSS_MODE == CMPSS_ON
+    CmpssTestInit();
+#endif
+#if (CPU2_MODE == CPU2_ON) || (SDRAM_MODE == SDRAM_ON) || (ADC_CAPTURE_MODE == ADC_CAPTURE_DMA)
+    sampleInputSize = (Uint32)(seconds * 1e8 / ADC_SAMPLE_PERIOD) + 1000;   // At least one per ePWM2 period
+    sampleInputs = calloc(sampleInputSize, sizeof(sampleInputs[0]));
+    assert(sampleInputs != NULL);
+    HostInputHook = RecordInputs;
+#endif
+#if SDRAM_MODE == SDRAM_ON
+    sdramStopSample = triggerSwitchSample / 2;
+#endif
+#if ADC_CAPTURE_MODE == ADC_CAPTURE_CLA
+    HostClaTask1 = Cla1Task1;                   // Runs when the firmware attaches it to ADCAINT1
+#endif
+    StreamSink = HostStreamSink;                // Replaced by TelemetrySink when SCI-A is on
+    HostSciTxHook = HostSciLine;
+#if DAC_SOURCE == DAC_SOURCE_PLAYBACK
+    playbackOnceSample = triggerSwitchSample;
+    playbackStreamSample = triggerSwitchSample * 3 / 2;
+#endif
+#if CPU2_MODE == CPU2_ON
+    Cpu2ProcessInit();
+    HostIpcRemote(&cpu2Batch.controller, IPC_LINK_INT);
+    cpu2Batch.receive = HostCpu2Blocks;
+    IpcRegs.IPCSTS.all |= IPC_FLAG_CPU2_READY;  // CPU2 is up before CPU1 starts
+#endif
+
+    start = HostWallNs();
+    HostRun(firmware_main, seconds);
+    wallSeconds = (float64)(HostWallNs() - start) * 1e-9;
+
+    meanIsrNs = HostStats.isrCalls ? (float64)HostStats.isrNsTotal / (float64)HostStats.isrCalls : 0.0;
+    realtime = (wallSeconds > 0.0) ? seconds / wallSeconds : 0.0;
+
+    printf("simulated time        : %.6f s (%.3f s wall, %.1fx real time)\n", seconds, wallSeconds, realtime);
+    printf("sample period         : %.3f us\n", HostStats.samplePeriod * 1e6);
+    printf("ePWM2 SOCA events     : %llu\n", (unsigned long long)HostStats.socaEvents);
+    printf("adca1_isr calls       : %llu\n", (unsigned long long)HostStats.isrCalls);
+    printf("host ISR cost         : mean %.1f ns, max %llu ns\n", meanIsrNs, (unsigned long long)HostStats.isrNsMax);
+    printf("host throughput       : %.0f samples per wall second, %.0f samples per simulated second\n",
+           (wallSeconds > 0.0) ? (float64)HostStats.isrCalls / wallSeconds : 0.0,
+           (float64)HostStats.isrCalls / seconds);
+    printf("captured samples      : %llu checked, %llu mismatched\n",
+           (unsigned long long)captureCount, (unsigned long long)captureMismatches);
+    printf("DAC forwarding        : %llu mismatched, %llu latency mismatches, dacLatencyMax %u\n",
+           (unsigned long long)dacMismatches, (unsigned long long)latencyMismatches, dacLatencyMax);
+    printf("interrupt handshake   : %llu missed ADCINT1 clears, %llu missed PIE acks, %llu ADC overflows\n",
+           (unsigned long long)HostStats.missedFlagClears, (unsigned long long)HostStats.missedPieAcks,
+           (unsigned long long)HostStats.adcOverflows);
+
+    ProfileSnapshot(&IsrProfile[ISR_PROFILE_DMACH4], &profile);
+    histCount = PrintProfile("dmach4_isr profile", &profile);
+#if ADC_CAPTURE_MODE == ADC_CAPTURE_DMA
+    // Every call after the first transfer, entered at the modelled latency after the SOCA that raised ADCAINT1
+    if ((profile.count + 1 != HostStats.dmaChIsrCalls[3]) || (histCount != profile.count) || (profile.overruns != 0) ||
+        (profile.latencyMin != HOST_ADC_LATENCY_TICKS * PROFILE_CYCLES_PER_TBCLK) ||
+        (profile.latencyMax != HOST_ADC_LATENCY_TICKS * PROFILE_CYCLES_PER_TBCLK))
+#else
+    if (profile.count != 0)
+#endif
+    {
+        printf("FAIL: DMA CH4 ISR profile does not match the emulated calls\n");
+        failures++;
+    }
+
+    ProfileSnapshot(&IsrProfile[ISR_PROFILE_ADCA1], &profile);
+    histCount = PrintProfile("adca1_isr profile", &profile);
+#if ADC_CAPTURE_MODE != ADC_CAPTURE_ISR
+    if ((profile.count != 0) || (histCount != 0))   // adca1_isr is not attached
+    {
+        printf("FAIL: ISR profile does not match the emulated calls\n");
+        failures++;
+    }
+#endif
+
+    printf("capture trigger       : %lu default captures, single shot %s (trigger %u, start %u), "
+           "%lu held with %lu triggers, %lu overwritten\n",
+           (unsigned long)defaultCaptures, (TriggerStatus.state == TRIG_STATE_DONE) ? "done" : "pending",
+           TriggerStatus.triggerIndex, TriggerStatus.startIndex,
+           (unsigned long)heldChecks, (unsigned long)heldTriggers, (unsigned long)heldOverwrites);
+#if ADC_CAPTURE_MODE == ADC_CAPTURE_DMA
+    printf("DMA capture           : %lu blocks (%lu replayed), %u overruns, %llu without inputs, %llu wrong words, "
+           "%llu DMA ISR calls, %llu frame 2 words refused\n",
+           (unsigned long)dmaBlockCount, (unsigned long)dmaBlocksChecked, dmaBlockOverrun,
+           (unsigned long long)dmaBlockMismatches, (unsigned long long)dmaContentErrors,
+           (unsigned long long)HostStats.dmaIsrCalls, (unsigned long long)HostStats.dmaFrameRefusals);
+
+    // One block per DMA_CAPTURE_HALF_SIZE SOCAs after the first transfer, every one replayed sample by sample
+    if ((dmaBlockCount == 0) || (dmaBlockCount != (HostStats.socaEvents - 1) / DMA_CAPTURE_HALF_SIZE) ||
+        (dmaBlocksChecked != dmaBlockCount) || (dmaBlockOverrun != 0) || (dmaBlockMismatches != 0) ||
+        (dmaContentErrors != 0) || (captureCount == 0) || (HostStats.dmaFrameRefusals != 0))
+    {
+        printf("FAIL: DMA capture lost, skipped or misplaced blocks\n");
+        failures++;
+    }
+#endif
+
+#if STREAM_MODE == STREAM_ON
+    printf("stream                : %llu records drained, %llu gaps, %llu mismatched, %lu overflows, high water %u of %u\n",
+           (unsigned long long)streamRecords, (unsigned long long)streamGaps, (unsigned long long)streamMismatches,
+           (unsigned long)StreamStats.overflows, StreamStats.highWater, STREAM_RING_SIZE);
+    if ((streamGaps != 0) || (streamMismatches != 0) || (StreamStats.overflows != 0) ||
+        ((StreamSink == HostStreamSink) && (streamRecords + STREAM_RING_SIZE < StreamStats.pushed)))
+    {
+        printf("FAIL: stream lost or corrupted records\n");
+        failures++;
+    }
+#endif
+
+#if CPU2_MODE == CPU2_ON
+    printf("CPU2 link             : %llu blocks in %lu batches, %llu records, %lu slots busy, %lu put buffer full, "
+           "%llu bad blocks, %llu gaps, %llu mismatched, %llu not owned\n",
+           (unsigned long long)cpu2Blocks, (unsigned long)IpcLinkStats.batches, (unsigned long long)cpu2Records,
+           (unsigned long)IpcLinkStats.slotsBusy, (unsigned long)IpcLinkStats.putFull, (unsigned long long)cpu2BadBlocks,
+           (unsigned long long)cpu2Gaps, (unsigned long long)cpu2Mismatches, (unsigned long long)cpu2OwnerErrors);
+    printf("CPU2 completions      : %lu blocks taken, latency last %lu max %lu cycles, %llu IPC0 ISR calls, "
+           "%llu missed IPC acks, %llu missed PIE acks\n",
+           (unsigned long)IpcLinkStats.blocksTaken, (unsigned long)IpcLinkStats.latencyLast,
+           (unsigned long)IpcLinkStats.latencyMax, (unsigned long long)HostStats.ipcIsrCalls,
+           (unsigned long long)HostStats.ipcMissedFlagAcks, (unsigned long long)HostStats.ipcMissedPieAcks);
+    printf("CPU2 processing       : %lu samples, %lu lost, %lu windows (%llu wrong), %llu filter errors, "
+           "filtered %u %u %u %u\n",
+           (unsigned long)Cpu2Status.samples, (unsigned long)Cpu2Status.lostSamples, (unsigned long)Cpu2Status.windows,
+           (unsigned long long)cpu2WindowErrors, (unsigned long long)cpu2FilterErrors,
+           Cpu2Status.filtered[0], Cpu2Status.filtered[1], Cpu2Status.filtered[2], Cpu2Status.filtered[3]);
+    if ((cpu2BadBlocks != 0) || (cpu2Gaps != 0) || (cpu2Mismatches != 0) || (cpu2OwnerErrors != 0) ||
+        (IpcLinkStats.slotsBusy > CPU2_LINK_STALLS) || (IpcLinkStats.putFull > CPU2_LINK_STALLS) ||
+        (Cpu2Status.lostSamples != 0) || (Cpu2Status.samples != cpu2Records) ||
+        (cpu2WindowErrors != 0) || (cpu2FilterErrors != 0) ||
+        (IpcLinkStats.blocksTaken != cpu2Blocks) || (IpcLinkStats.blocksSent - IpcLinkStats.blocksTaken > IPC_BATCH_MAX) ||
+        ((float64)IpcLinkStats.latencyMax > 2.0 * HostStats.samplePeriod * HOST_SYSCLK_HZ) || (HostStats.ipcIsrCalls == 0) ||
+        (HostStats.ipcMissedFlagAcks != 0) || (HostStats.ipcMissedPieAcks != 0) ||
+        ((cpu2Records != 0) && (Cpu2Status.windows != cpu2Records / CPU2_STATS_WINDOW)) ||
+        (cpu2Records + IPC_BLOCK_RECORDS + STREAM_RING_SIZE < StreamStats.pushed))
+    {
+        printf("FAIL: CPU2 link lost, corrupted or misprocessed blocks\n");
+        failures++;
+    }
+#endif
+
+    if (capturePath != NULL)
+    {
+        capture = fopen(capturePath, "wb");
+        if ((capture == NULL) || (fwrite(sciLine, 1, sciLineLength, capture) != sciLineLength))
+        {
+            perror(capturePath);
+            failures++;
+        }
+        if (capture != NULL)
+        {
+            fclose(capture);
+        }
+    }
+
+#if (STREAM_MODE == STREAM_ON) && (SCI_MODE == SCI_ON) && (CPU2_MODE == CPU2_OFF)
+    TlmDecoderInit(&decoder, CheckTelemetry, NULL);
+    start = HostWallNs();
+    TlmDecoderFeed(&decoder, sciLine, sciLineLength);
+    decodeSeconds = (float64)(HostWallNs() - start) * 1e-9;
+    printf("telemetry             : %lu frames (%lu short) sent, %llu bytes, %llu samples decoded of %lu streamed\n",
+           (unsigned long)TelemetryStats.frames, (unsigned long)TelemetryStats.shortFrames,
+           (unsigned long long)decoder.stats.bytes, (unsigned long long)tlmSamples, (unsigned long)StreamStats.pushed);
+    printf("telemetry decoder     : %llu CRC errors, %llu framing errors, %llu lost frames, %llu lost samples, "
+           "%llu gaps, %llu mismatched, %.1f Msamples/s\n",
+           (unsigned long long)decoder.stats.crcErrors, (unsigned long long)decoder.stats.framingErrors,
+           (unsigned long long)decoder.stats.lostFrames, (unsigned long long)decoder.stats.lostSamples,
+           (unsigned long long)tlmGaps, (unsigned long long)tlmMismatches,
+           (decodeSeconds > 0.0) ? (float64)tlmSamples / decodeSeconds * 1e-6 : 0.0);
+    if ((decoder.stats.crcErrors != 0) || (decoder.stats.framingErrors != 0) || (decoder.stats.lostFrames != 0) ||
+        (decoder.stats.lostSamples != 0) || (tlmGaps != 0) || (tlmMismatches != 0) ||
+        (tlmSamples + STREAM_RING_SIZE + SCI_TX_QUEUE_SIZE < StreamStats.pushed) ||
+        ((tlmSamples != 0) && ((float64)tlmSamples < decodeSeconds / HostStats.samplePeriod)))
+    {
+        printf("FAIL: telemetry stream lost, corrupted or too slow to decode\n");
+        failures++;
+    }
+#else
+    (void)decoder;
+    (void)decodeSeconds;
+#endif
+
+#if (SCI_MODE == SCI_ON) && (CPU2_MODE == CPU2_OFF)
+    printf("SCI-A                 : %.0f baud, loopback %s, %llu bytes shifted, %lu received, %llu ISR calls\n",
+           HostStats.sciBaud, (SciStats.loopback == SCI_TEST_PASS) ? "passed" : "failed",
+           (unsigned long long)HostStats.sciTxBytes, (unsigned long)SciStats.rxBytes,
+           (unsigned long long)HostStats.sciIsrCalls);
+    if ((SciStats.loopback != SCI_TEST_PASS) || (fabs((float64)SciStats.baud - SCI_BAUD) > SCI_BAUD / 100.0) ||
+        (sciSent != TEST_SCI_BYTES) || (SciStats.rxBytes != SCI_TEST_LENGTH + TEST_SCI_BYTES) ||
+        (HostStats.sciMissedFlagClears != 0) || (HostStats.sciMissedPieAcks != 0) || (HostStats.sciTxFifoOverruns != 0))
+    {
+        printf("FAIL: SCI-A driver\n");
+        failures++;
+    }
+#endif
+
+    if ((defaultCaptures == 0) || !SingleCaptureValid() || (heldChecks == 0) || (heldTriggers == 0) || (heldOverwrites != 0))
+    {
+        printf("FAIL: capture trigger did not fire as configured\n");
+        failures++;
+    }
+
+#if ADC_CAPTURE_MODE == ADC_CAPTURE_CLA
+    printf("CLA task 1            : %llu calls, %lu samples, %lu overflows, %llu records checked, %llu mismatched, "
+           "%llu filter errors, host cost mean %.1f ns, max %llu ns\n",
+           (unsigned long long)HostStats.claTaskCalls, (unsigned long)ClaStatus.samples,
+           (unsigned long)ClaStatus.overflows, (unsigned long long)claRecords,
+           (unsigned long long)claRingMismatches, (unsigned long long)claFilterErrors,
+           HostStats.claTaskCalls ? (float64)HostStats.claNsTotal / (float64)HostStats.claTaskCalls : 0.0,
+           (unsigned long long)HostStats.claNsMax);
+    printf("CLA filtered          : %.1f %.1f %.1f %.1f\n", ClaStatus.filtered[0], ClaStatus.filtered[1],
+           ClaStatus.filtered[2], ClaStatus.filtered[3]);
+
+    // Every SOCA after the ePWMs start must start the task, and the background loop must keep up
+    expectedCalls = HostStats.socaEvents;
+    if ((HostStats.claTaskCalls != expectedCalls) || (HostStats.claTaskCalls == 0) ||
+        (ClaStatus.samples != HostStats.claTaskCalls) || (HostStats.isrCalls != 0) ||
+        (ClaStatus.overflows != 0) || (claRecords != HostStats.claTaskCalls) ||
+        (claRingMismatches != 0) || (claFilterErrors != 0))
+    {
+        printf("FAIL: CLA acquisition lost, corrupted or misfiltered samples\n");
+        failures++;
+    }
+#elif ADC_CAPTURE_MODE == ADC_CAPTURE_ISR
+    if ((profile.count != HostStats.isrCalls) || (histCount != profile.count) || (profile.overruns != 0) ||
+        (profile.latencyMin != HOST_ADC_LATENCY_TICKS * PROFILE_CYCLES_PER_TBCLK) ||
+        (profile.latencyMax != HOST_ADC_LATENCY_TICKS * PROFILE_CYCLES_PER_TBCLK))
+    {
+        printf("FAIL: ISR profile does not match the emulated calls\n");
+        failures++;
+    }
+
+    // Every SOCA after the ePWMs start must reach the ISR
+    expectedCalls = HostStats.socaEvents;
+    if ((HostStats.isrCalls != expectedCalls) || (HostStats.isrCalls == 0))
+    {
+        printf("FAIL: %llu ISR calls for %llu SOCA events\n",
+               (unsigned long long)HostStats.isrCalls, (unsigned long long)expectedCalls);
+        failures++;
+    }
+#else
+    (void)expectedCalls;
+#endif
+#if FILTER_MODE == FILTER_ON
+    printf("filter bank (live)    : %lu coefficient sets taken, %llu loads refused\n",
+           (unsigned long)FilterBank.loads, (unsigned long long)filterLoadFailures);
+    if ((filterLoadFailures != 0) || (FilterBank.loads != FILTER_CHANNELS))
+    {
+        printf("FAIL: filter coefficients not loaded at run time\n");
+        failures++;
+    }
+#endif
+#if DAC_SOURCE == DAC_SOURCE_MODEL
+    printf("motor model (live)    : %lu steps, DAC error max %u counts, speed %.1f rad/s, current %.3f A, "
+           "motorCyclesMax %u\n",
+           (unsigned long)MotorState.steps, motorDacErrorMax, MotorState.speed, MotorState.current, motorCyclesMax);
+    if ((Uint64)MotorState.steps != HostStats.isrCalls)
+    {
+        printf("FAIL: motor model not stepped once per sample\n");
+        failures++;
+    }
+#endif
+#if DAC_SOURCE == DAC_SOURCE_DDS
+    printf("DDS generators (live) : %lu loads, steps %lu %lu %lu, %lu clipped samples, ddsCyclesMax %u\n",
+           (unsigned long)Dds.loads, (unsigned long)ddsLiveSteps[0], (unsigned long)ddsLiveSteps[1],
+           (unsigned long)ddsLiveSteps[2], (unsigned long)Dds.clips, ddsCyclesMax);
+    if ((ddsLoadFailures != 0) || (Dds.loads != DDS_DACS) || (Dds.clips != 0))
+    {
+        printf("FAIL: DDS tones not loaded at run time\n");
+        failures++;
+    }
+#endif
+#if DAC_SOURCE == DAC_SOURCE_PLAYBACK
+    printf("DAC playback          : triggers loop %llu once %llu stream %llu, %llu mismatched, %llu late, "
+           "%llu CH6 ISR calls (%llu in the loop, %llu to the once end), once %s, %lu refills, %lu short, %lu overruns, "
+           "%llu DAC words refused\n",
+           (unsigned long long)playbackTriggerCount[PLAYBACK_LOOP], (unsigned long long)playbackTriggerCount[PLAYBACK_ONCE],
+           (unsigned long long)playbackTriggerCount[PLAYBACK_STREAM], (unsigned long long)playbackMismatches,
+           (unsigned long long)playbackTimingErrors, (unsigned long long)HostStats.dmaChIsrCalls[PLAYBACK_DMA_CH],
+           (unsigned long long)playbackLoopIsrCalls, (unsigned long long)playbackOnceIsrCalls,
+           playbackOnceEnded ? "ended" : "still running", (unsigned long)PlaybackStatus.refills,
+           (unsigned long)PlaybackStatus.shortFills, (unsigned long)PlaybackStatus.overruns,
+           (unsigned long long)HostStats.dmaFrameRefusals);
+
+    // One interrupt at the once end and one per stream transfer started, two refills up front and one
+    // per stream interrupt after the first
+    expectedCalls = 1 + (playbackTriggerCount[PLAYBACK_STREAM] + PLAYBACK_HALF - 1) / PLAYBACK_HALF;
+    if ((playbackStartFailures != 0) || (playbackMismatches != 0) || (playbackTimingErrors != 0) ||
+        (playbackTriggerCount[PLAYBACK_LOOP] <= PLAYBACK_LOOP_FRAMES) ||
+        (playbackTriggerCount[PLAYBACK_ONCE] != PLAYBACK_ONCE_FRAMES) ||
+        (playbackTriggerCount[PLAYBACK_STREAM] <= 2 * PLAYBACK_FRAMES) ||
+        (playbackLoopIsrCalls != 0) || (playbackOnceIsrCalls != 1) || (playbackOnceEnded == 0) ||
+        (HostStats.dmaChIsrCalls[PLAYBACK_DMA_CH] != expectedCalls) ||
+        (PlaybackStatus.refills != HostStats.dmaChIsrCalls[PLAYBACK_DMA_CH]) || (PlaybackStatus.shortFills != 0) ||
+        (PlaybackStatus.overruns != 0) || (HostStats.dmaMissedPieAcks != 0) || (HostStats.dmaFrameRefusals != 0))
+    {
+        printf("FAIL: DMA DAC playback\n");
+        failures++;
+    }
+#endif
+#if SDRAM_MODE == SDRAM_ON
+    printf("SDRAM store           : %u captures read back, %llu frames, %llu mismatched, %llu depth errors, "
+           "%llu refusals, %lu blocks, %lu moves, %lu late, %lu reads\n",
+           sdramCaptures, (unsigned long long)sdramFramesRead, (unsigned long long)sdramMismatches,
+           (unsigned long long)sdramDepthErrors, (unsigned long long)sdramRefusals, (unsigned long)SdramStatus.blocks,
+           (unsigned long)SdramStatus.moves, (unsigned long)SdramStatus.lateBlocks, (unsigned long)SdramStatus.reads);
+
+    // One block per DMA transfer completed, every stored block moved once and read back
+    if ((sdramCaptures != 2) || (sdramMismatches != 0) || (sdramDepthErrors != 0) || (sdramRefusals != 0) ||
+        (SdramStatus.blocks != (HostStats.socaEvents - 1) / DMA_CAPTURE_HALF_SIZE) ||
+        ((Uint64)SdramStatus.moves * DMA_CAPTURE_HALF_SIZE < sdramFramesRead) || (SdramStatus.lateBlocks != 0) ||
+        (HostStats.dmaMissedPieAcks != 0))
+    {
+        printf("FAIL: SDRAM capture store\n");
+        failures++;
+    }
+#endif
+#if PWM_OUTPUT_MODE != PWM_OUTPUT_FIXED
+    printf("PWM output            : %lu updates, %llu checked, %llu mismatched, %llu edge errors, "
+           "edge error max %.1f ps (MEP) %.1f ps (TBCLK), MEP scale factor %u, %lu calibrations, %lu SFO errors, "
+           "%llu SFO calls\n",
+           (unsigned long)PwmStatus.updates, (unsigned long long)pwmChecks, (unsigned long long)pwmMismatches,
+           (unsigned long long)pwmEdgeErrors, pwmMepErrorMax, pwmTbclkErrorMax, PwmStatus.mepScaleFactor,
+           (unsigned long)PwmStatus.calibrations, (unsigned long)PwmStatus.sfoErrors,
+           (unsigned long long)HostStats.sfoCalls);
+
+    // One update per ISR call, or at least one per block or drain, every one checked
+    if ((pwmChecks == 0) || (pwmMismatches != 0) || (pwmEdgeErrors != 0) || (PwmStatus.updates == 0) ||
+        ((ADC_CAPTURE_MODE == ADC_CAPTURE_ISR) && (PwmStatus.updates != HostStats.isrCalls)) ||
+        PwmModuleWrong(&EPwm1Regs) || PwmModuleWrong(&EPwm5Regs) || (EPwm1Regs.TBCTL.bit.SYNCOSEL != 1) ||
+        (EPwm5Regs.TBCTL.bit.PHSEN != 1) ||
+        ((PWM_OUTPUT_MODE == PWM_OUTPUT_HRPWM) &&
+         ((PwmStatus.hrActive != 1) || (PwmStatus.sfoErrors != 0) || (PwmStatus.calibrations < 2) ||
+          (PwmStatus.mepScaleFactor != HOST_MEP_SCALE_FACTOR) || (pwmMepErrorMax == 0.0) ||
+          (pwmMepErrorMax > PWM_TBCLK_PS / (2.0 * HOST_MEP_SCALE_FACTOR) + PWM_TBCLK_PS / 256.0))))
+    {
+        printf("FAIL: PWM switching stage\n");
+        failures++;
+    }
+#endif
+#if ECAP_MODE == ECAP_ON
+    printf("eCAP measurement      : %lu/%lu/%lu cycles, %llu checked, %llu not checked, %llu wrong, %llu gaps, "
+           "PWM1A %.3f us %.2f %%, PWM5A phase %.3f us, external %.3f us %.2f %% phase %.3f us, phase error max %.1f ns\n",
+           (unsigned long)EcapStatus.channel[ECAP_CH_PWM1].cycles, (unsigned long)EcapStatus.channel[ECAP_CH_PWM5].cycles,
+           (unsigned long)EcapStatus.channel[ECAP_CH_EXT].cycles, (unsigned long long)ecapChecks,
+           (unsigned long long)ecapUnchecked, (unsigned long long)ecapErrors, (unsigned long long)ecapGaps,
+           EcapStatus.channel[ECAP_CH_PWM1].period * 1e-3 * ECAP_CYCLE_PS * 1e-3,
+           EcapStatus.channel[ECAP_CH_PWM1].duty * 100.0,
+           EcapStatus.channel[ECAP_CH_PWM5].phase * 1e-3 * ECAP_CYCLE_PS * 1e-3,
+           EcapStatus.channel[ECAP_CH_EXT].period * 1e-3 * ECAP_CYCLE_PS * 1e-3,
+           EcapStatus.channel[ECAP_CH_EXT].duty * 100.0,
+           EcapStatus.channel[ECAP_CH_EXT].phase * 1e-3 * ECAP_CYCLE_PS * 1e-3, ecapPhaseErrorMax * 1e-3);
+
+    // Every channel measured, nearly every cycle checked, nothing off by more than a count, no interrupts
+    if ((ecapErrors != 0) || (ecapChecks < 10 * ecapUnchecked) || (ECAP_EVERY_CYCLE && (ecapGaps != 0)) ||
+        (EcapStatus.channel[ECAP_CH_PWM1].cycles < ECAP_MIN_CYCLES) ||
+        (EcapStatus.channel[ECAP_CH_PWM5].cycles < ECAP_MIN_CYCLES) ||
+        (EcapStatus.channel[ECAP_CH_EXT].cycles < ECAP_MIN_CYCLES) ||
+        (HostEpwmPeriodPs(&EPwm1Regs) != ECAP_PWM1_PERIOD_PS) ||
+        (ECap1Regs.ECEINT.all != 0) || (ECap2Regs.ECEINT.all != 0) || (ECap3Regs.ECEINT.all != 0))
+    {
+        printf("FAIL: eCAP PWM measurement\n");
+        failures++;
+    }
+#endif
+#if SPEED_INPUT == SPEED_INPUT_QEP
+    printf("QEP encoder           : %llu samples, %llu unit-time/%llu capture-timer, %lu index (%lu corrected), "
+           "position %ld counts (%ld turns + %lu), %llu constant-speed checks, capture error max %.3f %%, "
+           "%llu/%llu/%llu/%llu/%llu wrong position/unit/capture/method/published\n",
+           (unsigned long long)qepChecks, (unsigned long long)qepMethodSamples[QEP_METHOD_UNIT],
+           (unsigned long long)qepMethodSamples[QEP_METHOD_CAPTURE], (unsigned long)QepStatus.indexEvents,
+           (unsigned long)QepStatus.indexErrors, (long)QepStatus.position, (long)QepStatus.turns,
+           (unsigned long)QepStatus.angle, (unsigned long long)qepCaptureChecks, qepCaptureErrorMax * 100.0,
+           (unsigned long long)qepPositionErrors, (unsigned long long)qepUnitErrors,
+           (unsigned long long)qepCaptureErrors, (unsigned long long)qepMethodErrors,
+           (unsigned long long)qepPublishErrors);
+
+    // Every estimate right, both methods used, the lost edges seen and corrected by exactly one index
+    if ((qepPositionErrors != 0) || (qepUnitErrors != 0) || (qepCaptureErrors != 0) || (qepMethodErrors != 0) ||
+        (qepPublishErrors != 0) || (qepChecks == 0) || (qepCaptureChecks == 0) ||
+        (qepMethodSamples[QEP_METHOD_UNIT] == 0) || (qepMethodSamples[QEP_METHOD_CAPTURE] == 0) ||
+        (QepStatus.homed != 1) || (qepMissState != 3) || (QepStatus.indexErrors != 1) ||
+        (EQep1Regs.QEINT.all != 0))
+    {
+        printf("FAIL: eQEP encoder\n");
+        failures++;
+    }
+#endif
+#if SDFM_MODE == SDFM_ON
+    printf("SDFM current          : %llu samples (%llu tracked), shift %u, gain %.4f mA, track error max %.2f/%.2f counts, "
+           "%lu trips (%llu ISR calls), flag latency max %.2f us, fault 0x%X, %llu/%llu/%llu wrong data/flags/latch\n",
+           (unsigned long long)sdfmChecks, (unsigned long long)sdfmTrackChecks, (unsigned)SdfmStatus.shift,
+           SdfmStatus.gain, sdfmTrackErrorMax, sdfmTrackTolerance, (unsigned long)SdfmStatus.trips,
+           (unsigned long long)HostStats.sdfmIsrCalls, (float64)sdfmTripPsMax * 1e-6, (unsigned)SdfmStatus.fault,
+           (unsigned long long)sdfmDataErrors, (unsigned long long)sdfmFlagErrors, (unsigned long long)sdfmLatchErrors);
+
+    // Every result exact, both directions tripped in time and latched once, the thresholds those of the limit
+    for (i = 0; i < SDFM_TEST_PULSES; i++)
+    {
+        if ((sdfmTestPulses[i].fault != 0) && (sdfmTripPs[i] == 0))
+        {
+            sdfmFlagErrors++;                   // Never tripped
+        }
+    }
+    if ((sdfmDataErrors != 0) || (sdfmFlagErrors != 0) || (sdfmLatchErrors != 0) || (sdfmChecks == 0) ||
+        (sdfmTrackChecks == 0) || (sdfmTrackErrorMax > sdfmTrackTolerance) || (sdfmCleared == 0) ||
+        (sdfmTripPsMax > (Uint64)SDFM_TRIP_BITS * (1000000000000ULL / SDFM_CLOCK_HZ)) ||
+        (SdfmStatus.trips != 2) || (SdfmStatus.fault != SDFM_FAULT_LOW) || (SdfmStatus.shift != sdfmShift) ||
+        (fabs(SdfmStatus.gain - sdfmGain) > 1e-6 * sdfmGain) ||
+        (fabs(Sdfm1Regs.SDCMPH1.bit.HLT - 16384.0 * (1.0 + SDFM_TRIP_MA / SDFM_FULL_SCALE_MA)) > 1.0) ||
+        (fabs(Sdfm1Regs.SDCMPL1.bit.LLT - 16384.0 * (1.0 - SDFM_TRIP_MA / SDFM_FULL_SCALE_MA)) > 1.0) ||
+        (HostStats.sdfmMissedFlagClears != 0) || (HostStats.sdfmMissedPieAcks != 0))
+    {
+        printf("FAIL: SDFM current\n");
+        failures++;
+    }
+#endif
+#if CMPSS_MODE == CMPSS_ON
+    printf("CMPSS trip            : %llu samples (%llu tripped), codes %u/%u, %lu trips (%llu ISR calls), "
+           "trip latency max %.1f ns, fault 0x%X, %llu/%llu/%llu wrong trips/latch/outputs\n",
+           (unsigned long long)cmpssChecks, (unsigned long long)cmpssHeldSamples, (unsigned)CmpssStatus.highCode,
+           (unsigned)CmpssStatus.lowCode, (unsigned long)CmpssStatus.trips, (unsigned long long)HostStats.tzIsrCalls,
+           (float64)cmpssTripPsMax * 1e-3, (unsigned)CmpssStatus.fault, (unsigned long long)cmpssTripErrors,
+           (unsigned long long)cmpssLatchErrors, (unsigned long long)cmpssOutputErrors);
+
+    // Every pulse that can trip tripped both ePWMs in time, once, the limits those of CMPSS_TRIP_MA on C2
+    for (i = 0; i < CMPSS_TEST_PULSES; i++)
+    {
+        if ((cmpssTestPulses[i].fault != 0) && ((cmpssTripPs[i][0] == 0) || (cmpssTripPs[i][1] == 0)))
+        {
+            cmpssTripErrors++;                  // Never tripped
+        }
+    }
+    if ((cmpssTripErrors != 0) || (cmpssLatchErrors != 0) || (cmpssOutputErrors != 0) || (cmpssChecks == 0) ||
+        (cmpssHeldSamples == 0) || (cmpssClears != CMPSS_TEST_CLEARS) || (cmpssTripPsMax > CMPSS_TRIP_PS) ||
+        (CmpssStatus.trips != 3) || (CmpssStatus.fault != 0) || (CmpssStatus.highCode != cmpssHighCode) ||
+        (CmpssStatus.lowCode != cmpssLowCode) || (Cmpss6Regs.DACHVALS.bit.DACVAL != cmpssHighCode) ||
+        (Cmpss6Regs.DACLVALS.bit.DACVAL != cmpssLowCode) || (AdccRegs.ADCSOC0CTL.bit.CHSEL != 2) ||
+        (HostStats.tzMissedFlagClears != 0) || (HostStats.tzMissedPieAcks != 0))
+    {
+        printf("FAIL: CMPSS over-current trip\n");
+        failures++;
+    }
+#endif
+    if ((dacMismatches != 0) || (latencyMismatches != 0) || (captureMismatches != 0))
+    {
+        printf("FAIL: acquisition path produced wrong values\n");
+        failures++;
+    }
+    if ((HostStats.missedFlagClears != 0) || (HostStats.missedPieAcks != 0) || (HostStats.adcOverflows != 0))
+    {
+        printf("FAIL: interrupt handshake broken\n");
+        failures++;
+    }
+    if ((maxIsrNs > 0.0) && (meanIsrNs > maxIsrNs))
+    {
+        printf("FAIL: mean host ISR cost %.1f ns exceeds %.1f ns\n", meanIsrNs, maxIsrNs);
+        failures++;
+    }
+    if ((minRealtime > 0.0) && (realtime < minRealtime))
+    {
+        printf("FAIL: %.1fx real time is below %.1fx\n", realtime, minRealtime);
+        failures++;
+    }
+
+    printf("%s\n", failures ? "FAILED" : "PASSED");
+    return failures ? 1 : 0;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
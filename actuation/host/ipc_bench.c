@@ -0,0 +1,410 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: ipc_bench.c
+/*
+// File Description:
+// Host benchmark of the IPC driver paths. The CPU1 side uses the driver built as for
+// the firmware (F2837xD_Ipc_Driver.c, ipc_batch.c), the CPU2 side gets the same message
+// RAM through HostIpcRemote(). Every message carries a sequence number that the
+// consumer checks.
+//
+// Single thread: producer and consumer alternate, the producer fills the put buffer,
+// the consumer empties it. This measures the cost of the calls themselves.
+//   per-message   IpcPut()/IpcGet(), one index update and one IPC flag per message
+//   batch N       IpcPutBatch()/IpcGetBatch() with N messages per call
+// For each path it reports host ns per message and IPC flags raised per message; on
+// the target every flag is one IPC interrupt on the other core. The post-to-take
+// latency on the target is in IpcLinkStats (ipc_link.h).
+//
+// Two threads: a producer thread plays CPU1 and calls IpcPut(), a consumer thread
+// plays CPU2 and calls IpcGet(), each pinned to its own host CPU (--cpus). The message
+// RAM (g_asIPCCPU1toCPU2Buffers and the indexes) and IpcRegs are the process's memory,
+// shared by both threads as message RAM is shared by the cores. Each message carries
+// its send time; the consumer reports messages/s and send-to-get latency percentiles,
+// once with ENABLE_BLOCKING (both sides spin inside the driver) and once with
+// DISABLE_BLOCKING (the caller retries and yields the CPU in between).
+//
+// Memory ordering: the driver has no barriers, its buffer and index pointers are not
+// volatile, and it relies on the C28x, where the other core sees stores to message
+// RAM in program order. The report lists each ordering the driver depends on and
+// whether this host keeps it. On a weakly ordered host (ARM, POWER) the consumer can
+// see a new write index before the message behind it, which the content check counts
+// as stale.
+//
+// The buffer size follows the firmware build, e.g.
+//   make FW_DEFS="-DIPC_BUFFER_SIZE=16 -DNUM_IPC_INTERRUPTS=1"
+// and 'make bench' repeats the runs for each of BENCH_BUFFER_SIZES.
+//
+// Usage: ipc_bench [-n messages] [-t messages] [--cpus producer,consumer]
+//   -n  messages in each single-thread run (default 1000000)
+//   -t  messages in each two-thread run, 0 to skip (default 200000)
+// Exit status is non-zero if a message was lost, duplicated, stale or corrupted.
+// -----------------------------------------------------------------------------
+ */
+
+#include "F28x_Project.h"       // Device Header File and Examples Include File
+#include "ipc_batch.h"          // Batched, interrupt-driven IPC
+#include "host_device.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#define BENCH_INT   IPC_INT0    // IPC interrupt pair used for the benchmark
+#define BENCH_THREAD_COMMAND 0x00030002UL   // Two-thread messages: uladdress = sequence, uldataw1/2 = send time
+
+static Uint32 putSequence;                  // Next sequence number to send
+static Uint32 getSequence;                  // Next sequence number expected
+static Uint64 errors;                       // Messages out of sequence or corrupted
+static Uint64 flags;                        // IPC flags raised by the producer
+
+static void BenchMessage(tIpcMessage *message)
+{
+    message->ulcommand = 0x00030001UL;
+    message->uladdress = putSequence;
+    message->uldataw1 = ~putSequence;
+    message->uldataw2 = (Uint32)(putSequence * 2654435761UL);
+    putSequence++;
+}
+
+static void BenchCheck(const tIpcMessage *message)
+{
+    if ((message->ulcommand != 0x00030001UL) || (message->uladdress != getSequence) ||
+        (message->uldataw1 != ~getSequence) || (message->uldataw2 != (Uint32)(getSequence * 2654435761UL)))
+    {
+        errors++;
+        getSequence = message->uladdress;   // Resynchronise so one fault counts once
+    }
+    getSequence++;
+}
+
+static void BenchReport(const char *name, Uint32 messages, Uint64 ns)
+{
+    printf("%-22s: %lu messages, %.1f ns/message, %.2f IPC flags/message\n", name, (unsigned long)messages,
+           messages ? (float64)ns / messages : 0.0, messages ? (float64)flags / messages : 0.0);
+}
+
+// IpcPut()/IpcGet() one message at a time
+static Uint64 BenchPerMessage(Uint32 messages)
+{
+    volatile tIpcController cpu1;
+    volatile tIpcController cpu2;
+    tIpcMessage message;
+    Uint64 start;
+
+    IPCInitialize(&cpu1, BENCH_INT, BENCH_INT);
+    HostIpcRemote(&cpu2, BENCH_INT);
+    *(cpu2.pusGetReadIndex) = 0;
+
+    start = HostWallNs();
+    while (putSequence < messages)
+    {
+        do {
+            BenchMessage(&message);
+            if (IpcPut(&cpu1, &message, DISABLE_BLOCKING) != STATUS_PASS)
+            {
+                putSequence--;
+                break;
+            }
+            flags++;
+        } while (putSequence < messages);
+
+        while (IpcGet(&cpu2, &message, DISABLE_BLOCKING) == STATUS_PASS)
+        {
+            BenchCheck(&message);
+        }
+    }
+    return HostWallNs() - start;
+}
+
+// IpcPutBatch()/IpcGetBatch() with up to size messages per call
+static Uint64 BenchBatch(Uint32 messages, Uint16 size)
+{
+    IPC_BATCH cpu1;
+    IPC_BATCH cpu2;
+    tIpcMessage put[IPC_BATCH_MAX];
+    tIpcMessage got[IPC_BATCH_MAX];
+    Uint16 count;
+    Uint16 queued;
+    Uint16 i;
+    Uint64 start;
+
+    IpcBatchInit(&cpu1, BENCH_INT, BENCH_INT, NULL, NULL);
+    memset(&cpu2, 0, sizeof(cpu2));
+    HostIpcRemote(&cpu2.controller, BENCH_INT);
+    *(cpu2.controller.pusGetReadIndex) = 0;
+
+    start = HostWallNs();
+    while (putSequence < messages)
+    {
+        count = (messages - putSequence < size) ? (Uint16)(messages - putSequence) : size;
+        for (i = 0; i < count; i++)
+        {
+            BenchMessage(&put[i]);
+        }
+        queued = IpcPutBatch(&cpu1, put, count);
+        putSequence -= count - queued;
+        flags += (queued != 0);
+
+        while ((count = IpcGetBatch(&cpu2, got, IPC_BATCH_MAX)) != 0)
+        {
+            for (i = 0; i < count; i++)
+            {
+                BenchCheck(&got[i]);
+            }
+        }
+    }
+    return HostWallNs() - start;
+}
+
+// One two-thread run
+typedef struct
+{
+    volatile tIpcController cpu1;               // Producer's controller
+    volatile tIpcController cpu2;               // Consumer's controller, CPU2's view
+    Uint16 blocking;                            // ENABLE_BLOCKING or DISABLE_BLOCKING
+    Uint32 messages;
+    int cpu[2];                                 // Host CPUs of producer and consumer
+    pthread_barrier_t start;
+    Uint32 *latency;                            // Send-to-get ns per message
+    Uint64 retries[2];                          // DISABLE_BLOCKING calls that returned STATUS_FAIL
+    Uint64 stale;                               // Messages out of sequence or with torn content
+    Uint64 startNs;
+    Uint64 endNs;
+} BENCH_THREADS;
+
+static void BenchPin(int cpu)
+{
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+    {
+        fprintf(stderr, "ipc_bench: cannot pin to CPU %d, left to the scheduler\n", cpu);
+    }
+}
+
+// CPU1: IpcPut() every message, stamped with the send time
+static void *BenchProducer(void *arg)
+{
+    BENCH_THREADS *run = arg;
+    tIpcMessage message;
+    Uint64 now;
+    Uint32 sequence;
+
+    BenchPin(run->cpu[0]);
+    pthread_barrier_wait(&run->start);
+    for (sequence = 0; sequence < run->messages; sequence++)
+    {
+        now = HostWallNs();
+        message.ulcommand = BENCH_THREAD_COMMAND;
+        message.uladdress = sequence;
+        message.uldataw1 = (Uint32)now;
+        message.uldataw2 = (Uint32)(now >> 32) ^ (Uint32)(sequence * 2654435761UL);
+        while (IpcPut(&run->cpu1, &message, run->blocking) != STATUS_PASS)
+        {
+            run->retries[0]++;                  // Buffer full: a real caller would do other work
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+// CPU2: IpcGet() every message, check it and record its latency
+static void *BenchConsumer(void *arg)
+{
+    BENCH_THREADS *run = arg;
+    tIpcMessage message;
+    Uint64 sent;
+    Uint64 now;
+    Uint32 sequence;
+
+    BenchPin(run->cpu[1]);
+    pthread_barrier_wait(&run->start);
+    run->startNs = HostWallNs();
+    for (sequence = 0; sequence < run->messages; sequence++)
+    {
+        while (IpcGet(&run->cpu2, &message, run->blocking) != STATUS_PASS)
+        {
+            run->retries[1]++;                  // Buffer empty
+            sched_yield();
+        }
+        now = HostWallNs();
+        sent = ((Uint64)(message.uldataw2 ^ (Uint32)(sequence * 2654435761UL)) << 32) | message.uldataw1;
+        if ((message.ulcommand != BENCH_THREAD_COMMAND) || (message.uladdress != sequence) || (sent > now))
+        {
+            run->stale++;                       // Index seen before the message it publishes
+            run->latency[sequence] = 0;
+            continue;
+        }
+        run->latency[sequence] = (now - sent < 0xFFFFFFFFULL) ? (Uint32)(now - sent) : 0xFFFFFFFFUL;
+    }
+    run->endNs = HostWallNs();
+    return NULL;
+}
+
+static int BenchCompare(const void *a, const void *b)
+{
+    Uint32 x = *(const Uint32 *)a;
+    Uint32 y = *(const Uint32 *)b;
+
+    return (x > y) - (x < y);
+}
+
+// Producer and consumer threads through IpcPut()/IpcGet()
+static void BenchThreads(Uint32 messages, Uint16 blocking, const int cpu[2])
+{
+    static const float64 percentile[] = { 50.0, 90.0, 99.0, 99.9 };
+    BENCH_THREADS run;
+    pthread_t producer;
+    pthread_t consumer;
+    float64 seconds;
+    Uint16 i;
+
+    memset(&run, 0, sizeof(run));
+    IPCInitialize(&run.cpu1, BENCH_INT, BENCH_INT);
+    HostIpcRemote(&run.cpu2, BENCH_INT);
+    *(run.cpu2.pusGetReadIndex) = 0;
+    run.blocking = blocking;
+    run.messages = messages;
+    run.cpu[0] = cpu[0];
+    run.cpu[1] = cpu[1];
+    run.latency = calloc(messages, sizeof(run.latency[0]));
+    assert(run.latency != NULL);
+    pthread_barrier_init(&run.start, NULL, 2);
+
+    pthread_create(&consumer, NULL, BenchConsumer, &run);
+    pthread_create(&producer, NULL, BenchProducer, &run);
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+    pthread_barrier_destroy(&run.start);
+
+    seconds = (float64)(run.endNs - run.startNs) * 1e-9;
+    printf("%-22s: %lu messages, %.0f messages/s, %llu/%llu put/get retries, %llu stale\n",
+           blocking ? "threads, blocking" : "threads, non-blocking", (unsigned long)messages,
+           (seconds > 0.0) ? messages / seconds : 0.0, (unsigned long long)run.retries[0],
+           (unsigned long long)run.retries[1], (unsigned long long)run.stale);
+    qsort(run.latency, messages, sizeof(run.latency[0]), BenchCompare);
+    printf("%-22s:", "  latency ns");
+    for (i = 0; i < sizeof(percentile) / sizeof(percentile[0]); i++)
+    {
+        printf(" p%g %lu", percentile[i], (unsigned long)run.latency[(Uint32)(percentile[i] / 100.0 * (messages - 1))]);
+    }
+    printf(" max %lu\n", (unsigned long)run.latency[messages - 1]);
+
+    errors += run.stale;
+    free(run.latency);
+}
+
+// The orderings IpcPut()/IpcGet() take from the C28x and whether this host keeps them
+static void BenchOrdering(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    const char *kept = "kept (x86 TSO)";
+#else
+    const char *kept = "NOT KEPT on this weakly ordered host";
+#endif
+
+    printf("Memory ordering       : the driver has no barriers and no volatile on the buffers or indexes\n");
+    printf("  IpcPut  message -> write index   (store-store)  : %s\n", kept);
+    printf("  IpcGet  write index -> message   (load-load)    : %s\n", kept);
+    printf("  IpcGet  message -> read index    (load-store)   : %s\n", kept);
+    printf("  compiler: the message copy and the index store are both plain stores; only the volatile\n"
+           "  reload of the controller fields between them keeps gcc from swapping them\n");
+}
+
+int main(int argc, char **argv)
+{
+    Uint32 messages = 1000000;
+    Uint32 threaded = 200000;
+    int cpu[2] = { 0, 1 };
+    Uint64 ns;
+    Uint16 size;
+    char name[32];
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc))
+        {
+            messages = (Uint32)strtoul(argv[++i], NULL, 0);
+        }
+        else if ((strcmp(argv[i], "-t") == 0) && (i + 1 < argc))
+        {
+            threaded = (Uint32)strtoul(argv[++i], NULL, 0);
+        }
+        else if ((strcmp(argv[i], "--cpus") == 0) && (i + 1 < argc) &&
+                 (sscanf(argv[++i], "%d,%d", &cpu[0], &cpu[1]) == 2))
+        {
+            continue;
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-n messages] [-t messages] [--cpus producer,consumer]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("IPC buffer            : %u messages (%u usable) x %u interrupts\n",
+           IPC_BUFFER_SIZE, IPC_BATCH_MAX, NUM_IPC_INTERRUPTS);
+
+    putSequence = getSequence = 0;
+    flags = 0;
+    ns = BenchPerMessage(messages);
+    BenchReport("per-message", getSequence, ns);
+
+    if (getSequence != messages)
+    {
+        errors++;
+    }
+
+    // Powers of two, then a full buffer
+    size = 1;
+    while (1)
+    {
+        putSequence = getSequence = 0;
+        flags = 0;
+        ns = BenchBatch(messages, size);
+        sprintf(name, "batch %u", size);
+        BenchReport(name, getSequence, ns);
+        if (getSequence != messages)
+        {
+            errors++;
+        }
+        if (size == IPC_BATCH_MAX)
+        {
+            break;
+        }
+        size = (2 * size < IPC_BATCH_MAX) ? 2 * size : IPC_BATCH_MAX;
+    }
+
+    if (threaded != 0)
+    {
+        BenchOrdering();
+        if (sysconf(_SC_NPROCESSORS_ONLN) < 2)
+        {
+            // A spinning thread holds the only CPU until its time slice ends
+            cpu[0] = cpu[1] = 0;
+            printf("Threads               : one host CPU online, both threads on CPU 0, blocking run skipped\n");
+        }
+        else
+        {
+            printf("Threads               : producer on CPU %d, consumer on CPU %d\n", cpu[0], cpu[1]);
+            BenchThreads(threaded, ENABLE_BLOCKING, cpu);
+        }
+        BenchThreads(threaded, DISABLE_BLOCKING, cpu);
+    }
+
+    if (errors != 0)
+    {
+        printf("FAIL: %llu messages lost or corrupted\n", (unsigned long long)errors);
+    }
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return errors ? 1 : 0;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: sinetab_gen.c
+/*
+// File Description:
+// Writes ../cpu01/sinetab.c, the DDS sine table (dds.h), to standard output:
+// DDS_TABLE_SIZE + 1 entries of round(32767 sin(2 pi i / DDS_TABLE_SIZE)), the last
+// one repeating entry 0 so the interpolation never wraps. 'make sinetab' regenerates
+// the firmware file; 'make check' fails if the checked-in table differs from this output.
+//
+// Usage: sinetab_gen > ../cpu01/sinetab.c
+// -----------------------------------------------------------------------------
+ */
+
+#include <math.h>
+#include <stdio.h>
+
+#define TABLE_BITS      10              // DDS_TABLE_BITS in dds.h
+#define TABLE_SIZE      (1 << TABLE_BITS)
+#define VALUES_PER_LINE 8
+
+int main(void)
+{
+    const double pi = 3.14159265358979323846;
+    long value;
+    int i;
+
+    printf("// ----------------------------------------------------------------------------- //\n"
+           "// Beginning of File\n"
+           "//\n"
+           "// File: sinetab.c\n"
+           "/*\n"
+           "// File Description:\n"
+           "// DDS sine table, see dds.h. Generated by host/sinetab_gen.c ('make sinetab' in\n"
+           "// actuation/host), do not edit: sin(2 pi i / %d) in Q15, entry %d repeats entry 0.\n"
+           "// -----------------------------------------------------------------------------\n"
+           " */\n"
+           "\n"
+           "#include \"dds.h\"\n"
+           "\n"
+           "#if DDS_TABLE_BITS != %d\n"
+           "#error \"sinetab.c was generated for a different DDS_TABLE_BITS, run 'make sinetab'\"\n"
+           "#endif\n"
+           "\n"
+           "// table section declaration, as in the SGEN linker command files\n"
+           "#pragma DATA_SECTION(DdsSineTable, \"SINTBL\")\n"
+           "\n"
+           "const int16 DdsSineTable[DDS_TABLE_SIZE + 1] = {",
+           TABLE_SIZE, TABLE_SIZE, TABLE_BITS);
+    for (i = 0; i <= TABLE_SIZE; i++)
+    {
+        value = lround(32767.0 * sin(2.0 * pi * (i % TABLE_SIZE) / TABLE_SIZE));
+        printf("%s%6ld%s", (i % VALUES_PER_LINE) ? " " : "\n    ", value, (i < TABLE_SIZE) ? "," : " ");
+        if ((i % VALUES_PER_LINE == VALUES_PER_LINE - 1) || (i == TABLE_SIZE))
+        {
+            printf("  // [%d]", i - i % VALUES_PER_LINE);
+        }
+    }
+    printf("\n};\n"
+           "\n"
+           "// ----------------------------------------------------------------------------- //\n"
+           "// End of file\n"
+           "// ----------------------------------------------------------------------------- //\n");
+    return 0;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,180 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: telemetry_decoder.c
+/*
+// File Description:
+// Telemetry stream decoder. See telemetry_decoder.h.
+// -----------------------------------------------------------------------------
+ */
+
+#include <string.h>
+#include "telemetry_decoder.h"
+
+static uint16_t crcTable[256];          // Byte-wise CRC-16/CCITT-FALSE table
+static int crcReady;
+
+static void CrcTableInit(void)
+{
+    unsigned i;
+    unsigned bit;
+    uint16_t crc;
+
+    for (i = 0; i < 256; i++)
+    {
+        crc = (uint16_t)(i << 8);
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+        crcTable[i] = crc;
+    }
+    crcReady = 1;
+}
+
+uint16_t TlmCrc(uint16_t crc, const uint8_t *data, size_t count)
+{
+    size_t i;
+
+    if (!crcReady)
+    {
+        CrcTableInit();
+    }
+    for (i = 0; i < count; i++)
+    {
+        crc = (uint16_t)((crc << 8) ^ crcTable[(crc >> 8) ^ data[i]]);
+    }
+    return crc;
+}
+
+void TlmDecoderInit(TLM_DECODER *decoder, TLM_SAMPLE_CALLBACK callback, void *context)
+{
+    memset(decoder, 0, sizeof(*decoder));
+    decoder->callback = callback;
+    decoder->context = context;
+    if (!crcReady)
+    {
+        CrcTableInit();
+    }
+}
+
+// Undo the byte stuffing; returns the decoded length or 0 if the encoding is broken
+static size_t CobsDecode(const uint8_t *in, size_t length, uint8_t *out)
+{
+    size_t i = 0;
+    size_t n = 0;
+    unsigned code;
+    unsigned j;
+
+    while (i < length)
+    {
+        code = in[i++];
+        if ((code == 0) || (i + code - 1 > length))
+        {
+            return 0;
+        }
+        for (j = 1; j < code; j++)
+        {
+            out[n++] = in[i++];
+        }
+        if ((code != 0xFF) && (i < length))
+        {
+            out[n++] = 0;
+        }
+    }
+    return n;
+}
+
+static void DecodeFrame(TLM_DECODER *decoder)
+{
+    uint8_t raw[TLM_ENCODED_MAX];
+    TLM_SAMPLE samples[TLM_SAMPLES_PER_FRAME];
+    const uint8_t *p;
+    size_t length;
+    uint16_t sequence;
+    uint32_t timestamp;
+    unsigned count;
+    unsigned i;
+
+    length = CobsDecode(decoder->frame, decoder->length, raw);
+    if (length < TLM_HEADER_BYTES + TLM_CRC_BYTES)
+    {
+        decoder->stats.framingErrors++;
+        return;
+    }
+    if (TlmCrc(TLM_CRC_INIT, raw, length - TLM_CRC_BYTES) !=
+        (uint16_t)(raw[length - 2] | (raw[length - 1] << 8)))
+    {
+        decoder->stats.crcErrors++;
+        return;
+    }
+    count = raw[7];
+    if ((raw[0] != ((TLM_VERSION << 4) | TLM_TYPE_SAMPLES)) || (count == 0) || (count > TLM_SAMPLES_PER_FRAME) ||
+        (length != TLM_HEADER_BYTES + count * TLM_SAMPLE_BYTES + TLM_CRC_BYTES))
+    {
+        decoder->stats.framingErrors++;
+        return;
+    }
+
+    sequence = (uint16_t)(raw[1] | (raw[2] << 8));
+    timestamp = (uint32_t)raw[3] | ((uint32_t)raw[4] << 8) | ((uint32_t)raw[5] << 16) | ((uint32_t)raw[6] << 24);
+    if (decoder->synced)
+    {
+        decoder->stats.lostFrames += (uint16_t)(sequence - decoder->nextSequence);
+        decoder->stats.lostSamples += (uint32_t)(timestamp - decoder->nextTimestamp);
+    }
+    decoder->synced = 1;
+    decoder->nextSequence = (uint16_t)(sequence + 1);
+    decoder->nextTimestamp = timestamp + count;
+
+    p = &raw[TLM_HEADER_BYTES];
+    for (i = 0; i < count; i++, p += TLM_SAMPLE_BYTES)
+    {
+        samples[i].timestamp = timestamp + i;
+        samples[i].adc[0] = (uint16_t)(p[0] | ((p[1] & 0x0F) << 8));
+        samples[i].adc[1] = (uint16_t)((p[1] >> 4) | (p[2] << 4));
+        samples[i].adc[2] = (uint16_t)(p[3] | ((p[4] & 0x0F) << 8));
+        samples[i].adc[3] = (uint16_t)((p[4] >> 4) | (p[5] << 4));
+    }
+    decoder->stats.frames++;
+    decoder->stats.samples += count;
+    if (decoder->callback)
+    {
+        decoder->callback(decoder->context, samples, count);
+    }
+}
+
+void TlmDecoderFeed(TLM_DECODER *decoder, const uint8_t *data, size_t count)
+{
+    size_t i;
+
+    decoder->stats.bytes += count;
+    for (i = 0; i < count; i++)
+    {
+        if (data[i] == TLM_DELIMITER)
+        {
+            if (decoder->overflow)
+            {
+                decoder->stats.framingErrors++;
+            }
+            else if (decoder->length != 0)
+            {
+                DecodeFrame(decoder);
+            }
+            decoder->length = 0;
+            decoder->overflow = 0;
+        }
+        else if (decoder->length < sizeof(decoder->frame))
+        {
+            decoder->frame[decoder->length++] = data[i];
+        }
+        else
+        {
+            decoder->overflow = 1;      // Longer than any valid frame, drop it
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: telemetry_decoder.h
+/*
+// File Description:
+// Linux decoder of the telemetry stream (../cpu01/telemetry_protocol.h). Plain C99
+// with no dependency on the firmware or the device headers, so it can be linked into
+// any host tool; telemetry_dump.c is the command line front end.
+//
+// Bytes are fed in arbitrary chunks as they come off the serial port. Every complete
+// frame is COBS decoded, CRC checked and unpacked, and its samples are passed to the
+// callback with their timestamps. The decoder keeps no more than one frame of state
+// and does a fixed amount of work per byte.
+// -----------------------------------------------------------------------------
+ */
+
+#ifndef TELEMETRY_DECODER_H
+#define TELEMETRY_DECODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "telemetry_protocol.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// One decoded sample of all four channels
+typedef struct
+{
+    uint32_t timestamp;                 // Sample number on the target
+    uint16_t adc[TLM_CHANNELS];         // Raw 12-bit ADC-A..D results
+} TLM_SAMPLE;
+
+// Receives the samples of one frame
+typedef void (*TLM_SAMPLE_CALLBACK)(void *context, const TLM_SAMPLE *samples, unsigned count);
+
+// Decoder counters
+typedef struct
+{
+    uint64_t bytes;                     // Bytes fed
+    uint64_t frames;                    // Valid frames
+    uint64_t samples;                   // Samples delivered
+    uint64_t crcErrors;                 // Frames with a bad CRC
+    uint64_t framingErrors;             // Bad COBS, length, type or oversized frames
+    uint64_t lostFrames;                // Gaps in the sequence numbers
+    uint64_t lostSamples;               // Gaps in the timestamps (link loss or target overflow)
+} TLM_DECODER_STATS;
+
+typedef struct
+{
+    uint8_t frame[TLM_ENCODED_MAX];     // Encoded bytes since the last delimiter
+    size_t length;                      // Bytes in frame[]
+    int overflow;                       // Frame too long, skip to the next delimiter
+    int synced;                         // A valid frame has been seen
+    uint16_t nextSequence;              // Sequence number expected next
+    uint32_t nextTimestamp;             // Timestamp expected next
+    TLM_SAMPLE_CALLBACK callback;
+    void *context;
+    TLM_DECODER_STATS stats;
+} TLM_DECODER;
+
+// Function Prototypes
+void TlmDecoderInit(TLM_DECODER *decoder, TLM_SAMPLE_CALLBACK callback, void *context);
+void TlmDecoderFeed(TLM_DECODER *decoder, const uint8_t *data, size_t count);
+uint16_t TlmCrc(uint16_t crc, const uint8_t *data, size_t count);  // CRC-16/CCITT-FALSE
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // end of TELEMETRY_DECODER_H definition
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //
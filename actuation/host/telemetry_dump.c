@@ -0,0 +1,194 @@
+// ----------------------------------------------------------------------------- //
+// Beginning of File
+//
+// File: telemetry_dump.c
+/*
+// File Description:
+// Command line receiver for the SCI-A telemetry stream. Reads a serial port (set to
+// raw 8N1 at the given baud rate, any rate the adapter supports), a capture file or
+// stdin, decodes it with telemetry_decoder.c and prints the link statistics once per
+// second on stderr. With -c every sample is written to stdout as CSV:
+//   timestamp,mmSpeed,DutyCycle,maCurrent,LoadTorque   (raw ADC-A..D counts)
+//
+// Usage: telemetry_dump [-b baud] [-c] [-o capture.bin] <tty|file|->
+//   -b baud   configure a serial port (default 5000000, the firmware SCI_BAUD)
+//   -c        print the samples as CSV
+//   -o file   also write the received bytes to a capture file for later replay
+// Exit status is non-zero if any frame was corrupted or lost.
+// -----------------------------------------------------------------------------
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <asm/termbits.h>       // termios2 and BOTHER, for rates without a Bxxx constant
+#include "telemetry_decoder.h"
+
+static int printCsv;                    // -c given
+
+static void PrintSamples(void *context, const TLM_SAMPLE *samples, unsigned count)
+{
+    unsigned i;
+
+    (void)context;
+    if (!printCsv)
+    {
+        return;
+    }
+    for (i = 0; i < count; i++)
+    {
+        printf("%lu,%u,%u,%u,%u\n", (unsigned long)samples[i].timestamp,
+               samples[i].adc[0], samples[i].adc[1], samples[i].adc[2], samples[i].adc[3]);
+    }
+}
+
+// Raw 8N1 at an arbitrary baud rate; returns 0 if fd is not a serial port
+static int ConfigurePort(int fd, unsigned long baud)
+{
+    struct termios2 tio;
+
+    if (ioctl(fd, TCGETS2, &tio) != 0)
+    {
+        return 0;
+    }
+    tio.c_iflag = 0;
+    tio.c_oflag = 0;
+    tio.c_lflag = 0;
+    tio.c_cflag = CS8 | CREAD | CLOCAL | BOTHER | (BOTHER << IBSHIFT);
+    tio.c_ispeed = baud;
+    tio.c_ospeed = baud;
+    tio.c_cc[VMIN] = 1;
+    tio.c_cc[VTIME] = 0;
+    if (ioctl(fd, TCSETS2, &tio) != 0)
+    {
+        perror("TCSETS2");
+        exit(1);
+    }
+    return 1;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void PrintStats(const TLM_DECODER_STATS *s, double seconds, uint64_t samples)
+{
+    fprintf(stderr, "%llu bytes, %llu frames, %llu samples (%.0f/s), %llu lost frames, %llu lost samples, "
+            "%llu CRC errors, %llu framing errors\n",
+            (unsigned long long)s->bytes, (unsigned long long)s->frames, (unsigned long long)s->samples,
+            (seconds > 0.0) ? samples / seconds : 0.0, (unsigned long long)s->lostFrames,
+            (unsigned long long)s->lostSamples, (unsigned long long)s->crcErrors,
+            (unsigned long long)s->framingErrors);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long baud = 5000000UL;
+    const char *path = NULL;
+    const char *capturePath = NULL;
+    FILE *capture = NULL;
+    TLM_DECODER decoder;
+    uint8_t buffer[4096];
+    uint64_t lastSamples = 0;
+    double lastReport;
+    double now;
+    ssize_t n;
+    int fd;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-b") == 0) && (i + 1 < argc))
+        {
+            baud = strtoul(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-c") == 0)
+        {
+            printCsv = 1;
+        }
+        else if ((strcmp(argv[i], "-o") == 0) && (i + 1 < argc))
+        {
+            capturePath = argv[++i];
+        }
+        else if ((argv[i][0] != '-') || (strcmp(argv[i], "-") == 0))
+        {
+            path = argv[i];
+        }
+        else
+        {
+            path = NULL;
+            break;
+        }
+    }
+    if (path == NULL)
+    {
+        fprintf(stderr, "usage: %s [-b baud] [-c] [-o capture.bin] <tty|file|->\n", argv[0]);
+        return 2;
+    }
+
+    fd = (strcmp(path, "-") == 0) ? STDIN_FILENO : open(path, O_RDONLY | O_NOCTTY);
+    if (fd < 0)
+    {
+        perror(path);
+        return 1;
+    }
+    if (ConfigurePort(fd, baud))
+    {
+        fprintf(stderr, "%s: %lu baud 8N1\n", path, baud);
+    }
+    if ((capturePath != NULL) && ((capture = fopen(capturePath, "wb")) == NULL))
+    {
+        perror(capturePath);
+        return 1;
+    }
+
+    TlmDecoderInit(&decoder, PrintSamples, NULL);
+    lastReport = Now();
+    while ((n = read(fd, buffer, sizeof(buffer))) != 0)
+    {
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("read");
+            break;
+        }
+        if (capture != NULL)
+        {
+            fwrite(buffer, 1, (size_t)n, capture);
+        }
+        TlmDecoderFeed(&decoder, buffer, (size_t)n);
+
+        now = Now();
+        if (now - lastReport >= 1.0)
+        {
+            PrintStats(&decoder.stats, now - lastReport, decoder.stats.samples - lastSamples);
+            lastSamples = decoder.stats.samples;
+            lastReport = now;
+        }
+    }
+
+    PrintStats(&decoder.stats, 0.0, 0);
+    if (capture != NULL)
+    {
+        fclose(capture);
+    }
+    return ((decoder.stats.crcErrors | decoder.stats.framingErrors |
+             decoder.stats.lostFrames | decoder.stats.lostSamples) != 0) ? 1 : 0;
+}
+
+// ----------------------------------------------------------------------------- //
+// End of file
+// ----------------------------------------------------------------------------- //